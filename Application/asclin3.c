@@ -35,193 +35,229 @@
 #include "Ifx_Types.h"
 #include "IfxCpu.h"
 #include "Ifx_reg.h"
-#include "ifxScuWdt.h"
+#include "IfxScuWdt.h"
+#include "IfxScuCcu.h"
+#include "IfxAsclin_bf.h"
+#include "IfxPort_bf.h"
 
-#include "intpriodef.h"
+#include "IntPrioDef.h"
+#include "NoClearDef.h"
 #include "ports.h"
 
 #include "asclin_private.h"
 #include "dma_private.h"
+#include "isrstat_public.h"
+#include "trace_public.h"
+#include "log_public.h"
+#include "initseq_public.h"
+#include "dmacfg_public.h"
+#include "dmaalloc_public.h"
 #include "asclin3_public.h"
 
 #define ASCLIN3_RXBUF_SIZE ((uint16)200u) /**< \brief */
 #define ASCLIN3_TXBUF_SIZE ((uint16)200u) /**< \brief */
+#define ASCLIN3_BAUDRATE   ((uint32)115200u) /**< \brief default baud rate */
+#define ASCLIN3_OVERSAMPLING 16u /**< \brief must match BITCON.OVERSAMPLING */
+#define ASCLIN3_BRG_MAX    4095u /**< \brief BRG.NUMERATOR and BRG.DENOMINATOR are 12 bit wide */
+#define ASCLIN3_DMA_TX_CH  SRPN_DMA_CH_QSPI3_TX /**< \brief the SRPN of a DMA service request is the channel */
+#define ASCLIN3_DMA_RX_CH  SRPN_DMA_CH_QSPI3_RX
 
 /** \addtogroup Asclin_Variables */
 /* private data */
 static uint8  ASCLIN3_txBusy;
+static volatile uint8 ASCLIN3_txDmaBusy;
 static volatile uint16 ASCLIN3_rxReceiveCount;
 static volatile uint16 ASCLIN3_txSendCount;
 static volatile uint16 ASCLIN3_errorCount;
 static volatile uint16 ASCLIN3_txDmaCnt;
 static volatile uint16 ASCLIN3_rxDmaCnt;
+static uint32 ASCLIN3_baudrate = ASCLIN3_BAUDRATE;
+static boolean ASCLIN3_txPending;
+static uint16 ASCLIN3_rxDmaRead;
+static uint16 ASCLIN3_rxTrel;          /* bytes of a receive block, TREL of channel 6 */
 
 static uint16 ASCLIN3_txHeadIdx;
 static uint16 ASCLIN3_rxHeadIdx;
 static uint16 ASCLIN3_txTailIdx;
 static uint16 ASCLIN3_rxTailIdx;
 
+/* DMA buffers, always written before they are read, no need to clear them at startup.
+ * In DSPR0 with the CPU0 handlers and the scheduler loop which fill and drain them */
+NOCLEAR_BEGIN(cpu0)
 uint8 txData[ASCLIN3_TXBUF_SIZE];
 uint8 rxData[ASCLIN3_RXBUF_SIZE];
+NOCLEAR_END
 
 /* private functions */
 void ASCLIN3_TxISR(void);
 void ASCLIN3_RxISR(void);
 void ASCLIN3_ErrorISR(void);
 void ASCLIN3_DMA_Init(uint16 trel);
+static void ASCLIN3_WriteBrg(void);
 
-/* global functions */
-
-/** \brief
- *
- * \param None
- * \return Nothing
- *
- * \ingroup
+/** \addtogroup Asclin_Variables */
+/** \brief Reset and configuration of the kernel, before the baud rate.
+ * The windows are written per register, INITSEQ_Run opens them once.
  */
-void ASCLIN3_Init (void)
+static const INITSEQ_Step ASCLIN3_setupSteps[] =
 {
-    uint16 cpuPassword = IfxScuWdt_getCpuWatchdogPassword();
-    IfxScuWdt_clearCpuEndinit(cpuPassword);
-    ASCLIN3_CLC.U = 0; /* enable peripheral and allow sleep mode */
-    (void) ASCLIN3_CLC.U;
-#if 0
+    /* enable peripheral and allow sleep mode */
+    INITSEQ_UNLOCK(initseq_Endinit_cpu),
+    INITSEQ_WRITE(ASCLIN3_CLC, 0),
+    INITSEQ_WAIT(ASCLIN3_CLC, INITSEQ_MASK(ASCLIN, CLC, DISS), 0),
     /* change the driver strength on the port transmit pin */
-    P15_PDR0.U = 0;
+#if 0
+    INITSEQ_WRITE(P15_PDR0, 0),
 #else
-    /* change the driver strength on the port transmit pin */
-    P00_PDR0.U = 0;
+    INITSEQ_WRITE(P00_PDR0, 0),
 #endif
+    INITSEQ_LOCK(initseq_Endinit_cpu),
 
     /* Kernel reset */
-    ASCLIN3_KRST0.U = 0x01;
-    ASCLIN3_KRST1.U = 0x01;
-    IfxScuWdt_setCpuEndinit(cpuPassword);
-
-    while ((ASCLIN3_KRST0.U & 0x02) != 0x02)
-        ;
-    IfxScuWdt_clearCpuEndinit(cpuPassword);
-    ASCLIN3_KRSTCLR.U = 0x01; /* Clear Reset done flag */
-    IfxScuWdt_setCpuEndinit(cpuPassword);
+    INITSEQ_UNLOCK(initseq_Endinit_cpu),
+    INITSEQ_WRITE(ASCLIN3_KRST0, INITSEQ_FIELD(ASCLIN, KRST0, RST, 1)),
+    INITSEQ_WRITE(ASCLIN3_KRST1, INITSEQ_FIELD(ASCLIN, KRST1, RST, 1)),
+    INITSEQ_LOCK(initseq_Endinit_cpu),
+    INITSEQ_WAIT(ASCLIN3_KRST0, INITSEQ_MASK(ASCLIN, KRST0, RSTSTAT), INITSEQ_MASK(ASCLIN, KRST0, RSTSTAT)),
+    INITSEQ_UNLOCK(initseq_Endinit_cpu),
+    INITSEQ_WRITE(ASCLIN3_KRSTCLR, INITSEQ_FIELD(ASCLIN, KRSTCLR, CLR, 1)), /* Clear Reset done flag */
+    INITSEQ_LOCK(initseq_Endinit_cpu),
 
 #if 0
-    /* ASC1_ATX / P15.4 transmit output is O2  */
-    P15_IOCR4.B.PC4 = Port_PCx_Output_PushPull_Alt_2;
-    /* ASC1_ARX1B / P15.5  */
-    P15_IOCR4.B.PC5 = Port_PCx_Input_PullUp;
+    /* ASC1_ATX / P15.4 transmit output is O2, ASC1_ARX1B / P15.5 */
+    INITSEQ_MODIFY(P15_IOCR4, INITSEQ_MASK(P, IOCR4, PC4) | INITSEQ_MASK(P, IOCR4, PC5),
+                   INITSEQ_FIELD(P, IOCR4, PC4, Port_PCx_Output_PushPull_Alt_2) |
+                   INITSEQ_FIELD(P, IOCR4, PC5, Port_PCx_Input_PullUp)),
 #else
-    /* ASCLIN3_ATX P00.0 transmit output is O3 */
-    P00_IOCR0.B.PC0 = PCx_Output_PushPull_Alt_3;
-    /* ASCLIN3_ARXG P00.1 receive pin*/
-    P00_IOCR0.B.PC1 = PCx_Input_PullUp;
+    /* ASCLIN3_ATX P00.0 transmit output is O3, ASCLIN3_ARXG P00.1 receive pin */
+    INITSEQ_MODIFY(P00_IOCR0, INITSEQ_MASK(P, IOCR0, PC0) | INITSEQ_MASK(P, IOCR0, PC1),
+                   INITSEQ_FIELD(P, IOCR0, PC0, PCx_Output_PushPull_Alt_3) |
+                   INITSEQ_FIELD(P, IOCR0, PC1, PCx_Input_PullUp)),
 #endif
 
-    Ifx_ASCLIN_IOCR iocr =
-    {
+    INITSEQ_WRITE(ASCLIN3_IOCR,
 #if 0
-      .B.ALTI = asclin_iocr_RxInputSelect_ARXnB,
+                  INITSEQ_FIELD(ASCLIN, IOCR, ALTI, asclin_iocr_RxInputSelect_ARXnB) |
 #else
-      .B.ALTI = asclin_iocr_RxInputSelect_ARXnE,
+                  INITSEQ_FIELD(ASCLIN, IOCR, ALTI, asclin_iocr_RxInputSelect_ARXnE) |
 #endif
-      .B.DEPTH = 0, /*0=off, 1 to 63 */
-      .B.CTS = asclin_iocr_CtsInputSelect_0,
-      .B.RCPOL = asclin_iocr_RtsCtsPolarity_activeHigh,
-      .B.CPOL = asclin_iocr_ClockPolaritySyncMode_idleLow,
-      .B.SPOL = asclin_SlavePolaritySyncModeSlsoIdleLow,
-      .B.LB = asclin_iocr_LoopBackModeDisabled,
-      .B.CTSEN = asclin_iocr_CTS_disabled,
-    };
-    ASCLIN3_IOCR.U = iocr.U;
+                  INITSEQ_FIELD(ASCLIN, IOCR, DEPTH, 0) | /*0=off, 1 to 63 */
+                  INITSEQ_FIELD(ASCLIN, IOCR, CTS, asclin_iocr_CtsInputSelect_0) |
+                  INITSEQ_FIELD(ASCLIN, IOCR, RCPOL, asclin_iocr_RtsCtsPolarity_activeHigh) |
+                  INITSEQ_FIELD(ASCLIN, IOCR, CPOL, asclin_iocr_ClockPolaritySyncMode_idleLow) |
+                  INITSEQ_FIELD(ASCLIN, IOCR, SPOL, asclin_SlavePolaritySyncModeSlsoIdleLow) |
+                  INITSEQ_FIELD(ASCLIN, IOCR, LB, asclin_iocr_LoopBackModeDisabled) |
+                  INITSEQ_FIELD(ASCLIN, IOCR, CTSEN, asclin_iocr_CTS_disabled)),
+
+    INITSEQ_WRITE(ASCLIN3_TXFIFOCON,
+                  INITSEQ_FIELD(ASCLIN, TXFIFOCON, FLUSH, asclin_txfifocon_Flushed) |
+                  INITSEQ_FIELD(ASCLIN, TXFIFOCON, ENO, asclin_txfifocon_OutletEnabled) |
+                  INITSEQ_FIELD(ASCLIN, TXFIFOCON, INW, asclin_txfifocon_InletWidth_1) |
+                  INITSEQ_FIELD(ASCLIN, TXFIFOCON, INTLEVEL, asclin_txfifocon_InterruptLevel_15)),
+
+    INITSEQ_WRITE(ASCLIN3_RXFIFOCON,
+                  INITSEQ_FIELD(ASCLIN, RXFIFOCON, FLUSH, asclin_rxfifocon_Flushed) |
+                  INITSEQ_FIELD(ASCLIN, RXFIFOCON, ENI, asclin_rxfifocon_InletEnabled) |
+                  INITSEQ_FIELD(ASCLIN, RXFIFOCON, OUTW, asclin_rxfifocon_OutletWidth_1) |
+                  INITSEQ_FIELD(ASCLIN, RXFIFOCON, INTLEVEL, asclin_rxfifocon_InterruptLevel_1) |
+                  INITSEQ_FIELD(ASCLIN, RXFIFOCON, BUF, asclin_rxfifocon_ReceiveBufferMode_rxFifo)),
+
+    INITSEQ_WRITE(ASCLIN3_BITCON,
+                  INITSEQ_FIELD(ASCLIN, BITCON, SM, asclin_SamplesPerBit_three) |
+                  INITSEQ_FIELD(ASCLIN, BITCON, SAMPLEPOINT, asclin_SamplePointPosition_9) |
+                  INITSEQ_FIELD(ASCLIN, BITCON, OVERSAMPLING, asclin_OversamplingFactor_16) |
+                  INITSEQ_FIELD(ASCLIN, BITCON, PRESCALER, 0)),
+
+    INITSEQ_WRITE(ASCLIN3_FRAMECON,
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, ODD, asclin_ParityType_even) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, PEN, asclin_ParityEnable_Disabled) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, CEN, asclin_CollisionDetection_Disabled) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, MSB, asclin_ShiftDirection_lsbFirst) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, MODE, asclin_frameMode_initialise) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, LEAD, asclin_LeadDelay_0) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, STOP, asclin_StopBit_1) |
+                  INITSEQ_FIELD(ASCLIN, FRAMECON, IDLE, asclin_IdleDelay_0)),
+
+    INITSEQ_WRITE(ASCLIN3_DATCON,
+                  INITSEQ_FIELD(ASCLIN, DATCON, RESPONSE, 0) |
+                  INITSEQ_FIELD(ASCLIN, DATCON, CSM, asclin_Checksum_classic) |
+                  INITSEQ_FIELD(ASCLIN, DATCON, RM, asclin_LinResponseTimeoutMode_frameTimeout) |
+                  INITSEQ_FIELD(ASCLIN, DATCON, HO, asclin_HeaderResponseSelect_headerAndResponse) |
+                  INITSEQ_FIELD(ASCLIN, DATCON, DATLEN, asclin_DataLength_8)),
+};
+
+/** \brief Flags, service requests and start of the kernel, after the baud rate */
+static const INITSEQ_Step ASCLIN3_startSteps[] =
+{
+    /* Clear all Flags */
+    INITSEQ_WRITE(ASCLIN3_FLAGSCLEAR, 0xFFFFFFFFu),
 
-    Ifx_ASCLIN_TXFIFOCON txfifocon = {
-        .B.FLUSH = asclin_txfifocon_Flushed,
-        .B.ENO = asclin_txfifocon_OutletEnabled,
-        .B.INW = asclin_txfifocon_InletWidth_1,
-        .B.INTLEVEL = asclin_txfifocon_InterruptLevel_15,
-    };
-    ASCLIN3_TXFIFOCON.U = txfifocon.U;
-
-    Ifx_ASCLIN_RXFIFOCON rxfifocon = {
-      .B.FLUSH = asclin_rxfifocon_Flushed,
-      .B.ENI = asclin_rxfifocon_InletEnabled,
-      .B.OUTW = asclin_rxfifocon_OutletWidth_1,
-      .B.INTLEVEL = asclin_rxfifocon_InterruptLevel_1,
-      .B.BUF = asclin_rxfifocon_ReceiveBufferMode_rxFifo,
-    };
-    ASCLIN3_RXFIFOCON.U = rxfifocon.U;
+    INITSEQ_WRITE(ASCLIN3_FLAGSENABLE,
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, TFLE, TRUE) | /* Transmit FIFO Level */
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, TFOE, TRUE) | /* Transmit FIFO Overflow */
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, RFLE, TRUE) | /* Receive FIFO Level */
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, RFUE, TRUE) | /* Receive FIFO Underflow */
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, RFOE, TRUE) | /* Receive FIFO Overflow */
+                  INITSEQ_FIELD(ASCLIN, FLAGSENABLE, FEE, TRUE)),  /* Framing Error */
 
-    Ifx_ASCLIN_BITCON bitcon = {
-      .B.SM = asclin_SamplesPerBit_three,
-      .B.SAMPLEPOINT = asclin_SamplePointPosition_9,
-      .B.OVERSAMPLING = asclin_OversamplingFactor_16,
-      .B.PRESCALER = 0,
-    };
-    ASCLIN3_BITCON.U = bitcon.U;
-
-    Ifx_ASCLIN_FRAMECON framecon = {
-      .B.ODD = asclin_ParityType_even,
-      .B.PEN = asclin_ParityEnable_Disabled,
-      .B.CEN = asclin_CollisionDetection_Disabled,
-      .B.MSB = asclin_ShiftDirection_lsbFirst,
-      .B.MODE = asclin_frameMode_initialise,
-      .B.LEAD = asclin_LeadDelay_0,
-      .B.STOP = asclin_StopBit_1,
-      .B.IDLE = asclin_IdleDelay_0,
-    };
-    ASCLIN3_FRAMECON.U = framecon.U;
-
-    Ifx_ASCLIN_DATCON datcon = {
-      .B.RESPONSE = 0,
-      .B.CSM = asclin_Checksum_classic,
-      .B.RM = asclin_LinResponseTimeoutMode_frameTimeout,
-      .B.HO = asclin_HeaderResponseSelect_headerAndResponse,
-      .B.DATLEN = asclin_DataLength_8,
-    };
-    ASCLIN3_DATCON.U = datcon.U;
+#if 0 // use interrupts
+    INITSEQ_WRITE(SRC_ASCLIN3TX, TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_TX),
+    INITSEQ_WRITE(SRC_ASCLIN3RX, TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_RX),
+#else // use DMA
+    INITSEQ_WRITE(SRC_ASCLIN3TX, TOS_DMA | SRE_ON | SRPN_DMA_CH_QSPI3_TX),
+    INITSEQ_WRITE(SRC_ASCLIN3RX, TOS_DMA | SRE_ON | SRPN_DMA_CH_QSPI3_RX),
+#endif
+    INITSEQ_WRITE(SRC_ASCLIN3ERR, TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_ER),
 
-    /*  */
-    Ifx_ASCLIN_BRG brg = {
-      .B.NUMERATOR = 37,
-      .B.DENOMINATOR = 4015,
-    };
-    ASCLIN3_BRG.U = brg.U;
+    INITSEQ_MODIFY(ASCLIN3_FRAMECON, INITSEQ_MASK(ASCLIN, FRAMECON, MODE),
+                   INITSEQ_FIELD(ASCLIN, FRAMECON, MODE, asclin_frameMode_asc)),
 
-    /* Clear all Flags */
-    ASCLIN3_FLAGSCLEAR.U = 0xFFFFFFFF;
-
-    Ifx_ASCLIN_FLAGSENABLE flagenable = {
-      .B.TFLE = TRUE, /* Transmit FIFO Level */
-      .B.TFOE = TRUE, /* Transmit FIFO Overflow */
-      .B.RFLE = TRUE, /* Receive FIFO Level */
-      .B.RFUE = TRUE, /* Receive FIFO Underflow */
-      .B.RFOE = TRUE, /* Receive FIFO Overflow */
-      .B.FEE = TRUE,  /* Framing Error */
-    };
-    ASCLIN3_FLAGSENABLE.U = flagenable.U;
+    INITSEQ_WRITE(ASCLIN3_CSR,
+                  INITSEQ_FIELD(ASCLIN, CSR, CLKSEL, asclin_csr_ClockSource_fASCLINF) |
+                  INITSEQ_FIELD(ASCLIN, CSR, CON, asclin_csr_ClockIsOn)),
+};
 
-#if 0 // use interrupts
-    SRC_ASCLIN3TX.U =  TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_TX;
-    SRC_ASCLIN3RX.U =  TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_RX;
-#else // use DMA
-    SRC_ASCLIN3TX.U = TOS_DMA | SRE_ON | SRPN_DMA_CH_QSPI3_TX;
-    SRC_ASCLIN3RX.U = TOS_DMA | SRE_ON | SRPN_DMA_CH_QSPI3_RX;
+/** \brief Transmit channel, txData to TXDATA, and receive channel, RXDATA to rxData */
+static const DMACFG_Config ASCLIN3_txDmaConfig =
+    DMACFG_MEMORY_TO_PERIPHERAL(dma_chcfgrxxx_chdw_DataBitWidth_8, dma_chcfgrxxx_dmaprio_LowPrioritySelected);
+static const DMACFG_Config ASCLIN3_rxDmaConfig =
+    DMACFG_PERIPHERAL_TO_MEMORY(dma_chcfgrxxx_chdw_DataBitWidth_8, dma_chcfgrxxx_dmaprio_LowPrioritySelected);
 
-#endif
-    SRC_ASCLIN3ERR.U = TOS_CPU0 | SRE_ON | SRPN_CPU0_ASCLIN3_ER;
+static INITSEQ_Stats ASCLIN3_setupStats;
+static INITSEQ_Stats ASCLIN3_startStats;
+
+static const INITSEQ_Script ASCLIN3_setupScript = INITSEQ_SCRIPT("asclin3 setup", ASCLIN3_setupSteps, ASCLIN3_setupStats);
+static const INITSEQ_Script ASCLIN3_startScript = INITSEQ_SCRIPT("asclin3 start", ASCLIN3_startSteps, ASCLIN3_startStats);
+
+/* global functions */
+
+/** \brief Initialise ASCLIN3 in ASC mode and its DMA channels.
+ * The register writes are the scripts ASCLIN3_setupSteps and
+ * ASCLIN3_startSteps, only the baud rate is calculated at run time.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup Asclin_msg
+ */
+void ASCLIN3_Init (void)
+{
+    (void)INITSEQ_Run(&ASCLIN3_setupScript);
+
+    /* fractional divider for ASCLIN3_baudrate at the current fASCLINF,
+     * 37/4015 for 115200 baud at 200MHz */
+    ASCLIN3_WriteBrg();
 
-    ASCLIN3_FRAMECON.B.MODE = asclin_frameMode_asc;
     ASCLIN3_txSendCount = 0;
     ASCLIN3_txBusy = 0;
+    ASCLIN3_txDmaBusy = FALSE;
+    ASCLIN3_txPending = FALSE;
     ASCLIN3_txHeadIdx = 0;
     ASCLIN3_rxHeadIdx = 0;
     ASCLIN3_txTailIdx = 0;
     ASCLIN3_rxTailIdx = 0;
 
-    Ifx_ASCLIN_CSR csr = {
-      .B.CLKSEL = asclin_csr_ClockSource_fASCLINF,
-      .B.CON = asclin_csr_ClockIsOn,
-    };
-    ASCLIN3_CSR.U = csr.U;
+    (void)INITSEQ_Run(&ASCLIN3_startScript);
 
     for (uint32 i=0; i < 200;i++)
       txData[i] = (uint8)i;
@@ -255,7 +291,7 @@ void ASCLIN3_SendCmdMsg(void)
  *
  * \ingroup Asclin_msg
  */
-IFX_INTERRUPT(ASCLIN3_TxISR, VECTAB0, SRPN_CPU0_ASCLIN3_TX);
+IFX_INTERRUPT_STAT(ASCLIN3_TxISR, VECTAB0, SRPN_CPU0_ASCLIN3_TX);
 void ASCLIN3_TxISR(void)
 {
 	if (ASCLIN3_txSendCount > 0)
@@ -277,7 +313,7 @@ void ASCLIN3_TxISR(void)
  *
  * \ingroup Asclin_msg
  */
-IFX_INTERRUPT(ASCLIN3_RxISR, VECTAB0, SRPN_CPU0_ASCLIN3_RX);
+IFX_INTERRUPT_STAT(ASCLIN3_RxISR, VECTAB0, SRPN_CPU0_ASCLIN3_RX);
 void ASCLIN3_RxISR(void)
 {
 	/* indicated to the software loop we have data waiting in the software receive buffer */
@@ -297,10 +333,12 @@ void ASCLIN3_RxISR(void)
  *
  * \ingroup Asclin_msg
  */
-IFX_INTERRUPT(ASCLIN3_ErrorISR, VECTAB0, SRPN_CPU0_ASCLIN3_ER);
+IFX_INTERRUPT_STAT(ASCLIN3_ErrorISR, VECTAB0, SRPN_CPU0_ASCLIN3_ER);
 void ASCLIN3_ErrorISR(void)
 {
 	ASCLIN3_errorCount++;
+	TRACE(trace_Event_uartError, 0, ASCLIN3_FLAGS.U);
+	LOG_ERROR(log_Module_asclin, "ASCLIN3 error %u, flags 0x%08X", ASCLIN3_errorCount, ASCLIN3_FLAGS.U);
 }
 
 
@@ -348,97 +386,264 @@ void ASCLIN3_SetData(uint8 *src, uint8 len)
 
 }
 
-void ASCLIN3_DMA_Init(uint16 trel)
+/** \brief Transmit a block of bytes using DMA channel 5.
+ *
+ * The data is copied into the transmit buffer so the caller's buffer may be
+ * reused immediately. Blocks larger than the transmit buffer are sent in
+ * several DMA transfers. The function waits for a previous transfer to
+ * complete, so global interrupts must be enabled.
+ *
+ * \param src pointer to the data to send
+ * \param len number of bytes to send
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_Write(const uint8 *src, uint16 len)
 {
-    /* DMA Channel 005 used for Transmit */
-    DMA_SADR005.U = (uint32)&txData[0];
-    DMA_DADR005.U = (uint32)&ASCLIN3_TXDATA.U;
-
-    Ifx_DMA_CH_CHCFGR chcfgr_5 = {
-        .B.TREL = trel,    /*Transfer Reload Value */
-        .B.BLKM = dma_chcfgrxxx_blkm_OneTransferHasOneMove,
-        .B.RROAT = dma_chcfgrxxx_rroat_ResetAfterEachTransfer,
-        .B.CHMODE = dma_chcfgrxxx_chmode_SingleMode,
-        .B.CHDW = dma_chcfgrxxx_chdw_DataBitWidth_8,
-        .B.PATSEL = dma_chcfgrxxx_patsel_NoPatternCompareOperation,
-        .B.PRSEL = dma_chcfgrxxx_prsel_HardwareRequestSelected,
-        .B.DMAPRIO = dma_chcfgrxxx_dmaprio_LowPrioritySelected,
-    };
-    DMA_CHCFGR005.U = chcfgr_5.U;
-
-Ifx_DMA_CH_ADICR adicr_5 = {
-        .B.SMF = dma_adicrxxx_smf_AddressOffsetIsCHDWx1,
-        .B.INCS = dma_adicrxxx_incs_AddressOffsetIsAdded,
-        .B.DMF = dma_adicrxxx_dmf_AddressOffsetIsCHDWx1,
-        .B.INCD = dma_adicrxxx_incd_AddressOffsetIsSubtracted,
-        .B.CBLS = dma_adicrxxx_cbls_SourceAddress31to0,
-        .B.CBLD = dma_adicrxxx_cbld_DestinationAddress31to0,
-        .B.SHCT = dma_adicrxxx_shct_MoveOperation,
-        .B.SCBE = dma_adicrxxx_scbe_SourceCircularBufferDisabled,
-        .B.DCBE = dma_adicrxxx_dcbe_DestinationCircularBufferEnabled,
-        .B.STAMP = dma_adicrxxx_stamp_NoAction,
-        .B.ETRL = dma_adicrxxx_etrl_NoInterruptOnLostEvent,
-        .B.WRPSE = dma_adicrxxx_wrpse_WrapSourceBufferInterruptTriggerDiabled,
-        .B.WRPDE = dma_adicrxxx_wrpde_WrapDestinationBufferInterruptTriggerDiabled,
-        .B.INTCT = dma_adicrxxx_intct_InterruptChangingTCOUNTandEqualsIRDV,
-        .B.IRDV = 0,  /*Interrupt Raise Detect Value*/
-    };
-    DMA_ADICR005.U = adicr_5.U;
-    DMA_TSR005.B.ECH = 1;
-
-/* DMA Channel 006: used for Receive */
-    DMA_SADR006.U = (uint32)&ASCLIN3_RXDATA.U;
-    DMA_DADR006.U = (uint32)&rxData[0];
-
-    Ifx_DMA_CH_CHCFGR chcfgr_6 = {
-        .B.TREL = trel, /*Transfer Reload Value */
-        .B.BLKM = dma_chcfgrxxx_blkm_OneTransferHasOneMove,
-        .B.RROAT = dma_chcfgrxxx_rroat_ResetAfterEachTransfer,
-        .B.CHMODE = dma_chcfgrxxx_chmode_SingleMode,
-        .B.CHDW = dma_chcfgrxxx_chdw_DataBitWidth_8,
-        .B.PATSEL = dma_chcfgrxxx_patsel_NoPatternCompareOperation,
-        .B.PRSEL = dma_chcfgrxxx_prsel_HardwareRequestSelected,
-        .B.DMAPRIO = dma_chcfgrxxx_dmaprio_LowPrioritySelected,
-    };
-    DMA_CHCFGR006.U = chcfgr_6.U;
-
-Ifx_DMA_CH_ADICR adicr_6 = {
-        .B.SMF = dma_adicrxxx_smf_AddressOffsetIsCHDWx1,
-        .B.INCS = dma_adicrxxx_incs_AddressOffsetIsSubtracted,
-        .B.DMF = dma_adicrxxx_dmf_AddressOffsetIsCHDWx1,
-        .B.INCD = dma_adicrxxx_incd_AddressOffsetIsAdded,
-        .B.CBLS = dma_adicrxxx_cbls_SourceAddress31to0,
-        .B.CBLD = dma_adicrxxx_cbld_DestinationAddress31to0,
-        .B.SHCT = dma_adicrxxx_shct_MoveOperation,
-        .B.SCBE = dma_adicrxxx_scbe_SourceCircularBufferEnabled,
-        .B.DCBE = dma_adicrxxx_dcbe_DestinationCircularBufferDisabled,
-        .B.STAMP = dma_adicrxxx_stamp_NoAction,
-        .B.ETRL = dma_adicrxxx_etrl_NoInterruptOnLostEvent,
-        .B.WRPSE = dma_adicrxxx_wrpse_WrapSourceBufferInterruptTriggerDiabled,
-        .B.WRPDE = dma_adicrxxx_wrpde_WrapDestinationBufferInterruptTriggerDiabled,
-        .B.INTCT =dma_adicrxxx_intct_InterruptChangingTCOUNTandEqualsIRDV,
-        .B.IRDV = 0,  /*Interrupt Raise Detect Value*/
+    while (len > 0)
+    {
+        uint16 chunk = (len > ASCLIN3_TXBUF_SIZE) ? ASCLIN3_TXBUF_SIZE : len;
+
+        /* wait for the previous DMA transfer to complete */
+        while (ASCLIN3_txDmaBusy != FALSE)
+            ;
+
+        for (uint16 i = 0; i < chunk; i++)
+            txData[i] = src[i];
+
+        ASCLIN3_txDmaBusy = TRUE;
+        ASCLIN3_txPending = TRUE;
+
+        /* reload the source address and the transfer count of channel 5 */
+        DMA_SADR005.U = (uint32)&txData[0];
+        DMACFG_SetCount(ASCLIN3_DMA_TX_CH, &ASCLIN3_txDmaConfig, chunk);
+        DMAALLOC_Start(dmaalloc_User_asclin3Tx, chunk);
+
+        /* start the transfer using the transmit FIFO level flag */
+        ASCLIN3_FLAGSSET.U = (uint32)IFX_ASCLIN_FLAGSSET_TFLS_MSK << IFX_ASCLIN_FLAGSSET_TFLS_OFF;
+
+        src += chunk;
+        len -= chunk;
+    }
+}
+
+/** \brief Check if a DMA transmit transfer is still in progress.
+ *
+ * \param None
+ * \return TRUE while DMA channel 5 has not completed the last transfer
+ *
+ *  \ingroup Asclin_msg
+ */
+boolean ASCLIN3_IsTxBusy(void)
+{
+    return (boolean)(ASCLIN3_txDmaBusy != FALSE);
+}
+
+/** \brief Read the driver counters.
+ *
+ * \param counters filled with the current values
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_GetCounters(ASCLIN3_Counters *counters)
+{
+    counters->errorCount     = ASCLIN3_errorCount;
+    counters->txDmaCount     = ASCLIN3_txDmaCnt;
+    counters->rxDmaCount     = ASCLIN3_rxDmaCnt;
+    counters->rxReceiveCount = ASCLIN3_rxReceiveCount;
+}
+
+/** \brief Fetch the block received by the receive DMA channel.
+ * Channel 6 moves a fixed number of bytes (its TREL) into rxData and stops.
+ * Once it has completed, the block is copied and the channel is armed for
+ * the next block.
+ *
+ * \param dst receives the block
+ * \param max size of dst
+ * \return number of bytes copied, 0 if no new block has been received
+ *
+ *  \ingroup Asclin_msg
+ */
+uint16 ASCLIN3_ReadBlock(uint8 *dst, uint16 max)
+{
+    uint16 len = 0;
+
+    if (ASCLIN3_rxDmaCnt != ASCLIN3_rxDmaRead)
+    {
+        ASCLIN3_rxDmaRead = ASCLIN3_rxDmaCnt;
+        len = (ASCLIN3_rxTrel < max) ? ASCLIN3_rxTrel : max;
+        for (uint16 i = 0; i < len; i++)
+            dst[i] = rxData[i];
+
+        /* restart at the beginning of the buffer */
+        DMA_DADR006.U = (uint32)&rxData[0];
+        DMAALLOC_Start(dmaalloc_User_asclin3Rx, ASCLIN3_rxTrel);
+    }
+
+    return len;
+}
+
+/** \brief Change the baud rate.
+ * Waits until the transmitter is idle, the receiver is not synchronised.
+ *
+ * \param baudrate new baud rate in bit/s
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_SetBaudrate(uint32 baudrate)
+{
+    ASCLIN3_Flush();
+    ASCLIN3_baudrate = baudrate;
+    ASCLIN3_UpdateBaudrate();
+}
+
+/** \brief Reprogram the baud rate generator for the current fASCLINF.
+ * Must be called after every change of the PLL or of CCUCON1.ASCLINFDIV.
+ * The transmitter must be idle, call ASCLIN3_Flush before the clock change.
+ * Does nothing before ASCLIN3_Init.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_UpdateBaudrate(void)
+{
+    if (ASCLIN3_CSR.B.CLKSEL == asclin_csr_ClockSource_noClock)
+    {
+        /* not initialised, ASCLIN3_Init calculates the divider */
+        return;
+    }
+
+    /* BRG may only be written while the baud rate logic has no clock */
+    ASCLIN3_CSR.B.CLKSEL = asclin_csr_ClockSource_noClock;
+    while (ASCLIN3_CSR.B.CON != asclin_csr_ClockIsOff)
+        ;
+
+    ASCLIN3_WriteBrg();
+
+    ASCLIN3_CSR.B.CLKSEL = asclin_csr_ClockSource_fASCLINF;
+    while (ASCLIN3_CSR.B.CON != asclin_csr_ClockIsOn)
+        ;
+}
+
+/** \brief Calculate the fractional divider for ASCLIN3_baudrate.
+ * The largest numerator which keeps the denominator in range gives the best
+ * resolution: baud = fASCLINF * NUMERATOR / DENOMINATOR / oversampling.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+static void ASCLIN3_WriteBrg(void)
+{
+    float32 fAsclin = IfxScuCcu_getSourceFrequency();
+    float32 fBit    = (float32)ASCLIN3_baudrate * ASCLIN3_OVERSAMPLING;
+    uint32  numerator;
+    uint32  denominator;
+
+    if (SCU_CCUCON1.B.ASCLINFDIV > 1)
+    {
+        fAsclin = fAsclin / SCU_CCUCON1.B.ASCLINFDIV;
+    }
+
+    numerator = (uint32)((ASCLIN3_BRG_MAX * fBit) / fAsclin);
+    if (numerator == 0)
+    {
+        numerator = 1;
+    }
+    else if (numerator > ASCLIN3_BRG_MAX)
+    {
+        numerator = ASCLIN3_BRG_MAX;
+    }
+
+    denominator = (uint32)(((numerator * fAsclin) / fBit) + 0.5F);
+    if (denominator > ASCLIN3_BRG_MAX)
+    {
+        denominator = ASCLIN3_BRG_MAX;
+    }
+
+    Ifx_ASCLIN_BRG brg = {
+      .B.NUMERATOR = numerator,
+      .B.DENOMINATOR = denominator,
     };
-    DMA_ADICR006.U = adicr_6.U;
-    DMA_TSR006.B.ECH = 1;
+    ASCLIN3_BRG.U = brg.U;
+}
+
+/** \brief Wait until the last byte written has left the shift register.
+ * Returns immediately if nothing was sent since the last call.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_Flush(void)
+{
+    if (ASCLIN3_txPending != FALSE)
+    {
+        while (ASCLIN3_txDmaBusy != FALSE)
+            ;
+        while (ASCLIN3_TXFIFOCON.B.FILL != 0)
+            ;
+
+        /* the FIFO is empty, the last frame (10 bits) may still be shifted out */
+        uint32 frameTicks = (uint32)((IfxScuCcu_getStmFrequency() * 10.0F) / (float32)ASCLIN3_baudrate) + 1;
+        uint32 start      = STM0_TIM0.U;
+        while ((uint32)(STM0_TIM0.U - start) < frameTicks)
+            ;
+
+        ASCLIN3_txPending = FALSE;
+    }
+}
+
+/** \brief Load and enable the transmit and receive DMA channels.
+ * The channels are claimed from the DMA allocator first, on a conflict
+ * they are left alone.
+ *
+ * \param trel transfer count of both channels
+ * \return None
+ *
+ *  \ingroup Asclin_msg
+ */
+void ASCLIN3_DMA_Init(uint16 trel)
+{
+    /* the channels are fixed by the SRPNs of the ASCLIN3 service requests */
+    if ((DMAALLOC_Claim(dmaalloc_User_asclin3Tx) != ASCLIN3_DMA_TX_CH) ||
+        (DMAALLOC_Claim(dmaalloc_User_asclin3Rx) != ASCLIN3_DMA_RX_CH))
+    {
+        return;
+    }
+
+    ASCLIN3_rxTrel = trel;
+    DMACFG_Init(ASCLIN3_DMA_TX_CH, &ASCLIN3_txDmaConfig, (uint32)&txData[0], (uint32)&ASCLIN3_TXDATA.U, trel);
+    DMAALLOC_Start(dmaalloc_User_asclin3Tx, trel);
 
-/* Setup interrupt from DMA Channel 5 and 6 when the Move Transaction has finished */
-    SRC_DMACH5.U = TOS_CPU0 | SRE_ON | SRPN_CPU0_DMA_CH5;
-    SRC_DMACH6.U = TOS_CPU0 | SRE_ON | SRPN_CPU0_DMA_CH6;
+    DMACFG_Init(ASCLIN3_DMA_RX_CH, &ASCLIN3_rxDmaConfig, (uint32)&ASCLIN3_RXDATA.U, (uint32)&rxData[0], trel);
+    DMAALLOC_Start(dmaalloc_User_asclin3Rx, trel);
 }
 
 
-IFX_INTERRUPT(ASCLIN3_DMA_CH5, VECTAB0, SRPN_CPU0_DMA_CH5);
+IFX_INTERRUPT_STAT(ASCLIN3_DMA_CH5, VECTAB0, SRPN_CPU0_DMA_CH5);
 void ASCLIN3_DMA_CH5(void)
 {
   ASCLIN3_txDmaCnt++;
+  ASCLIN3_txDmaBusy = FALSE;
+  TRACE(trace_Event_dmaTxDone, 0, ASCLIN3_txDmaCnt);
+  LOG_VERBOSE(log_Module_dma, "DMA ch5 transmit %u done", ASCLIN3_txDmaCnt);
 }
 
 
-IFX_INTERRUPT(ASCLIN3_DMA_CH6, VECTAB0, SRPN_CPU0_DMA_CH6);
+IFX_INTERRUPT_STAT(ASCLIN3_DMA_CH6, VECTAB0, SRPN_CPU0_DMA_CH6);
 void ASCLIN3_DMA_CH6(void)
 {
   ASCLIN3_rxDmaCnt++;
+  TRACE(trace_Event_dmaRxDone, 0, ASCLIN3_rxDmaCnt);
+  LOG_DEBUG(log_Module_dma, "DMA ch6 receive %u done", ASCLIN3_rxDmaCnt);
 }
 
 /** \} */
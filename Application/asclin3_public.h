@@ -36,6 +36,16 @@
 #ifndef ASCLIN3_PUBLIC_H
 #define ASCLIN3_PUBLIC_H
 
+#include "Ifx_Types.h"
+
+/** \brief Driver counters, captured by the crash recorder */
+typedef struct
+{
+  uint16 errorCount;      /**< \brief error interrupts */
+  uint16 txDmaCount;      /**< \brief completed transmit DMA transfers */
+  uint16 rxDmaCount;      /**< \brief completed receive DMA transfers */
+  uint16 rxReceiveCount;  /**< \brief bytes received by interrupt */
+} ASCLIN3_Counters;
 
 /** \brief This function will initialize the ASCLIN peripheral in Asynchronous
  * mode.
@@ -47,5 +57,74 @@
  */
 extern void ASCLIN3_Init(void);
 
+/** \brief Transmit a block of bytes using the transmit DMA channel.
+ * Blocks until the previous transfer has completed.
+ *
+ * \param src pointer to the data to send
+ * \param len number of bytes to send
+ * \return None
+ *
+ *  \ingroup Asclin
+ */
+extern void ASCLIN3_Write(const uint8 *src, uint16 len);
+
+/** \brief Check if a DMA transmit transfer is still in progress.
+ *
+ * \param None
+ * \return TRUE while the last transfer has not completed
+ *
+ *  \ingroup Asclin
+ */
+extern boolean ASCLIN3_IsTxBusy(void);
+
+/** \brief Change the baud rate, the default is 115200 baud.
+ * Waits until the transmitter is idle.
+ *
+ * \param baudrate new baud rate in bit/s
+ * \return None
+ *
+ *  \ingroup Asclin
+ */
+extern void ASCLIN3_SetBaudrate(uint32 baudrate);
+
+/** \brief Wait until the last byte written has left the shift register.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Asclin
+ */
+extern void ASCLIN3_Flush(void);
+
+/** \brief Reprogram the baud rate generator after a clock change.
+ * The transmitter must be idle, call ASCLIN3_Flush before the clock change.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Asclin
+ */
+extern void ASCLIN3_UpdateBaudrate(void);
+
+/** \brief Fetch the block received by the receive DMA channel.
+ * The receiver works in fixed size blocks, see ASCLIN3_DMA_Init.
+ *
+ * \param dst receives the block
+ * \param max size of dst
+ * \return number of bytes copied, 0 if no new block has been received
+ *
+ *  \ingroup Asclin
+ */
+extern uint16 ASCLIN3_ReadBlock(uint8 *dst, uint16 max);
+
+/** \brief Read the driver counters.
+ *
+ * \param counters filled with the current values
+ * \return None
+ *
+ *  \ingroup Asclin
+ */
+extern void ASCLIN3_GetCounters(ASCLIN3_Counters *counters);
+
 #endif	/* end of file */
 
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * \file bootinit.c
+ * \brief parallel initialisation table of the project
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+
+#include "asclin3_public.h"
+#include "bootprof_public.h"
+#include "isrstat_public.h"
+#include "crashdump_public.h"
+#include "dmacopy_public.h"
+#include "multicore_public.h"
+#include "pllramp_public.h"
+#include "report_public.h"
+#include "bootinit_public.h"
+
+/* private functions */
+static void BOOTINIT_Uart(void);
+static void BOOTINIT_PllRamp(void);
+static void BOOTINIT_DmaCopy(void);
+static void BOOTINIT_CrashDump(void);
+
+/** \addtogroup BootInit_Variables */
+/* private data */
+/** \brief Initialisation jobs, distributed over the cores.
+ * Jobs of the same stage must not depend on each other.
+ */
+static const MULTICORE_InitJob BOOTINIT_jobs[] =
+{
+  /* function,         name,        core, stage */
+  {BOOTINIT_Uart,      "asclin3",   1,    0},
+  {BOOTINIT_PllRamp,   "pllramp",   0,    1},
+  {BOOTINIT_DmaCopy,   "dmacopy",   0,    0},
+  {BOOTINIT_CrashDump, "crashdump", 0,    1},
+};
+
+#define BOOTINIT_NUM_JOBS   (sizeof(BOOTINIT_jobs) / sizeof(BOOTINIT_jobs[0]))
+#define BOOTINIT_NUM_STAGES 2u  /**< \brief highest stage of BOOTINIT_jobs + 1 */
+
+static uint32 BOOTINIT_durations[BOOTINIT_NUM_JOBS];
+static uint32 BOOTINIT_starts[BOOTINIT_NUM_JOBS];
+
+/** \brief Initialise ASCLIN3 and its DMA channels.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+static void BOOTINIT_Uart(void)
+{
+  ASCLIN3_Init();
+  BOOTPROF_Mark(bootprof_Phase_linkUp);
+}
+
+/** \brief Finish the PLL ramp, ASCLIN3 is up and follows the clock.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+static void BOOTINIT_PllRamp(void)
+{
+  PLLRAMP_Complete();
+}
+
+/** \brief Claim the channels of the memory copy engines.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+static void BOOTINIT_DmaCopy(void)
+{
+  DMACOPY_Init();
+}
+
+/** \brief Select the application reset, the crash records survive the restart after a trap.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+static void BOOTINIT_CrashDump(void)
+{
+  CRASHDUMP_Init();
+}
+
+/* global functions */
+
+/** \brief Run the initialisation jobs of the calling core.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+void BOOTINIT_Run(void)
+{
+  /* clock counter of this core, time base of the interrupt statistics */
+  ISRSTAT_InitCore();
+  MULTICORE_RunInit(BOOTINIT_jobs, BOOTINIT_NUM_JOBS, BOOTINIT_starts, BOOTINIT_durations);
+}
+
+/** \brief Send the duration of each initialisation job and stage over the UART.
+ *
+ * \param None
+ * \return Nothing
+ *
+ *  \ingroup BootInit
+ */
+void BOOTINIT_Report(void)
+{
+  for (uint32 i = 0; i < BOOTINIT_NUM_JOBS; i++)
+  {
+    REPORT_String("INIT ");
+    REPORT_String(BOOTINIT_jobs[i].name);
+    REPORT_String(" core=");
+    REPORT_Dec32(BOOTINIT_jobs[i].core);
+    REPORT_String(" stage=");
+    REPORT_Dec32(BOOTINIT_jobs[i].stage);
+    REPORT_String(" ticks=");
+    REPORT_Dec32(BOOTINIT_durations[i]);
+    REPORT_NewLine();
+  }
+
+  /* the jobs of a stage overlap: span from the first start to the last end,
+   * saved is what running them one after the other would have cost more */
+  for (uint32 stage = 0; stage < BOOTINIT_NUM_STAGES; stage++)
+  {
+    boolean seen  = FALSE;
+    uint32  first = 0;
+    uint32  last  = 0;
+    uint32  sum   = 0;
+
+    for (uint32 i = 0; i < BOOTINIT_NUM_JOBS; i++)
+    {
+      uint32 end = BOOTINIT_starts[i] + BOOTINIT_durations[i];
+
+      if (BOOTINIT_jobs[i].stage != stage)
+      {
+        continue;
+      }
+
+      /* compare STM0 differences, the counter may wrap during the boot */
+      if ((seen == FALSE) || ((sint32)(BOOTINIT_starts[i] - first) < 0))
+      {
+        first = BOOTINIT_starts[i];
+      }
+      if ((seen == FALSE) || ((sint32)(end - last) > 0))
+      {
+        last = end;
+      }
+      sum += BOOTINIT_durations[i];
+      seen = TRUE;
+    }
+
+    REPORT_String("INIT stage=");
+    REPORT_Dec32(stage);
+    REPORT_String(" span=");
+    REPORT_Dec32(last - first);
+    REPORT_String(" jobticks=");
+    REPORT_Dec32(sum);
+    REPORT_String(" saved=");
+    REPORT_Dec32((sum > (last - first)) ? (sum - (last - first)) : 0u);
+    REPORT_NewLine();
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * \file bootprof.c
+ * \brief boot time profiling from _START to the first UART byte
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxScuCcu.h"
+#include "NoClearDef.h"
+
+#include "bootprof_public.h"
+#include "pllramp_public.h"
+#include "report_public.h"
+
+/** \addtogroup BootProf_Variables */
+/* The record is stamped before Ifx_C_Init runs, it must not be cleared by the
+ * startup code. */
+NOCLEAR_BEGIN(cpu0)
+BOOTPROF_Record BOOTPROF_record;
+NOCLEAR_END
+
+/* private data */
+static const char * const BOOTPROF_phaseName[bootprof_Phase_count] =
+{
+  "reset",
+  "cInitDone",
+  "ccuInitDone",
+  "cpu1Start",
+  "cpu2Start",
+  "core0Main",
+  "cpuSync",
+  "linkUp",
+  "rampDone",
+  "firstTx",
+};
+
+/* private functions */
+
+/** \brief Convert an STM interval into microseconds.
+ *
+ * \param ticks length of the interval
+ * \param stmFreq STM frequency in Hz during the interval
+ * \return microseconds
+ *
+ *  \ingroup BootProf
+ */
+static uint64 BOOTPROF_TicksToMicroseconds(uint32 ticks, uint32 stmFreq)
+{
+  return ((uint64)ticks * 1000000u) / stmFreq;
+}
+
+/** \brief Convert the STM time of a phase into microseconds since reset.
+ * The part before the clock initialisation is converted with the backup
+ * clock, the part until the end of the PLL ramp with the clock after
+ * IfxScuCcu_init and the rest with the final clock. The ramp steps run at
+ * intermediate frequencies, so these parts are approximations.
+ *
+ * \param phase phase to convert
+ * \return microseconds since _START
+ *
+ *  \ingroup BootProf
+ */
+static uint32 BOOTPROF_GetMicroseconds(bootprof_Phase phase)
+{
+  uint32 t0    = BOOTPROF_record.ticks[bootprof_Phase_reset];
+  uint32 dt    = BOOTPROF_record.ticks[phase] - t0;
+  uint32 dInit = BOOTPROF_record.ticks[bootprof_Phase_cInitDone] - t0;
+  uint32 dRamp = BOOTPROF_record.ticks[bootprof_Phase_rampDone] - t0;
+  uint64 us;
+
+  if ((phase <= bootprof_Phase_cInitDone) || (BOOTPROF_record.stmFreqRun == 0) || (dt <= dInit))
+  {
+    us = BOOTPROF_TicksToMicroseconds(dt, BOOTPROF_record.stmFreqBoot);
+  }
+  else
+  {
+    us = BOOTPROF_TicksToMicroseconds(dInit, BOOTPROF_record.stmFreqBoot);
+
+    if ((BOOTPROF_record.valid[bootprof_Phase_rampDone] == FALSE) || (BOOTPROF_record.stmFreqFinal == 0) ||
+        (dt <= dRamp))
+    {
+      us += BOOTPROF_TicksToMicroseconds(dt - dInit, BOOTPROF_record.stmFreqRun);
+    }
+    else
+    {
+      us += BOOTPROF_TicksToMicroseconds(dRamp - dInit, BOOTPROF_record.stmFreqRun);
+      us += BOOTPROF_TicksToMicroseconds(dt - dRamp, BOOTPROF_record.stmFreqFinal);
+    }
+  }
+
+  return (uint32)us;
+}
+
+/* global functions */
+
+/** \brief Stamp a boot phase with the current STM0 time.
+ *
+ * \param phase phase which has been reached
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+void BOOTPROF_Mark(bootprof_Phase phase)
+{
+  BOOTPROF_record.ticks[phase] = STM0_TIM0.U;
+  BOOTPROF_record.valid[phase] = TRUE;
+
+  if (phase == bootprof_Phase_rampDone)
+  {
+    BOOTPROF_record.stmFreqFinal = (uint32)IfxScuCcu_getStmFrequency();
+  }
+}
+
+/** \brief Clock initialisation wrapper used as CCU init hook of the startup code.
+ * Locks the PLL with the ramp profile of Configurations/PllRampDef.h, the
+ * remaining steps are run by PLLRAMP_Complete once the UART is up.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+void BOOTPROF_CcuInitHook(void)
+{
+  /* the record survives resets, forget the phases of the previous boot */
+  for (uint32 i = bootprof_Phase_cInitDone; i < bootprof_Phase_count; i++)
+  {
+    BOOTPROF_record.valid[i] = FALSE;
+  }
+  BOOTPROF_Mark(bootprof_Phase_cInitDone);
+  BOOTPROF_record.stmFreqBoot = (uint32)IfxScuCcu_getStmFrequency();
+  BOOTPROF_record.stmFreqRun = 0;
+  BOOTPROF_record.stmFreqFinal = 0;
+
+  (void)PLLRAMP_Start(&PLLRAMP_defaultProfile);   /*The status returned by Ccu init is ignored */
+
+  BOOTPROF_record.stmFreqRun = (uint32)IfxScuCcu_getStmFrequency();
+  BOOTPROF_Mark(bootprof_Phase_ccuInitDone);
+}
+
+/** \brief Send the boot record over the UART.
+ * One line per phase reached: name, raw STM0 ticks and microseconds since
+ * _START.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+void BOOTPROF_Report(void)
+{
+  BOOTPROF_Mark(bootprof_Phase_firstTx);
+
+  if ((BOOTPROF_record.magic != BOOTPROF_MAGIC) || (BOOTPROF_record.stmFreqBoot == 0))
+  {
+    return;
+  }
+
+  for (uint32 i = 0; i < bootprof_Phase_count; i++)
+  {
+    if (BOOTPROF_record.valid[i] != FALSE)
+    {
+      REPORT_String("BOOT ");
+      REPORT_String(BOOTPROF_phaseName[i]);
+      REPORT_String(" ticks=");
+      REPORT_Hex32(BOOTPROF_record.ticks[i]);
+      REPORT_String(" us=");
+      REPORT_Dec32(BOOTPROF_GetMicroseconds((bootprof_Phase)i));
+      REPORT_NewLine();
+    }
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * \file bootprof_public.h
+ * \brief boot time profiling from _START to the first UART byte
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef BOOTPROF_PUBLIC_H
+#define BOOTPROF_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxStm_reg.h"
+
+#define BOOTPROF_MAGIC ((uint32)0xB0075EEDu) /**< \brief marks a record written by this firmware */
+
+/** \brief Boot phases, each one is stamped with STM0 when it is reached.
+ * The phases of CPU1 and CPU2 are stamped by the cores themselves and are
+ * not necessarily in chronological order with the CPU0 phases.
+ */
+typedef enum
+{
+  bootprof_Phase_reset = 0,    /**< \brief _START, CPU0 before the C initialisation */
+  bootprof_Phase_cInitDone,    /**< \brief Ifx_C_Init has finished */
+  bootprof_Phase_ccuInitDone,  /**< \brief IfxScuCcu_init has finished, PLL is locked */
+  bootprof_Phase_cpu1Start,    /**< \brief CPU1 entered its startup code */
+  bootprof_Phase_cpu2Start,    /**< \brief CPU2 entered its startup code */
+  bootprof_Phase_core0Main,    /**< \brief core0_main entered */
+  bootprof_Phase_cpuSync,      /**< \brief all cores finished the parallel initialisation */
+  bootprof_Phase_linkUp,       /**< \brief ASCLIN3 and its DMA channels are initialised */
+  bootprof_Phase_rampDone,     /**< \brief PLL ramp finished, target frequency reached */
+  bootprof_Phase_firstTx,      /**< \brief first byte handed to the UART */
+  bootprof_Phase_count
+} bootprof_Phase;
+
+/** \brief Boot record, kept in RAM which is not cleared by the startup code.
+ * The STM runs from the backup clock until the PLL is locked and at the
+ * target frequency once the PLL ramp has finished, so the STM frequency is
+ * captured before and after the clock initialisation and after the ramp.
+ */
+typedef struct
+{
+  uint32 magic;                          /**< \brief BOOTPROF_MAGIC once the record was written */
+  uint32 stmFreqBoot;                    /**< \brief fSTM in Hz before the clock initialisation */
+  uint32 stmFreqRun;                     /**< \brief fSTM in Hz after the clock initialisation */
+  uint32 stmFreqFinal;                   /**< \brief fSTM in Hz after the PLL ramp */
+  uint32 ticks[bootprof_Phase_count];    /**< \brief STM0 TIM0 value per phase */
+  uint8  valid[bootprof_Phase_count];    /**< \brief phase was reached during this boot */
+} BOOTPROF_Record;
+
+extern BOOTPROF_Record BOOTPROF_record;
+
+/** \brief Stamp the start of a core, used as pre C initialisation hook.
+ * The stack and the C runtime are not available yet, so this must not call
+ * any function. CPU0 starts a new record.
+ *
+ * \param cpu index of the core executing the startup code
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+IFX_INLINE void BOOTPROF_MarkCoreStart(uint32 cpu)
+{
+  uint32 now = STM0_TIM0.U;
+
+  if (cpu == 0)
+  {
+    BOOTPROF_record.magic = BOOTPROF_MAGIC;
+    BOOTPROF_record.ticks[bootprof_Phase_reset] = now;
+    BOOTPROF_record.valid[bootprof_Phase_reset] = TRUE;
+  }
+  else if (cpu == 1)
+  {
+    BOOTPROF_record.ticks[bootprof_Phase_cpu1Start] = now;
+    BOOTPROF_record.valid[bootprof_Phase_cpu1Start] = TRUE;
+  }
+  else
+  {
+    BOOTPROF_record.ticks[bootprof_Phase_cpu2Start] = now;
+    BOOTPROF_record.valid[bootprof_Phase_cpu2Start] = TRUE;
+  }
+}
+
+/** \brief Stamp a boot phase with the current STM0 time.
+ * bootprof_Phase_rampDone also captures the final STM frequency.
+ *
+ * \param phase phase which has been reached
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+extern void BOOTPROF_Mark(bootprof_Phase phase);
+
+/** \brief Clock initialisation wrapper used as CCU init hook of the startup code.
+ * Stamps the end of the C initialisation and the end of the clock
+ * initialisation and captures the STM frequency on both sides.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+extern void BOOTPROF_CcuInitHook(void);
+
+/** \brief Send the boot record over the UART.
+ * Stamps bootprof_Phase_firstTx before the first byte is sent. Global
+ * interrupts must be enabled.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup BootProf
+ */
+extern void BOOTPROF_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,377 @@
+/*******************************************************************************
+ * \file cpuload.c
+ * \brief CPU load meter calibrated from the idle loop
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "Ifx_reg.h"
+#include "IfxStm_bf.h"
+
+#include "IntPrioDef.h"
+#include "dvfs_public.h"
+#include "isrstat_public.h"
+#include "report_public.h"
+#include "cpuload_public.h"
+
+#define CPULOAD_PER_MILLE          1000u
+#define CPULOAD_NO_PASS            0xFFFFFFFFu  /**< \brief cyclesPerPass before the first complete pass */
+
+/** \brief Load meter state of one core */
+typedef struct
+{
+  volatile uint32 passes;                     /**< \brief idle passes, incremented by CPULOAD_Idle */
+  volatile uint32 cyclesPerPass;              /**< \brief shortest idle loop pass without handlers */
+  boolean         passStarted;                /**< \brief passStart and passBusy are valid */
+  uint32          passStart;                  /**< \brief clock counter at the last CPULOAD_Idle */
+  uint32          passBusy;                   /**< \brief handler cycles at the last CPULOAD_Idle */
+  boolean         primed;                     /**< \brief the last* values are valid */
+  uint32          lastCycles;                 /**< \brief clock counter at the last window */
+  uint32          lastPasses;                 /**< \brief passes at the last window */
+  uint32          lastBusy;                   /**< \brief handler cycles at the last window */
+  uint32          compare;                    /**< \brief STM time written to CMP1 */
+  uint32          history[CPULOAD_HISTORY];   /**< \brief load of the last windows */
+  CPULOAD_Stats   stats;
+} CPULOAD_Core;
+
+/** \addtogroup CpuLoad_Variables */
+/* private data */
+/* Written by the idle loop and the window handler of the owning core */
+static CPULOAD_Core CPULOAD_cores[IFXCPU_NUM_MODULES] =
+{
+  {0, CPULOAD_NO_PASS},
+  {0, CPULOAD_NO_PASS},
+  {0, CPULOAD_NO_PASS},
+};
+
+/* STMn compare 1 closes the windows of CPUn */
+static Ifx_STM * const CPULOAD_stm[IFXCPU_NUM_MODULES] =
+{
+  &MODULE_STM0,
+  &MODULE_STM1,
+  &MODULE_STM2,
+};
+
+static volatile Ifx_SRC_SRCR * const CPULOAD_src[IFXCPU_NUM_MODULES] =
+{
+  &SRC_STM0SR1,
+  &SRC_STM1SR1,
+  &SRC_STM2SR1,
+};
+
+static const uint32 CPULOAD_srcConfig[IFXCPU_NUM_MODULES] =
+{
+  TOS_CPU0 | SRE_ON | SRPN_CPU0_STM0_SR1,
+  TOS_CPU1 | SRE_ON | SRPN_CPU1_STM1_SR1,
+  TOS_CPU2 | SRE_ON | SRPN_CPU2_STM2_SR1,
+};
+
+static uint32          CPULOAD_windowMs = CPULOAD_DEFAULT_WINDOW_MS;
+static volatile uint32 CPULOAD_period;
+
+/* private functions */
+void CPULOAD_Cpu0ISR(void);
+void CPULOAD_Cpu1ISR(void);
+void CPULOAD_Cpu2ISR(void);
+
+/** \brief Close the window of a core and rearm the compare.
+ * The idle passes are converted into idle cycles with the shortest pass
+ * measured so far, everything else in the window is load. Counting in
+ * clock cycles keeps the result valid across frequency changes.
+ *
+ * \param cpu core of the window, the calling core
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+static void CPULOAD_Window(uint32 cpu)
+{
+  CPULOAD_Core *core   = &CPULOAD_cores[cpu];
+  Ifx_STM      *stm    = CPULOAD_stm[cpu];
+  uint32        now    = IfxCpu_getClockCounter();
+  uint32        passes = core->passes;
+  uint32        busy   = ISRSTAT_GetBusyCycles();
+  uint32        tim0   = stm->TIM0.U;
+
+  /* relative to the last compare to keep the window length, unless it was missed */
+  core->compare += CPULOAD_period;
+  if ((sint32)(core->compare - tim0) <= 0)
+  {
+    core->compare = tim0 + CPULOAD_period;
+  }
+  stm->CMP[1].U = core->compare;
+  stm->ISCR.U   = (uint32)IFX_STM_ISCR_CMP1IRR_MSK << IFX_STM_ISCR_CMP1IRR_OFF;
+
+  if (core->primed != FALSE)
+  {
+    CPULOAD_Stats *stats  = &core->stats;
+    uint32         cycles = (now - core->lastCycles) & ISRSTAT_CCNT_MASK;
+    uint32         perPass = (core->cyclesPerPass != CPULOAD_NO_PASS) ? core->cyclesPerPass : 0u;
+    uint64         idle   = (uint64)(passes - core->lastPasses) * perPass;
+    uint64         irq    = (uint64)(busy - core->lastBusy);
+    uint32         sum    = 0;
+
+    if (cycles != 0)
+    {
+      stats->load     = (idle >= cycles) ? 0 : (uint32)(((cycles - idle) * CPULOAD_PER_MILLE) / cycles);
+      stats->irqShare = (irq >= cycles) ? CPULOAD_PER_MILLE : (uint32)((irq * CPULOAD_PER_MILLE) / cycles);
+    }
+
+    core->history[stats->windows % CPULOAD_HISTORY] = stats->load;
+    stats->windows++;
+    for (uint32 i = 0; (i < CPULOAD_HISTORY) && (i < stats->windows); i++)
+    {
+      sum += core->history[i];
+    }
+    stats->rolling = sum / ((stats->windows < CPULOAD_HISTORY) ? stats->windows : CPULOAD_HISTORY);
+
+    if (stats->load > stats->peak)
+    {
+      stats->peak = stats->load;
+    }
+  }
+
+  core->primed     = TRUE;
+  core->lastCycles = now;
+  core->lastPasses = passes;
+  core->lastBusy   = busy;
+}
+
+/** \brief Send a per mille value as percent with one decimal.
+ *
+ * \param perMille value in per mille
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+static void CPULOAD_ReportPercent(uint32 perMille)
+{
+  REPORT_Dec32(perMille / 10u);
+  REPORT_String(".");
+  REPORT_Dec32(perMille % 10u);
+  REPORT_String("%");
+}
+
+/** \addtogroup CpuLoad_InterruptFunctions
+ * \{ */
+
+/** \brief STM0 compare 1 interrupt, window of CPU0.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup CpuLoad
+ */
+IFX_INTERRUPT_STAT(CPULOAD_Cpu0ISR, VECTAB0, SRPN_CPU0_STM0_SR1);
+void CPULOAD_Cpu0ISR(void)
+{
+  CPULOAD_Window(0);
+}
+
+/** \brief STM1 compare 1 interrupt, window of CPU1.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup CpuLoad
+ */
+IFX_INTERRUPT_STAT(CPULOAD_Cpu1ISR, VECTAB0, SRPN_CPU1_STM1_SR1);
+void CPULOAD_Cpu1ISR(void)
+{
+  CPULOAD_Window(1);
+}
+
+/** \brief STM2 compare 1 interrupt, window of CPU2.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup CpuLoad
+ */
+IFX_INTERRUPT_STAT(CPULOAD_Cpu2ISR, VECTAB0, SRPN_CPU2_STM2_SR1);
+void CPULOAD_Cpu2ISR(void)
+{
+  CPULOAD_Window(2);
+}
+
+/** \} */
+
+/* global functions */
+
+/** \brief End of an idle loop pass, counts the pass on the calling core.
+ * The pass is timed from the previous call with the clock counter, less
+ * the cycles of the instrumented handlers in between. The shortest pass is
+ * one of the whole loop body with nothing to do, e.g. the scheduler loop of
+ * CPU0 with its UART polls and drains, and is taken as the cost of an idle
+ * pass. The clock counter must run (ISRSTAT_InitCore).
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+void CPULOAD_Idle(void)
+{
+  CPULOAD_Core *core = &CPULOAD_cores[IfxCpu_getCoreIndex()];
+  uint32        now  = IfxCpu_getClockCounter();
+  uint32        busy = ISRSTAT_GetBusyCycles();
+
+  if (core->passStarted != FALSE)
+  {
+    uint32 cycles   = (now - core->passStart) & ISRSTAT_CCNT_MASK;
+    uint32 handlers = busy - core->passBusy;
+
+    /* the handler wrappers are not in the handler cycles, such a pass is not taken */
+    if ((handlers < cycles) && ((cycles - handlers) < core->cyclesPerPass))
+    {
+      core->cyclesPerPass = cycles - handlers;
+    }
+  }
+
+  core->passStarted = TRUE;
+  core->passStart   = now;
+  core->passBusy    = busy;
+  core->passes++;
+}
+
+/** \brief Start the measurement windows on all cores.
+ * The first window of each core only primes the counters.
+ *
+ * \param windowMs window length in milliseconds
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+void CPULOAD_Start(uint32 windowMs)
+{
+  CPULOAD_windowMs = (windowMs != 0) ? windowMs : CPULOAD_DEFAULT_WINDOW_MS;
+  CPULOAD_UpdateRate();
+
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    CPULOAD_Core *core = &CPULOAD_cores[cpu];
+    Ifx_STM      *stm  = CPULOAD_stm[cpu];
+
+    CPULOAD_src[cpu]->U = CLRR;
+    stm->ICR.B.CMP1EN   = 0;
+
+    core->primed         = FALSE;
+    core->stats.load     = 0;
+    core->stats.rolling  = 0;
+    core->stats.peak     = 0;
+    core->stats.irqShare = 0;
+    core->stats.windows  = 0;
+
+    /* compare all 32 bits of TIM0, compare 1 raises STMIR1 */
+    stm->CMCON.B.MSIZE1  = 31;
+    stm->CMCON.B.MSTART1 = 0;
+    core->compare        = stm->TIM0.U + CPULOAD_period;
+    stm->CMP[1].U        = core->compare;
+    stm->ISCR.U          = (uint32)IFX_STM_ISCR_CMP1IRR_MSK << IFX_STM_ISCR_CMP1IRR_OFF;
+    stm->ICR.B.CMP1OS    = 1;
+    stm->ICR.B.CMP1EN    = 1;
+
+    CPULOAD_src[cpu]->U = CPULOAD_srcConfig[cpu];
+  }
+}
+
+/** \brief Recalculate the window length after a clock change.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+void CPULOAD_UpdateRate(void)
+{
+  CPULOAD_period = (uint32)(((uint64)DVFS_GetStmFrequency() * CPULOAD_windowMs) / 1000u);
+}
+
+/** \brief Copy the load of one core.
+ * The copy is atomic for the calling core only.
+ *
+ * \param cpu core
+ * \param stats receives the load
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+void CPULOAD_Get(uint32 cpu, CPULOAD_Stats *stats)
+{
+  boolean enabled = IfxCpu_disableInterrupts();
+
+  *stats = CPULOAD_cores[cpu].stats;
+
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Send the load of all cores over the UART.
+ * "LOAD cpu=<n> load=<%> avg=<%> peak=<%> irq=<%> windows=<n> cycles/pass=<n>"
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+void CPULOAD_Report(void)
+{
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    CPULOAD_Stats stats;
+
+    CPULOAD_Get(cpu, &stats);
+
+    REPORT_String("LOAD cpu=");
+    REPORT_Dec32(cpu);
+    REPORT_String(" load=");
+    CPULOAD_ReportPercent(stats.load);
+    REPORT_String(" avg=");
+    CPULOAD_ReportPercent(stats.rolling);
+    REPORT_String(" peak=");
+    CPULOAD_ReportPercent(stats.peak);
+    REPORT_String(" irq=");
+    CPULOAD_ReportPercent(stats.irqShare);
+    REPORT_String(" windows=");
+    REPORT_Dec32(stats.windows);
+    REPORT_String(" cycles/pass=");
+    REPORT_Dec32((CPULOAD_cores[cpu].cyclesPerPass != CPULOAD_NO_PASS) ? CPULOAD_cores[cpu].cyclesPerPass : 0u);
+    REPORT_NewLine();
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,103 @@
+/*******************************************************************************
+ * \file cpuload_public.h
+ * \brief CPU load meter calibrated from the idle loop
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef CPULOAD_PUBLIC_H
+#define CPULOAD_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define CPULOAD_DEFAULT_WINDOW_MS 100u  /**< \brief length of a measurement window */
+#define CPULOAD_HISTORY           8u    /**< \brief windows of the rolling load */
+
+/** \brief Load of one core, all values in per mille */
+typedef struct
+{
+  uint32 load;      /**< \brief last window */
+  uint32 rolling;   /**< \brief mean of the last CPULOAD_HISTORY windows */
+  uint32 peak;      /**< \brief highest window since CPULOAD_Start */
+  uint32 irqShare;  /**< \brief last window, share of the instrumented interrupt handlers */
+  uint32 windows;   /**< \brief windows since CPULOAD_Start */
+} CPULOAD_Stats;
+
+/** \brief End of an idle loop pass, counts the pass on the calling core.
+ * Call it once at the end of every pass of the idle loop, the shortest pass
+ * is taken as the cost of an idle one.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+extern void CPULOAD_Idle(void);
+
+/** \brief Start the measurement windows on all cores.
+ *
+ * \param windowMs window length in milliseconds
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+extern void CPULOAD_Start(uint32 windowMs);
+
+/** \brief Recalculate the window length after a clock change.
+ * Clock listener of the frequency scaling.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+extern void CPULOAD_UpdateRate(void);
+
+/** \brief Copy the load of one core.
+ *
+ * \param cpu core
+ * \param stats receives the load
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+extern void CPULOAD_Get(uint32 cpu, CPULOAD_Stats *stats);
+
+/** \brief Send the load of all cores over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CpuLoad
+ */
+extern void CPULOAD_Report(void);
+
+#endif	/* end of file */
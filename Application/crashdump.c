@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * \file crashdump.c
+ * \brief Crash recorder, trap snapshot replayed over the UART at the next boot
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "IfxScuWdt.h"
+#include "IfxStm_reg.h"
+#include "IfxScu_reg.h"
+#include "IfxScu_bf.h"
+#include "NoClearDef.h"
+
+#include "initseq_public.h"
+#include "report_public.h"
+#include "crashdump_public.h"
+
+#define CRASHDUMP_PCXI_LINK  ((uint32)0x000FFFFFu)  /**< \brief PCXS and PCXO, 0 ends the chain */
+#define CRASHDUMP_PCXI_UL    ((uint32)0x00100000u)  /**< \brief linked context is an upper context */
+#define CRASHDUMP_UPPER_A11  3u                     /**< \brief word of A11 in an upper context */
+
+/** \addtogroup CrashDump_Variables */
+/* Each core writes the record in its own DSPR: not cached and not shared
+ * with a core which might trap at the same time. */
+NOCLEAR_BEGIN(cpu0)
+CRASHDUMP_Record CRASHDUMP_record0;
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu1)
+CRASHDUMP_Record CRASHDUMP_record1;
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu2)
+CRASHDUMP_Record CRASHDUMP_record2;
+NOCLEAR_END
+
+CRASHDUMP_Record * const CRASHDUMP_records[IFXCPU_NUM_MODULES] =
+{
+  &CRASHDUMP_record0,
+  &CRASHDUMP_record1,
+  &CRASHDUMP_record2,
+};
+
+/* private data */
+static const char * const CRASHDUMP_className[8] =
+{
+  "MME", "IPE", "IE", "CME", "BE", "ASSERT", "SYS", "NMI",
+};
+
+/* The reset value of RSTCON.SW selects a system reset, which clears the records */
+static const INITSEQ_Step CRASHDUMP_resetSteps[] =
+{
+  INITSEQ_UNLOCK(initseq_Endinit_safety),
+  INITSEQ_MODIFY(SCU_RSTCON, INITSEQ_MASK(SCU, RSTCON, SW), INITSEQ_FIELD(SCU, RSTCON, SW, CRASHDUMP_RSTCON_SW_APP)),
+  INITSEQ_LOCK(initseq_Endinit_safety),
+};
+
+static INITSEQ_Stats CRASHDUMP_resetStats;
+
+static const INITSEQ_Script CRASHDUMP_resetScript = INITSEQ_SCRIPT("rstcon", CRASHDUMP_resetSteps, CRASHDUMP_resetStats);
+
+/* RSTCON.SW read back by CRASHDUMP_Init */
+static uint32 CRASHDUMP_resetType;
+
+/* private functions */
+
+/** \brief Check if a record has been written by CRASHDUMP_Capture.
+ * The RAM contains random values after power on.
+ *
+ * \param record crash record
+ * \return TRUE if the record is valid
+ *
+ *  \ingroup CrashDump
+ */
+static boolean CRASHDUMP_IsValid(const CRASHDUMP_Record *record)
+{
+  return (boolean)(((record->magic == CRASHDUMP_MAGIC_NEW) || (record->magic == CRASHDUMP_MAGIC_REPORTED)) &&
+                   (record->numCsa <= CRASHDUMP_CSA_DEPTH) && (record->checksum == CRASHDUMP_GetChecksumInline(record)));
+}
+
+/* global functions */
+
+/** \brief Select the application reset for the software reset of CRASHDUMP_Restart.
+ * RSTCON is written in a safety ENDINIT window and read back, a failure is
+ * shown by CRASHDUMP_Report.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+void CRASHDUMP_Init(void)
+{
+  (void)INITSEQ_Run(&CRASHDUMP_resetScript);
+  CRASHDUMP_resetType = SCU_RSTCON.B.SW;
+}
+
+/** \brief Snapshot a trap into the crash record of the executing core.
+ * The CSA chain starts with the upper context of this function, followed by
+ * the lower context saved by the trap vector (svlcx) and the upper context
+ * saved by the trap itself.
+ *
+ * \param trapClass trap class
+ * \param trapId trap identification number
+ * \param trapAddress address of the trapping instruction
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+void CRASHDUMP_Capture(uint32 trapClass, uint32 trapId, uint32 trapAddress)
+{
+  uint32            cpu    = IfxCpu_getCoreIndex();
+  CRASHDUMP_Record *record = CRASHDUMP_records[cpu];
+  uint32            pcxi   = (uint32)__mfcr(CPU_PCXI);
+  uint32            link   = pcxi;
+  boolean           lowerSeen = FALSE;
+  uint32            n;
+
+  record->count         = CRASHDUMP_IsValid(record) ? (record->count + 1u) : 1u;
+  record->stmTicks      = STM0_TIM0.U;
+  record->trapClass     = (uint8)trapClass;
+  record->trapId        = (uint8)trapId;
+  record->cpu           = (uint8)cpu;
+  record->trapAddress   = trapAddress;
+  record->returnAddress = 0;
+  record->pcxi          = 0;
+  record->pcxiCapture   = pcxi;
+  record->upperMask     = 0;
+  ASCLIN3_GetCounters(&record->asclin3);
+
+  for (n = 0; (n < CRASHDUMP_CSA_DEPTH) && ((link & CRASHDUMP_PCXI_LINK) != 0); n++)
+  {
+    const uint32 *csa   = (const uint32 *)__cx_to_addr(link & CRASHDUMP_PCXI_LINK);
+    boolean       upper = (boolean)((link & CRASHDUMP_PCXI_UL) != 0);
+
+    for (uint32 i = 0; i < CRASHDUMP_CSA_WORDS; i++)
+    {
+      record->csa[n][i] = csa[i];
+    }
+
+    if (upper != FALSE)
+    {
+      record->upperMask |= 1u << n;
+
+      /* first upper context after the lower context of the trap vector */
+      if ((lowerSeen != FALSE) && (record->pcxi == 0))
+      {
+        record->pcxi          = csa[0];
+        record->returnAddress = csa[CRASHDUMP_UPPER_A11];
+      }
+    }
+    else
+    {
+      lowerSeen = TRUE;
+    }
+
+    /* word 0 of a context is the PCXI of the next one */
+    link = csa[0];
+  }
+  record->numCsa = (uint8)n;
+
+  record->checksum = CRASHDUMP_GetChecksumInline(record);
+  record->magic    = CRASHDUMP_MAGIC_NEW;
+}
+
+/** \brief Restart the device with an application reset, which keeps the RAM.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+void CRASHDUMP_Restart(void)
+{
+  IfxScuWdt_clearCpuEndinit(IfxScuWdt_getCpuWatchdogPassword());
+  IfxCpu_triggerSwReset();
+}
+
+/** \brief Send the crash records not reported yet over the UART.
+ * Per record: one summary line, the driver counters and one line per
+ * saved context (u = upper, l = lower) with its 16 words.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+void CRASHDUMP_Report(void)
+{
+  if (CRASHDUMP_resetType != CRASHDUMP_RSTCON_SW_APP)
+  {
+    REPORT_String("CRASH rstcon sw=");
+    REPORT_Dec32(CRASHDUMP_resetType);
+    REPORT_String(", a restart clears the records");
+    REPORT_NewLine();
+  }
+
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    CRASHDUMP_Record *record = CRASHDUMP_records[cpu];
+
+    if ((CRASHDUMP_IsValid(record) == FALSE) || (record->magic != CRASHDUMP_MAGIC_NEW))
+    {
+      continue;
+    }
+
+    REPORT_String("CRASH cpu=");
+    REPORT_Dec32(record->cpu);
+    REPORT_String(" count=");
+    REPORT_Dec32(record->count);
+    REPORT_String(" class=");
+    REPORT_String(CRASHDUMP_className[record->trapClass & 7u]);
+    REPORT_String(" tin=");
+    REPORT_Dec32(record->trapId);
+    REPORT_String(" addr=");
+    REPORT_Hex32(record->trapAddress);
+    REPORT_String(" ret=");
+    REPORT_Hex32(record->returnAddress);
+    REPORT_String(" pcxi=");
+    REPORT_Hex32(record->pcxi);
+    REPORT_String(" stm=");
+    REPORT_Hex32(record->stmTicks);
+    REPORT_NewLine();
+
+    REPORT_String("CRASH asclin3 err=");
+    REPORT_Dec32(record->asclin3.errorCount);
+    REPORT_String(" txDma=");
+    REPORT_Dec32(record->asclin3.txDmaCount);
+    REPORT_String(" rxDma=");
+    REPORT_Dec32(record->asclin3.rxDmaCount);
+    REPORT_String(" rx=");
+    REPORT_Dec32(record->asclin3.rxReceiveCount);
+    REPORT_NewLine();
+
+    for (uint32 n = 0; n < record->numCsa; n++)
+    {
+      REPORT_String("CRASH csa");
+      REPORT_Dec32(n);
+      REPORT_String(((record->upperMask >> n) & 1u) ? " u" : " l");
+      for (uint32 i = 0; i < CRASHDUMP_CSA_WORDS; i++)
+      {
+        REPORT_String(" ");
+        REPORT_Hex32(record->csa[n][i]);
+      }
+      REPORT_NewLine();
+    }
+
+    /* keep the count, do not send the record again */
+    record->magic = CRASHDUMP_MAGIC_REPORTED;
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
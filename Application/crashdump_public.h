@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * \file crashdump_public.h
+ * \brief Crash recorder, trap snapshot replayed over the UART at the next boot
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef CRASHDUMP_PUBLIC_H
+#define CRASHDUMP_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxScuWdt.h"
+#include "IfxScu_bf.h"
+#include "asclin3_public.h"
+
+#define CRASHDUMP_MAGIC_NEW      ((uint32)0xC4A5D0E1u) /**< \brief record written, not yet reported */
+#define CRASHDUMP_MAGIC_REPORTED ((uint32)0xC4A5D0E2u) /**< \brief record has been sent over the UART */
+#define CRASHDUMP_CSA_DEPTH      6u                    /**< \brief contexts saved from the CSA chain */
+#define CRASHDUMP_CSA_WORDS      16u                   /**< \brief words of one context save area */
+#define CRASHDUMP_RSTCON_SW_APP  2u                    /**< \brief RSTCON.SW: software reset is an application reset */
+
+/** \brief Crash record, one per core in the DSPR of the core.
+ * Located in RAM which is not cleared by the startup code, it survives the
+ * application reset which follows the trap.
+ */
+typedef struct
+{
+  uint32           magic;           /**< \brief CRASHDUMP_MAGIC_NEW or CRASHDUMP_MAGIC_REPORTED */
+  uint32           count;           /**< \brief traps recorded since power on */
+  uint32           stmTicks;        /**< \brief STM0 TIM0 at the trap */
+  uint8            trapClass;       /**< \brief IfxCpu_Trap_Class */
+  uint8            trapId;          /**< \brief trap identification number (TIN) */
+  uint8            cpu;             /**< \brief core which trapped */
+  uint8            numCsa;          /**< \brief valid entries in csa[] */
+  uint32           trapAddress;     /**< \brief A11 of the trap handler, address of the trapping instruction */
+  uint32           returnAddress;   /**< \brief A11 of the trapped function, from the upper context saved by the trap */
+  uint32           pcxi;            /**< \brief PCXI of the trapped function, from the upper context saved by the trap */
+  uint32           pcxiCapture;     /**< \brief PCXI when the record was written, head of csa[] */
+  uint32           upperMask;       /**< \brief bit n set: csa[n] is an upper context */
+  ASCLIN3_Counters asclin3;         /**< \brief driver counters */
+  uint32           csa[CRASHDUMP_CSA_DEPTH][CRASHDUMP_CSA_WORDS];  /**< \brief CSA chain, newest first */
+  uint32           checksum;        /**< \brief sum of all words between magic and checksum */
+} CRASHDUMP_Record;
+
+/** \brief Crash records indexed by core */
+extern CRASHDUMP_Record * const CRASHDUMP_records[IFXCPU_NUM_MODULES];
+
+/** \brief Sum of the record words between magic and checksum.
+ *
+ * \param record crash record
+ * \return checksum
+ *
+ *  \ingroup CrashDump
+ */
+IFX_INLINE uint32 CRASHDUMP_GetChecksumInline(const CRASHDUMP_Record *record)
+{
+  const uint32 *word = &record->count;
+  const uint32 *end  = &record->checksum;
+  uint32        sum  = 0;
+
+  while (word < end)
+  {
+    sum += *word++;
+  }
+
+  return sum;
+}
+
+/** \brief Snapshot a context management trap into the crash record of the executing core.
+ * The free context list may be empty, so nothing is called: the CSA chain
+ * and the driver counters are not saved, numCsa is 0.
+ *
+ * \param trapClass trap class
+ * \param trapId trap identification number
+ * \param trapAddress address of the trapping instruction
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+IFX_INLINE void CRASHDUMP_CaptureInline(uint32 trapClass, uint32 trapId, uint32 trapAddress)
+{
+  uint32            cpu    = (uint32)IfxCpu_getCoreIndex();
+  CRASHDUMP_Record *record = CRASHDUMP_records[cpu];
+  boolean           valid;
+
+  valid = (boolean)(((record->magic == CRASHDUMP_MAGIC_NEW) || (record->magic == CRASHDUMP_MAGIC_REPORTED)) &&
+                    (record->numCsa <= CRASHDUMP_CSA_DEPTH) &&
+                    (record->checksum == CRASHDUMP_GetChecksumInline(record)));
+
+  record->count                  = (valid != FALSE) ? (record->count + 1u) : 1u;
+  record->stmTicks               = STM0_TIM0.U;
+  record->trapClass              = (uint8)trapClass;
+  record->trapId                 = (uint8)trapId;
+  record->cpu                    = (uint8)cpu;
+  record->numCsa                 = 0;
+  record->trapAddress            = trapAddress;
+  record->returnAddress          = 0;
+  record->pcxi                   = 0;
+  record->pcxiCapture            = (uint32)__mfcr(CPU_PCXI);
+  record->upperMask              = 0;
+  record->asclin3.errorCount     = 0;
+  record->asclin3.txDmaCount     = 0;
+  record->asclin3.rxDmaCount     = 0;
+  record->asclin3.rxReceiveCount = 0;
+
+  record->checksum = CRASHDUMP_GetChecksumInline(record);
+  record->magic    = CRASHDUMP_MAGIC_NEW;
+}
+
+/** \brief Restart the device with an application reset, without calling a function.
+ * For the context management traps, see CRASHDUMP_CaptureInline.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+IFX_INLINE void CRASHDUMP_RestartInline(void)
+{
+  Ifx_SCU_WDTCPU *watchdog = &MODULE_SCU.WDTCPU[IfxCpu_getCoreIndex()];
+
+  IfxScuWdt_clearCpuEndinitInline(watchdog, IfxScuWdt_getCpuWatchdogPasswordInline(watchdog));
+  MODULE_SCU.SWRSTCON.U = (uint32)IFX_SCU_SWRSTCON_SWRSTREQ_MSK << IFX_SCU_SWRSTCON_SWRSTREQ_OFF;
+
+  while (1)
+  {}
+}
+
+/** \brief Select the application reset for the software reset of CRASHDUMP_Restart.
+ * RSTCON is written in a safety ENDINIT window and read back, a failure is
+ * shown by CRASHDUMP_Report.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+extern void CRASHDUMP_Init(void);
+
+/** \brief Snapshot a trap into the crash record of the executing core.
+ * Called by the trap hooks of Ifx_Cfg_Trap.h.
+ *
+ * \param trapClass trap class
+ * \param trapId trap identification number
+ * \param trapAddress address of the trapping instruction
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+extern void CRASHDUMP_Capture(uint32 trapClass, uint32 trapId, uint32 trapAddress);
+
+/** \brief Restart the device with an application reset, which keeps the RAM.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+extern void CRASHDUMP_Restart(void);
+
+/** \brief Send the crash records not reported yet over the UART.
+ * Global interrupts must be enabled.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup CrashDump
+ */
+extern void CRASHDUMP_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * \file dmaalloc.c
+ * \brief DMA channel allocation and usage
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+#include "IfxCpu.h"
+#include "IfxDma.h"
+#include "IfxDma_bf.h"
+#include "IfxSrc_bf.h"
+
+#include "IntPrioDef.h"
+#include "DmaDef.h"
+#include "dmacfg_public.h"
+#include "log_public.h"
+#include "multicore_public.h"
+#include "report_public.h"
+#include "dmaalloc_public.h"
+
+#define DMAALLOC_NUM_PARTITIONS 4u  /**< \brief HRR.HRP is 2 bit wide */
+
+/** \brief Allocation of a user as given in DmaDef.h */
+typedef struct
+{
+  const char *name;       /**< \brief name in the report */
+  uint8       channel;    /**< \brief channel or DMAALLOC_ANY */
+  uint8       partition;  /**< \brief hardware resource partition */
+  uint8       srpn;       /**< \brief interrupt priority, 0 for none */
+  uint32      tos;        /**< \brief TOS bits of the interrupt node */
+} DMAALLOC_Config;
+
+/** \addtogroup DmaAlloc_Variables */
+/* private data */
+#define DMAALLOC_USER_CONFIG(name, channel, partition, tos, srpn) \
+  {#name, (uint8)(channel), (uint8)(partition), (uint8)(srpn), (uint32)(tos)},
+
+static const DMAALLOC_Config DMAALLOC_config[dmaalloc_User_count] =
+{
+  DMAALLOC_USERS(DMAALLOC_USER_CONFIG)
+};
+
+static DMAALLOC_Usage DMAALLOC_usage[dmaalloc_User_count];
+static IfxCpu_mutexLock DMAALLOC_lock;
+
+static const char *const DMAALLOC_stateNames[] =
+{
+  "free", "owned", "channel-taken", "irq-taken", "pool-empty", "invalid",
+};
+
+/* private functions */
+
+/** \brief User which owns a channel.
+ *
+ * \param channel channel
+ * \return user, dmaalloc_User_count if the channel is free
+ *
+ *  \ingroup DmaAlloc
+ */
+static uint32 DMAALLOC_GetOwner(uint32 channel)
+{
+  for (uint32 i = 0; i < dmaalloc_User_count; i++)
+  {
+    if ((DMAALLOC_usage[i].state == dmaalloc_State_owned) && (DMAALLOC_usage[i].channel == channel))
+    {
+      return i;
+    }
+  }
+  return dmaalloc_User_count;
+}
+
+/** \brief Find the channel of a user and check it against the other owners.
+ *
+ * \param user user
+ * \param channel receives the channel
+ * \return dmaalloc_State_owned if the channel can be handed out, the conflict otherwise
+ *
+ *  \ingroup DmaAlloc
+ */
+static dmaalloc_State DMAALLOC_Check(dmaalloc_User user, uint32 *channel)
+{
+  const DMAALLOC_Config *config = &DMAALLOC_config[user];
+
+  if (config->partition >= DMAALLOC_NUM_PARTITIONS)
+  {
+    return dmaalloc_State_invalid;
+  }
+
+  for (uint32 i = 0; i < dmaalloc_User_count; i++)
+  {
+    if ((config->srpn != 0) && (DMAALLOC_usage[i].state == dmaalloc_State_owned) &&
+        (DMAALLOC_config[i].srpn == config->srpn))
+    {
+      return dmaalloc_State_irqTaken;
+    }
+  }
+
+  if (config->channel != DMAALLOC_ANY)
+  {
+    *channel = config->channel;
+    if (*channel >= IFXDMA_NUM_CHANNELS)
+    {
+      return dmaalloc_State_invalid;
+    }
+    return (DMAALLOC_GetOwner(*channel) == dmaalloc_User_count) ? dmaalloc_State_owned : dmaalloc_State_channelTaken;
+  }
+
+  for (*channel = DMAALLOC_POOL_FIRST; *channel <= DMAALLOC_POOL_LAST; (*channel)++)
+  {
+    /* a fixed channel of a user which has not claimed it yet is not free either */
+    boolean reserved = FALSE;
+
+    for (uint32 i = 0; i < dmaalloc_User_count; i++)
+    {
+      reserved |= (boolean)(DMAALLOC_config[i].channel == *channel);
+    }
+    if ((reserved == FALSE) && (DMAALLOC_GetOwner(*channel) == dmaalloc_User_count))
+    {
+      return dmaalloc_State_owned;
+    }
+  }
+  return dmaalloc_State_poolEmpty;
+}
+
+/* global functions */
+
+/** \brief Hand out the channel of a user.
+ * The partition is written in a safety ENDINIT window of
+ * MULTICORE_OpenSafetyEndinit, the interrupt node is enabled if the user
+ * has an interrupt priority.
+ *
+ * \param user user
+ * \return channel, DMAALLOC_NONE on a conflict
+ *
+ *  \ingroup DmaAlloc
+ */
+uint32 DMAALLOC_Claim(dmaalloc_User user)
+{
+  const DMAALLOC_Config *config  = &DMAALLOC_config[user];
+  DMAALLOC_Usage        *usage   = &DMAALLOC_usage[user];
+  uint32                 channel = DMAALLOC_NONE;
+  dmaalloc_State         state;
+
+  while (IfxCpu_acquireMutex(&DMAALLOC_lock) == FALSE)
+    ;
+
+  if (usage->state == dmaalloc_State_owned)
+  {
+    channel = usage->channel;
+  }
+  else
+  {
+    state = DMAALLOC_Check(user, &channel);
+    usage->state = (uint8)state;
+    usage->core  = (uint8)IfxCpu_getCoreIndex();
+    if (state == dmaalloc_State_owned)
+    {
+      usage->channel = (uint8)channel;
+      /* HRP is the only field of HRR */
+      MULTICORE_OpenSafetyEndinit();
+      MODULE_DMA.HRR[channel].U = ((uint32)config->partition & IFX_DMA_HRR_HRP_MSK) << IFX_DMA_HRR_HRP_OFF;
+      MULTICORE_CloseSafetyEndinit();
+      MODULE_SRC.DMA.DMA[0].CH[channel].U = (config->srpn != 0) ? (config->tos | SRE_ON | config->srpn) : 0u;
+    }
+    else
+    {
+      channel = DMAALLOC_NONE;
+    }
+  }
+
+  IfxCpu_releaseMutex(&DMAALLOC_lock);
+
+  if (channel == DMAALLOC_NONE)
+  {
+    LOG_ERROR(log_Module_dma, "DMA user %u: %u", user, usage->state);
+  }
+  return channel;
+}
+
+/** \brief Give the channel of a user back.
+ *
+ * \param user user
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+void DMAALLOC_Release(dmaalloc_User user)
+{
+  DMAALLOC_Usage *usage = &DMAALLOC_usage[user];
+
+  while (IfxCpu_acquireMutex(&DMAALLOC_lock) == FALSE)
+    ;
+
+  if (usage->state == dmaalloc_State_owned)
+  {
+    MODULE_DMA.TSR[usage->channel].U = (uint32)IFX_DMA_TSR_DCH_MSK << IFX_DMA_TSR_DCH_OFF;
+    MODULE_SRC.DMA.DMA[0].CH[usage->channel].U = 0;
+  }
+  usage->state = dmaalloc_State_free;
+
+  IfxCpu_releaseMutex(&DMAALLOC_lock);
+}
+
+/** \brief Enable the loaded channel of a user and count the transaction.
+ *
+ * \param user user
+ * \param transfers transfer count the channel was loaded with
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+void DMAALLOC_Start(dmaalloc_User user, uint16 transfers)
+{
+  DMAALLOC_Usage *usage = &DMAALLOC_usage[user];
+
+  if (usage->state == dmaalloc_State_owned)
+  {
+    usage->starts++;
+    usage->transfers += transfers;
+    DMACFG_Enable(usage->channel);
+  }
+}
+
+/** \brief Request a transaction of the loaded channel of a user by software
+ * and count it.
+ *
+ * \param user user
+ * \param transfers transfer count the channel was loaded with
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+void DMAALLOC_Request(dmaalloc_User user, uint16 transfers)
+{
+  DMAALLOC_Usage *usage = &DMAALLOC_usage[user];
+
+  if (usage->state == dmaalloc_State_owned)
+  {
+    usage->starts++;
+    usage->transfers += transfers;
+    DMACFG_Request(usage->channel);
+  }
+}
+
+/** \brief Copy the ownership and usage of a user.
+ *
+ * \param user user
+ * \param usage receives the state
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+void DMAALLOC_GetUsage(dmaalloc_User user, DMAALLOC_Usage *usage)
+{
+  *usage = DMAALLOC_usage[user];
+}
+
+/** \brief Send the channel table over the UART, one line per user.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+void DMAALLOC_Report(void)
+{
+  for (uint32 i = 0; i < dmaalloc_User_count; i++)
+  {
+    const DMAALLOC_Config *config = &DMAALLOC_config[i];
+    const DMAALLOC_Usage  *usage  = &DMAALLOC_usage[i];
+
+    REPORT_String("DMA ");
+    REPORT_String(config->name);
+    REPORT_String(" state=");
+    REPORT_String(DMAALLOC_stateNames[usage->state]);
+    REPORT_String(" ch=");
+    REPORT_Dec32(usage->channel);
+    REPORT_String(" part=");
+    REPORT_Dec32(config->partition);
+    REPORT_String(" srpn=");
+    REPORT_Dec32(config->srpn);
+    REPORT_String(" tos=");
+    REPORT_Dec32((config->tos >> IFX_SRC_SRCR_TOS_OFF) & IFX_SRC_SRCR_TOS_MSK);
+    REPORT_String(" starts=");
+    REPORT_Dec32(usage->starts);
+    REPORT_String(" transfers=");
+    REPORT_Dec32(usage->transfers);
+    REPORT_NewLine();
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * \file dmaalloc_public.h
+ * \brief DMA channel allocation and usage
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef DMAALLOC_PUBLIC_H
+#define DMAALLOC_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#include "DmaDef.h"
+
+#define DMAALLOC_ANY  0xFFu         /**< \brief channel of a user which takes one from the pool */
+#define DMAALLOC_NONE 0xFFFFFFFFu   /**< \brief no channel, returned by DMAALLOC_Claim on a conflict */
+
+#define DMAALLOC_USER_ENUM(name, channel, partition, tos, srpn) dmaalloc_User_##name,
+
+/** \brief Users, see DMAALLOC_USERS in DmaDef.h */
+typedef enum
+{
+  DMAALLOC_USERS(DMAALLOC_USER_ENUM)
+  dmaalloc_User_count
+} dmaalloc_User;
+
+/** \brief State of a user */
+typedef enum
+{
+  dmaalloc_State_free = 0,      /**< \brief not claimed yet */
+  dmaalloc_State_owned,         /**< \brief channel handed out */
+  dmaalloc_State_channelTaken,  /**< \brief the channel belongs to another user */
+  dmaalloc_State_irqTaken,      /**< \brief the interrupt priority belongs to another user */
+  dmaalloc_State_poolEmpty,     /**< \brief no free channel left in the pool */
+  dmaalloc_State_invalid,       /**< \brief channel or partition out of range */
+} dmaalloc_State;
+
+/** \brief Ownership and usage of a user */
+typedef struct
+{
+  uint8  channel;    /**< \brief channel, valid in state owned */
+  uint8  state;      /**< \brief dmaalloc_State */
+  uint8  core;       /**< \brief core which claimed the channel */
+  uint32 starts;     /**< \brief transactions started with DMAALLOC_Start or DMAALLOC_Request */
+  uint32 transfers;  /**< \brief transfers of these transactions */
+} DMAALLOC_Usage;
+
+/** \brief Hand out the channel of a user.
+ * Sets the hardware resource partition of the channel and its interrupt
+ * node as given in DmaDef.h. A user which owns its channel already gets it
+ * again, so a driver can be initialised more than once.
+ *
+ * \param user user
+ * \return channel, DMAALLOC_NONE on a conflict, see DMAALLOC_GetUsage for the reason
+ *
+ *  \ingroup DmaAlloc
+ */
+extern uint32 DMAALLOC_Claim(dmaalloc_User user);
+
+/** \brief Give the channel of a user back.
+ * Disables the hardware requests and the interrupt node of the channel.
+ *
+ * \param user user
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+extern void DMAALLOC_Release(dmaalloc_User user);
+
+/** \brief Enable the loaded channel of a user and count the transaction.
+ *
+ * \param user user, must own its channel
+ * \param transfers transfer count the channel was loaded with
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+extern void DMAALLOC_Start(dmaalloc_User user, uint16 transfers);
+
+/** \brief Request a transaction of the loaded channel of a user by software
+ * and count it.
+ *
+ * \param user user, must own its channel
+ * \param transfers transfer count the channel was loaded with
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+extern void DMAALLOC_Request(dmaalloc_User user, uint16 transfers);
+
+/** \brief Copy the ownership and usage of a user.
+ *
+ * \param user user
+ * \param usage receives the state
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+extern void DMAALLOC_GetUsage(dmaalloc_User user, DMAALLOC_Usage *usage);
+
+/** \brief Send the channel table over the UART, one line per user.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaAlloc
+ */
+extern void DMAALLOC_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * \file dmacfg.c
+ * \brief DMA channel configurations, checked at compile time
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+
+#include "dmacfg_public.h"
+
+/* global functions */
+
+/** \brief Load a channel: addresses, configuration and transfer count.
+ * Four word writes, the configuration images are constants.
+ *
+ * \param channel DMA channel
+ * \param config configuration built by one of the presets
+ * \param source source address
+ * \param destination destination address
+ * \param trel transfer count
+ * \return None
+ *
+ *  \ingroup DmaCfg
+ */
+void DMACFG_Init(uint32 channel, const DMACFG_Config *config, uint32 source, uint32 destination, uint16 trel)
+{
+  Ifx_DMA_CH *ch = &MODULE_DMA.CH[channel];
+
+  ch->SADR.U   = source;
+  ch->DADR.U   = destination;
+  ch->ADICR.U  = config->adicr;
+  ch->CHCFGR.U = config->chcfgr | DMACFG_FIELD(CHCFGR, TREL, trel);
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * \file dmacfg_public.h
+ * \brief DMA channel configurations, checked at compile time
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef DMACFG_PUBLIC_H
+#define DMACFG_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+#include "IfxDma_bf.h"
+
+#include "dma_private.h"
+
+#define DMACFG_TREL_MAX ((uint16)IFX_DMA_CH_CHCFGR_TREL_MSK) /**< \brief largest transfer count */
+
+/** \brief Register images of a channel configuration.
+ * Built by the preset macros below as constants, the transfer count is
+ * added when the channel is loaded.
+ */
+typedef struct
+{
+  uint32 chcfgr;  /**< \brief CHCFGR without TREL */
+  uint32 adicr;   /**< \brief ADICR */
+} DMACFG_Config;
+
+/** \brief Zero if cond holds, otherwise the compiler rejects an array of
+ * negative size. Usable in the initializer of a constant.
+ */
+#define DMACFG_CHECK(cond) (0u * (uint32)sizeof(char[(cond) ? 1 : -1]))
+
+/** \brief Value of a bit field of CHCFGR or ADICR */
+#define DMACFG_FIELD(reg, field, value)                                                             \
+  (((uint32)(value) & IFX_DMA_CH_##reg##_##field##_MSK) << IFX_DMA_CH_##reg##_##field##_OFF)
+
+/** \brief Address sides, ADICR bits of the source resp. destination.
+ * A fixed address is a circular buffer of length 1 (CBE set, CBL 0), the
+ * increment direction has no effect then and is always "added". A circular
+ * buffer covers 2^log2Bytes bytes aligned to its size.
+ */
+#define DMACFG_SRC_FIXED                                                                            \
+  (DMACFG_FIELD(ADICR, SCBE, dma_adicrxxx_scbe_SourceCircularBufferEnabled) |                       \
+   DMACFG_FIELD(ADICR, CBLS, dma_adicrxxx_cbls_SourceAddress31to0) |                                \
+   DMACFG_FIELD(ADICR, INCS, dma_adicrxxx_incs_AddressOffsetIsAdded))
+#define DMACFG_SRC_LINEAR                                                                           \
+  (DMACFG_FIELD(ADICR, INCS, dma_adicrxxx_incs_AddressOffsetIsAdded))
+#define DMACFG_DST_FIXED                                                                            \
+  (DMACFG_FIELD(ADICR, DCBE, dma_adicrxxx_dcbe_DestinationCircularBufferEnabled) |                  \
+   DMACFG_FIELD(ADICR, CBLD, dma_adicrxxx_cbld_DestinationAddress31to0) |                           \
+   DMACFG_FIELD(ADICR, INCD, dma_adicrxxx_incd_AddressOffsetIsAdded))
+#define DMACFG_DST_LINEAR                                                                           \
+  (DMACFG_FIELD(ADICR, INCD, dma_adicrxxx_incd_AddressOffsetIsAdded))
+#define DMACFG_DST_CIRCULAR(log2Bytes)                                                              \
+  (DMACFG_FIELD(ADICR, DCBE, dma_adicrxxx_dcbe_DestinationCircularBufferEnabled) |                  \
+   DMACFG_FIELD(ADICR, CBLD, (log2Bytes)) |                                                         \
+   DMACFG_FIELD(ADICR, INCD, dma_adicrxxx_incd_AddressOffsetIsAdded))
+
+/** \brief Service request of the channel when the transaction has completed */
+#define DMACFG_IRQ_DONE                                                                             \
+  (DMACFG_FIELD(ADICR, INTCT, dma_adicrxxx_intct_InterruptChangingTCOUNTandEqualsIRDV) |            \
+   DMACFG_FIELD(ADICR, IRDV, 0))
+
+/** \brief CHCFGR of a hardware requested channel without pattern compare */
+#define DMACFG_CHCFGR(chdw, blkm, rroat, chmode, prio)                                              \
+  (DMACFG_FIELD(CHCFGR, CHDW, (chdw)) |                                                             \
+   DMACFG_FIELD(CHCFGR, BLKM, (blkm)) |                                                             \
+   DMACFG_FIELD(CHCFGR, RROAT, (rroat)) |                                                           \
+   DMACFG_FIELD(CHCFGR, CHMODE, (chmode)) |                                                         \
+   DMACFG_FIELD(CHCFGR, PATSEL, dma_chcfgrxxx_patsel_NoPatternCompareOperation) |                   \
+   DMACFG_FIELD(CHCFGR, PRSEL, dma_chcfgrxxx_prsel_HardwareRequestSelected) |                       \
+   DMACFG_FIELD(CHCFGR, DMAPRIO, (prio)) |                                                          \
+   DMACFG_CHECK((uint32)(prio) <= dma_chcfgrxxx_dmaprio_HighPrioritySelected) |                     \
+   DMACFG_CHECK((uint32)(blkm) <= dma_chcfgrxxx_blkm_OneTransferHasNineMoves) |                     \
+   DMACFG_CHECK((uint32)(chdw) <= dma_chcfgrxxx_chdw_DataBitWidth_256))
+
+/** \brief Bytes of one move at data width chdw */
+#define DMACFG_MOVE_BYTES(chdw) (1u << (uint32)(chdw))
+
+/** \brief Peripheral registers are accessed with at most 32 bit */
+#define DMACFG_CHECK_PERIPHERAL(chdw)                                                               \
+  DMACFG_CHECK((uint32)(chdw) <= dma_chcfgrxxx_chdw_DataBitWidth_32)
+
+/** \brief Preset: one move from a peripheral register into a linear buffer
+ * per request, the transaction ends after TREL moves.
+ */
+#define DMACFG_PERIPHERAL_TO_MEMORY(chdw, prio)                                                     \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), dma_chcfgrxxx_blkm_OneTransferHasOneMove,                                 \
+                  dma_chcfgrxxx_rroat_ResetAfterEachTransfer, dma_chcfgrxxx_chmode_SingleMode,      \
+                  (prio)) | DMACFG_CHECK_PERIPHERAL(chdw),                                          \
+    DMACFG_SRC_FIXED | DMACFG_DST_LINEAR | DMACFG_IRQ_DONE                                          \
+  }
+
+/** \brief Preset: one move from a linear buffer into a peripheral register
+ * per request, the transaction ends after TREL moves.
+ */
+#define DMACFG_MEMORY_TO_PERIPHERAL(chdw, prio)                                                     \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), dma_chcfgrxxx_blkm_OneTransferHasOneMove,                                 \
+                  dma_chcfgrxxx_rroat_ResetAfterEachTransfer, dma_chcfgrxxx_chmode_SingleMode,      \
+                  (prio)) | DMACFG_CHECK_PERIPHERAL(chdw),                                          \
+    DMACFG_SRC_LINEAR | DMACFG_DST_FIXED | DMACFG_IRQ_DONE                                          \
+  }
+
+/** \brief Preset: copy between linear buffers, one request runs the whole
+ * transaction of TREL transfers of blkm moves each.
+ */
+#define DMACFG_MEMORY_TO_MEMORY(chdw, blkm, prio)                                                   \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), (blkm), dma_chcfgrxxx_rroat_ResetWhenTCountIsZero,                        \
+                  dma_chcfgrxxx_chmode_SingleMode, (prio)),                                         \
+    DMACFG_SRC_LINEAR | DMACFG_DST_LINEAR | DMACFG_IRQ_DONE                                         \
+  }
+
+/** \brief Preset: fill a linear buffer with the value at a fixed source
+ * address, one request runs the whole transaction of TREL transfers of blkm
+ * moves each.
+ */
+#define DMACFG_MEMORY_FILL(chdw, blkm, prio)                                                        \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), (blkm), dma_chcfgrxxx_rroat_ResetWhenTCountIsZero,                        \
+                  dma_chcfgrxxx_chmode_SingleMode, (prio)),                                         \
+    DMACFG_SRC_FIXED | DMACFG_DST_LINEAR | DMACFG_IRQ_DONE                                          \
+  }
+
+/** \brief Preset: one move from a peripheral register per request into a
+ * circular buffer of 2^log2Bytes bytes. The channel stays enabled after
+ * each transaction, the buffer must be aligned to its size and hold at
+ * least one move.
+ */
+#define DMACFG_CIRCULAR(chdw, log2Bytes, prio)                                                      \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), dma_chcfgrxxx_blkm_OneTransferHasOneMove,                                 \
+                  dma_chcfgrxxx_rroat_ResetAfterEachTransfer, dma_chcfgrxxx_chmode_ContinuousMode,  \
+                  (prio)) | DMACFG_CHECK_PERIPHERAL(chdw) |                                         \
+    DMACFG_CHECK((1u << (uint32)(log2Bytes)) >= DMACFG_MOVE_BYTES(chdw)) |                          \
+    DMACFG_CHECK(((uint32)(log2Bytes) > 0u) &&                                                      \
+                 ((uint32)(log2Bytes) <= dma_adicrxxx_cbld_DestinationAddress31to15)),              \
+    DMACFG_SRC_FIXED | DMACFG_DST_CIRCULAR(log2Bytes) | DMACFG_IRQ_DONE                             \
+  }
+
+/** \brief Preset: memory to memory transaction which loads the next
+ * transaction control set from SHADR when it completes. The sets are
+ * 32 byte aligned images of SADR to CHCSR in memory, each one with this
+ * ADICR and its own SHADR, 0 ending the list.
+ */
+#define DMACFG_LINKED_LIST(chdw, blkm, prio)                                                        \
+  {                                                                                                 \
+    DMACFG_CHCFGR((chdw), (blkm), dma_chcfgrxxx_rroat_ResetWhenTCountIsZero,                        \
+                  dma_chcfgrxxx_chmode_SingleMode, (prio)),                                         \
+    DMACFG_SRC_LINEAR | DMACFG_DST_LINEAR | DMACFG_IRQ_DONE |                                       \
+    DMACFG_FIELD(ADICR, SHCT, dma_adicrxxx_shct_DMALinkedList)                                      \
+  }
+
+/** \brief Load a channel: addresses, configuration and transfer count.
+ * The channel is not enabled, see DMACFG_Enable.
+ *
+ * \param channel DMA channel
+ * \param config configuration built by one of the presets
+ * \param source source address
+ * \param destination destination address
+ * \param trel transfer count, at most DMACFG_TREL_MAX
+ * \return None
+ *
+ *  \ingroup DmaCfg
+ */
+extern void DMACFG_Init(uint32 channel, const DMACFG_Config *config, uint32 source, uint32 destination, uint16 trel);
+
+/** \brief Set the transfer count of a loaded channel, one word write.
+ *
+ * \param channel DMA channel
+ * \param config configuration the channel was loaded with
+ * \param trel transfer count, at most DMACFG_TREL_MAX
+ * \return None
+ *
+ *  \ingroup DmaCfg
+ */
+IFX_INLINE void DMACFG_SetCount(uint32 channel, const DMACFG_Config *config, uint16 trel)
+{
+  MODULE_DMA.CH[channel].CHCFGR.U = config->chcfgr | DMACFG_FIELD(CHCFGR, TREL, trel);
+}
+
+/** \brief Enable the hardware requests of a channel.
+ * TSR is written as a word, its other set and clear bits are written 0
+ * and have no effect.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup DmaCfg
+ */
+IFX_INLINE void DMACFG_Enable(uint32 channel)
+{
+  MODULE_DMA.TSR[channel].U = (uint32)IFX_DMA_TSR_ECH_MSK << IFX_DMA_TSR_ECH_OFF;
+}
+
+/** \brief Start a transaction of a loaded channel with a software request.
+ * CHCSR is written as a word, its other action bits are written 0 and have
+ * no effect.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup DmaCfg
+ */
+IFX_INLINE void DMACFG_Request(uint32 channel)
+{
+  MODULE_DMA.CH[channel].CHCSR.U = (uint32)IFX_DMA_CH_CHCSR_SCH_MSK << IFX_DMA_CH_CHCSR_SCH_OFF;
+}
+
+#endif	/* end of file */
@@ -0,0 +1,542 @@
+/*******************************************************************************
+ * \file dmacopy.c
+ * \brief asynchronous memory copy and fill with DMA channels
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+#include "IfxCpu.h"
+#include "IfxScuCcu.h"
+
+#include "IntPrioDef.h"
+#include "NoClearDef.h"
+#include "dma_private.h"
+#include "dmacfg_public.h"
+#include "dmaalloc_public.h"
+#include "isrstat_public.h"
+#include "log_public.h"
+#include "report_public.h"
+#include "dmacopy_public.h"
+
+#define DMACOPY_TEST_SIZE    4096u  /**< \brief bytes of the self test buffers */
+#define DMACOPY_TEST_WAIT_US 10000u /**< \brief longest wait for a self test job */
+
+/** \brief Channel and running job of an engine */
+typedef struct
+{
+  IfxCpu_mutexLock     busy;        /**< \brief held from the start of a job to its completion */
+  dmaalloc_User        user;        /**< \brief allocator user of the channel */
+  uint32               channel;     /**< \brief DMAALLOC_NONE until claimed */
+  const DMACFG_Config *config;      /**< \brief configuration of the running job */
+  uint32               transfers;   /**< \brief transfers of the job not requested yet */
+  uint32               start;       /**< \brief STM0 time of the start */
+  DMACOPY_Callback     callback;    /**< \brief completion of the running job */
+  void                *arg;         /**< \brief argument of the callback */
+  uint64               pattern IFX_ALIGN(8); /**< \brief source of a fill */
+  DMACOPY_Stats        stats;       /**< \brief jobs of this engine, written by the job owner */
+} DMACOPY_Engine;
+
+/** \brief Check of a self test job */
+typedef struct
+{
+  const uint8 *buffer;  /**< \brief destination of the job */
+  uint32       size;    /**< \brief bytes to check */
+  uint8        value;   /**< \brief expected content */
+} DMACOPY_TestJob;
+
+/** \addtogroup DmaCopy_Variables */
+/* private data */
+/** \brief Configurations by [fill][64 bit moves] */
+static const DMACFG_Config DMACOPY_configs[2][2] =
+{
+  {
+    DMACFG_MEMORY_TO_MEMORY(dma_chcfgrxxx_chdw_DataBitWidth_32, dma_chcfgrxxx_blkm_OneTransferHasEightMoves,
+                            dma_chcfgrxxx_dmaprio_LowPrioritySelected),
+    DMACFG_MEMORY_TO_MEMORY(dma_chcfgrxxx_chdw_DataBitWidth_64, dma_chcfgrxxx_blkm_OneTransferHasEightMoves,
+                            dma_chcfgrxxx_dmaprio_LowPrioritySelected),
+  },
+  {
+    DMACFG_MEMORY_FILL(dma_chcfgrxxx_chdw_DataBitWidth_32, dma_chcfgrxxx_blkm_OneTransferHasEightMoves,
+                       dma_chcfgrxxx_dmaprio_LowPrioritySelected),
+    DMACFG_MEMORY_FILL(dma_chcfgrxxx_chdw_DataBitWidth_64, dma_chcfgrxxx_blkm_OneTransferHasEightMoves,
+                       dma_chcfgrxxx_dmaprio_LowPrioritySelected),
+  },
+};
+
+static DMACOPY_Engine DMACOPY_engines[DMACOPY_NUM_ENGINES] =
+{
+  {0, dmaalloc_User_copy0, DMAALLOC_NONE},
+  {0, dmaalloc_User_copy1, DMAALLOC_NONE},
+};
+
+/* jobs done by the CPU and rejected jobs, per calling core */
+static DMACOPY_Stats DMACOPY_cpuStats[IFXCPU_NUM_MODULES];
+
+/* self test: a staging buffer in the LMU and its copy in DSPR0 */
+NOCLEAR_BEGIN(lmu)
+static uint8 DMACOPY_testLmu[DMACOPY_TEST_SIZE] IFX_ALIGN(8);
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu0)
+static uint8 DMACOPY_testDspr[DMACOPY_TEST_SIZE] IFX_ALIGN(8);
+NOCLEAR_END
+
+static DMACOPY_TestJob DMACOPY_testJobs[3];
+static uint32 DMACOPY_testRuns;
+static uint32 DMACOPY_testChecked;
+static uint32 DMACOPY_testFailures;
+
+/* private functions */
+
+/** \brief Copy or fill bytes with the CPU.
+ *
+ * \param destination destination buffer
+ * \param source source buffer, NULL to fill with value
+ * \param value fill value
+ * \param size number of bytes
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+static void DMACOPY_CpuMove(uint8 *destination, const uint8 *source, uint8 value, uint32 size)
+{
+  for (uint32 i = 0; i < size; i++)
+  {
+    destination[i] = (source != NULL_PTR) ? source[i] : value;
+  }
+}
+
+/** \brief Take a free engine with a claimed channel.
+ *
+ * \param None
+ * \return engine, NULL_PTR if all engines are busy
+ *
+ *  \ingroup DmaCopy
+ */
+static DMACOPY_Engine *DMACOPY_Acquire(void)
+{
+  for (uint32 i = 0; i < DMACOPY_NUM_ENGINES; i++)
+  {
+    DMACOPY_Engine *engine = &DMACOPY_engines[i];
+
+    if ((engine->channel != DMAALLOC_NONE) && (IfxCpu_acquireMutex(&engine->busy) != FALSE))
+    {
+      return engine;
+    }
+  }
+  return NULL_PTR;
+}
+
+/** \brief Start a job on an engine or do it with the CPU.
+ * Only whole transfers are moved by the channel, the CPU moves the tail
+ * first so that the callback ends the job.
+ *
+ * \param destination destination buffer
+ * \param source source buffer, NULL to fill with value
+ * \param value fill value
+ * \param size number of bytes
+ * \param callback completion, NULL for none
+ * \param arg argument of the callback
+ * \return TRUE if the job has been accepted
+ *
+ *  \ingroup DmaCopy
+ */
+static boolean DMACOPY_Submit(uint8 *destination, const uint8 *source, uint8 value, uint32 size,
+                              DMACOPY_Callback callback, void *arg)
+{
+  uint32          core   = IfxCpu_getCoreIndex();
+  DMACOPY_Engine *engine = NULL_PTR;
+  uint32          dst    = IFXCPU_GLB_ADDR_DSPR(core, destination);
+  uint32          src    = 0;
+
+  if (size >= DMACOPY_THRESHOLD)
+  {
+    engine = DMACOPY_Acquire();
+    if (engine == NULL_PTR)
+    {
+      DMACOPY_cpuStats[core].busy++;
+      return FALSE;
+    }
+    if (source == NULL_PTR)
+    {
+      engine->pattern = (uint64)value * 0x0101010101010101ull;
+      src = IFXCPU_GLB_ADDR_DSPR(core, &engine->pattern);
+    }
+    else
+    {
+      src = IFXCPU_GLB_ADDR_DSPR(core, source);
+    }
+    if (((dst | src) & 3u) != 0)
+    {
+      /* the channel moves at least words, this job is the CPU's */
+      IfxCpu_releaseMutex(&engine->busy);
+      engine = NULL_PTR;
+    }
+  }
+
+  if (engine != NULL_PTR)
+  {
+    boolean wide       = (boolean)(((dst | src) & 7u) == 0);
+    uint32  blockBytes = (wide != FALSE) ? (8u * DMACOPY_BLOCK_MOVES) : (4u * DMACOPY_BLOCK_MOVES);
+    uint32  transfers  = size / blockBytes;
+    uint32  dmaBytes   = transfers * blockBytes;
+    uint16  trel       = (uint16)((transfers > DMACFG_TREL_MAX) ? DMACFG_TREL_MAX : transfers);
+
+    DMACOPY_CpuMove(&destination[dmaBytes], (source != NULL_PTR) ? &source[dmaBytes] : NULL_PTR, value,
+                    size - dmaBytes);
+
+    engine->config    = &DMACOPY_configs[source == NULL_PTR][wide];
+    engine->transfers = transfers - trel;
+    engine->callback  = callback;
+    engine->arg       = arg;
+    engine->stats.dmaJobs++;
+    engine->stats.dmaBytes += dmaBytes;
+    engine->stats.jobs64   += (uint32)wide;
+    engine->stats.transactions++;
+    engine->stats.cpuBytes += size - dmaBytes;
+    engine->start = STM0_TIM0.U;
+
+    DMACFG_Init(engine->channel, engine->config, src, dst, trel);
+    DMAALLOC_Request(engine->user, trel);
+    return TRUE;
+  }
+
+  DMACOPY_CpuMove(destination, source, value, size);
+  DMACOPY_cpuStats[core].cpuJobs++;
+  DMACOPY_cpuStats[core].cpuBytes += size;
+  if (callback != NULL_PTR)
+  {
+    callback(arg);
+  }
+  return TRUE;
+}
+
+/** \brief Transaction of an engine done, request the next one or end the job.
+ * The engine is free again before the callback runs, so the callback may
+ * start the next job.
+ *
+ * \param engine engine
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+static void DMACOPY_Done(DMACOPY_Engine *engine)
+{
+  DMACOPY_Callback callback = engine->callback;
+  void            *arg      = engine->arg;
+  uint32           time;
+
+  if (engine->transfers > 0)
+  {
+    /* the addresses have advanced, only the count is loaded again */
+    uint16 trel = (uint16)((engine->transfers > DMACFG_TREL_MAX) ? DMACFG_TREL_MAX : engine->transfers);
+
+    engine->transfers -= trel;
+    engine->stats.transactions++;
+    DMACFG_SetCount(engine->channel, engine->config, trel);
+    DMAALLOC_Request(engine->user, trel);
+    return;
+  }
+
+  time = STM0_TIM0.U - engine->start;
+  if (time > engine->stats.timeMax)
+  {
+    engine->stats.timeMax = time;
+  }
+  IfxCpu_releaseMutex(&engine->busy);
+
+  if (callback != NULL_PTR)
+  {
+    callback(arg);
+  }
+}
+
+/** \brief Compare the destination of a self test job with its value.
+ *
+ * \param arg self test job
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+static void DMACOPY_TestCheck(void *arg)
+{
+  const DMACOPY_TestJob *job = (const DMACOPY_TestJob *)arg;
+
+  for (uint32 i = 0; i < job->size; i++)
+  {
+    if (job->buffer[i] != job->value)
+    {
+      DMACOPY_testFailures++;
+      LOG_ERROR(log_Module_dma, "DMA copy test: byte %u is 0x%02X, not 0x%02X", i, job->buffer[i], job->value);
+      break;
+    }
+  }
+  DMACOPY_testChecked++;
+}
+
+/** \brief Wait until the engines are idle.
+ *
+ * \param None
+ * \return TRUE on timeout
+ *
+ *  \ingroup DmaCopy
+ */
+static boolean DMACOPY_TestWait(void)
+{
+  uint32 ticks = (uint32)(IfxScuCcu_getStmFrequency() * (DMACOPY_TEST_WAIT_US * 0.000001F)) + 1u;
+  uint32 start = STM0_TIM0.U;
+
+  while (DMACOPY_IsBusy() != FALSE)
+  {
+    if ((uint32)(STM0_TIM0.U - start) >= ticks)
+    {
+      DMACOPY_testFailures++;
+      LOG_ERROR(log_Module_dma, "DMA copy test: timeout");
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+/** \brief Copy engine 0 done.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+IFX_INTERRUPT_STAT(DMACOPY_Engine0ISR, VECTAB0, SRPN_CPU0_DMA_COPY0);
+void DMACOPY_Engine0ISR(void)
+{
+  DMACOPY_Done(&DMACOPY_engines[0]);
+}
+
+/** \brief Copy engine 1 done.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+IFX_INTERRUPT_STAT(DMACOPY_Engine1ISR, VECTAB0, SRPN_CPU0_DMA_COPY1);
+void DMACOPY_Engine1ISR(void)
+{
+  DMACOPY_Done(&DMACOPY_engines[1]);
+}
+
+/* global functions */
+
+/** \brief Claim the channels of the engines.
+ * An engine without channel is skipped, its jobs go to the other engine
+ * or to the CPU.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+void DMACOPY_Init(void)
+{
+  for (uint32 i = 0; i < DMACOPY_NUM_ENGINES; i++)
+  {
+    DMACOPY_engines[i].channel = DMAALLOC_Claim(DMACOPY_engines[i].user);
+  }
+}
+
+/** \brief Copy a buffer, returns before the copy has completed.
+ *
+ * \param destination destination buffer
+ * \param source source buffer
+ * \param size bytes to copy
+ * \param callback called when the copy has completed, NULL for none
+ * \param arg argument of the callback
+ * \return TRUE if the job has been accepted, FALSE if all engines are busy
+ *
+ *  \ingroup DmaCopy
+ */
+boolean DMACOPY_Copy(void *destination, const void *source, uint32 size, DMACOPY_Callback callback, void *arg)
+{
+  return DMACOPY_Submit((uint8 *)destination, (const uint8 *)source, 0, size, callback, arg);
+}
+
+/** \brief Fill a buffer with a byte value, returns before the fill has completed.
+ *
+ * \param destination destination buffer
+ * \param value byte value
+ * \param size bytes to fill
+ * \param callback called when the fill has completed, NULL for none
+ * \param arg argument of the callback
+ * \return TRUE if the job has been accepted, FALSE if all engines are busy
+ *
+ *  \ingroup DmaCopy
+ */
+boolean DMACOPY_Fill(void *destination, uint8 value, uint32 size, DMACOPY_Callback callback, void *arg)
+{
+  return DMACOPY_Submit((uint8 *)destination, NULL_PTR, value, size, callback, arg);
+}
+
+/** \brief Check for running jobs.
+ *
+ * \param None
+ * \return TRUE while an engine has not completed its job
+ *
+ *  \ingroup DmaCopy
+ */
+boolean DMACOPY_IsBusy(void)
+{
+  for (uint32 i = 0; i < DMACOPY_NUM_ENGINES; i++)
+  {
+    if (DMACOPY_engines[i].busy != 0)
+    {
+      return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+/** \brief Fill a buffer in the LMU, stage it into DSPR0 and check the copy.
+ * The LMU buffer is only written and read by the channels, the CPU does not
+ * see it through its cache. The fill of DSPR0 at offset 4 uses 32 bit moves
+ * and a tail, the last copy within DSPR0 is below the threshold and done by
+ * the CPU.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+void DMACOPY_SelfTest(void)
+{
+  uint8 value = (uint8)(0x5Au + DMACOPY_testRuns);
+
+  DMACOPY_testRuns++;
+
+  DMACOPY_testJobs[0] = (DMACOPY_TestJob){DMACOPY_testDspr, DMACOPY_TEST_SIZE, value};
+  DMACOPY_testJobs[1] = (DMACOPY_TestJob){&DMACOPY_testDspr[4], 1000u, (uint8)(value + 1u)};
+  DMACOPY_testJobs[2] = (DMACOPY_TestJob){&DMACOPY_testDspr[2000], 100u, value};
+
+  if ((DMACOPY_Fill(DMACOPY_testLmu, value, DMACOPY_TEST_SIZE, NULL_PTR, NULL_PTR) == FALSE) ||
+      (DMACOPY_TestWait() != FALSE) ||
+      (DMACOPY_Copy(DMACOPY_testDspr, DMACOPY_testLmu, DMACOPY_TEST_SIZE, DMACOPY_TestCheck, &DMACOPY_testJobs[0]) == FALSE) ||
+      (DMACOPY_TestWait() != FALSE) ||
+      (DMACOPY_Fill(&DMACOPY_testDspr[4], (uint8)(value + 1u), 1000u, DMACOPY_TestCheck, &DMACOPY_testJobs[1]) == FALSE) ||
+      (DMACOPY_TestWait() != FALSE) ||
+      (DMACOPY_Copy(&DMACOPY_testDspr[2000], &DMACOPY_testDspr[1100], 100u, DMACOPY_TestCheck, &DMACOPY_testJobs[2]) == FALSE))
+  {
+    DMACOPY_testFailures++;
+  }
+}
+
+/** \brief Copy the statistics, the sum over the engines and the cores.
+ *
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+void DMACOPY_GetStats(DMACOPY_Stats *stats)
+{
+  const DMACOPY_Stats *parts[DMACOPY_NUM_ENGINES + IFXCPU_NUM_MODULES];
+
+  for (uint32 i = 0; i < DMACOPY_NUM_ENGINES; i++)
+  {
+    parts[i] = &DMACOPY_engines[i].stats;
+  }
+  for (uint32 i = 0; i < IFXCPU_NUM_MODULES; i++)
+  {
+    parts[DMACOPY_NUM_ENGINES + i] = &DMACOPY_cpuStats[i];
+  }
+
+  *stats = (DMACOPY_Stats){0};
+  for (uint32 i = 0; i < (DMACOPY_NUM_ENGINES + IFXCPU_NUM_MODULES); i++)
+  {
+    stats->dmaJobs      += parts[i]->dmaJobs;
+    stats->dmaBytes     += parts[i]->dmaBytes;
+    stats->jobs64       += parts[i]->jobs64;
+    stats->transactions += parts[i]->transactions;
+    stats->cpuJobs      += parts[i]->cpuJobs;
+    stats->cpuBytes     += parts[i]->cpuBytes;
+    stats->busy         += parts[i]->busy;
+    if (parts[i]->timeMax > stats->timeMax)
+    {
+      stats->timeMax = parts[i]->timeMax;
+    }
+  }
+}
+
+/** \brief Send the statistics and the self test result over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+void DMACOPY_Report(void)
+{
+  DMACOPY_Stats stats;
+
+  DMACOPY_GetStats(&stats);
+
+  REPORT_String("DMACOPY dma=");
+  REPORT_Dec32(stats.dmaJobs);
+  REPORT_String(" bytes=");
+  REPORT_Dec32(stats.dmaBytes);
+  REPORT_String(" jobs64=");
+  REPORT_Dec32(stats.jobs64);
+  REPORT_String(" transactions=");
+  REPORT_Dec32(stats.transactions);
+  REPORT_String(" cpu=");
+  REPORT_Dec32(stats.cpuJobs);
+  REPORT_String(" cpuBytes=");
+  REPORT_Dec32(stats.cpuBytes);
+  REPORT_String(" busy=");
+  REPORT_Dec32(stats.busy);
+  REPORT_String(" tmax=");
+  REPORT_Dec32(stats.timeMax);
+  REPORT_NewLine();
+
+  REPORT_String("DMACOPY test runs=");
+  REPORT_Dec32(DMACOPY_testRuns);
+  REPORT_String(" checked=");
+  REPORT_Dec32(DMACOPY_testChecked);
+  REPORT_String(" failures=");
+  REPORT_Dec32(DMACOPY_testFailures);
+  REPORT_NewLine();
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * \file dmacopy_public.h
+ * \brief asynchronous memory copy and fill with DMA channels
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef DMACOPY_PUBLIC_H
+#define DMACOPY_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define DMACOPY_NUM_ENGINES 2u    /**< \brief channels copy0 and copy1 of DmaDef.h */
+#define DMACOPY_THRESHOLD   256u  /**< \brief smaller jobs are done by the CPU, they cost less than the channel setup */
+#define DMACOPY_BLOCK_MOVES 8u    /**< \brief moves per transfer, the UART channels wait for at most one transfer */
+
+/** \brief Completion of a job.
+ * Called in the channel interrupt on CPU0, or by the caller of DMACOPY_Copy
+ * resp. DMACOPY_Fill if the CPU has done the job.
+ *
+ * \param arg argument given with the job
+ * \return None
+ */
+typedef void (*DMACOPY_Callback)(void *arg);
+
+/** \brief Statistics of the copy engines, times in STM ticks */
+typedef struct
+{
+  uint32 dmaJobs;      /**< \brief jobs done by a channel */
+  uint32 dmaBytes;     /**< \brief bytes moved by the channels */
+  uint32 jobs64;       /**< \brief jobs with 64 bit moves, the others use 32 bit */
+  uint32 transactions; /**< \brief transactions, more than dmaJobs for jobs above DMACFG_TREL_MAX transfers */
+  uint32 cpuJobs;      /**< \brief jobs below the threshold or not aligned to 4 bytes */
+  uint32 cpuBytes;     /**< \brief bytes copied by the CPU, the tails of the DMA jobs included */
+  uint32 busy;         /**< \brief jobs rejected, all engines were busy */
+  uint32 timeMax;      /**< \brief longest job from the start to the interrupt */
+} DMACOPY_Stats;
+
+/** \brief Claim the channels of the engines.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+extern void DMACOPY_Init(void);
+
+/** \brief Copy a buffer, returns before the copy has completed.
+ * Jobs below DMACOPY_THRESHOLD bytes and buffers which are not aligned to
+ * 4 bytes are copied by the CPU before the function returns. Otherwise a
+ * free engine moves the buffer with 64 bit moves if source and destination
+ * are aligned to 8 bytes, else with 32 bit moves; the CPU copies the tail
+ * which does not fill a transfer. The buffers must not overlap and must not
+ * be touched until the callback has been called.
+ * Data in the cached LMU segment must have been written back by the CPU.
+ * Any core may start a job.
+ *
+ * \param destination destination buffer
+ * \param source source buffer
+ * \param size bytes to copy
+ * \param callback called when the copy has completed, NULL for none
+ * \param arg argument of the callback
+ * \return TRUE if the job has been accepted, FALSE if all engines are busy
+ *
+ *  \ingroup DmaCopy
+ */
+extern boolean DMACOPY_Copy(void *destination, const void *source, uint32 size, DMACOPY_Callback callback, void *arg);
+
+/** \brief Fill a buffer with a byte value, returns before the fill has completed.
+ * The same rules as for DMACOPY_Copy apply.
+ *
+ * \param destination destination buffer
+ * \param value byte value
+ * \param size bytes to fill
+ * \param callback called when the fill has completed, NULL for none
+ * \param arg argument of the callback
+ * \return TRUE if the job has been accepted, FALSE if all engines are busy
+ *
+ *  \ingroup DmaCopy
+ */
+extern boolean DMACOPY_Fill(void *destination, uint8 value, uint32 size, DMACOPY_Callback callback, void *arg);
+
+/** \brief Check for running jobs.
+ *
+ * \param None
+ * \return TRUE while an engine has not completed its job
+ *
+ *  \ingroup DmaCopy
+ */
+extern boolean DMACOPY_IsBusy(void);
+
+/** \brief Fill a buffer in the LMU, stage it into DSPR0 and check the copy.
+ * Exercises both move widths and the CPU path, the result is counted in the
+ * report.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+extern void DMACOPY_SelfTest(void);
+
+/** \brief Copy the statistics.
+ *
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+extern void DMACOPY_GetStats(DMACOPY_Stats *stats);
+
+/** \brief Send the statistics and the self test result over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup DmaCopy
+ */
+extern void DMACOPY_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,302 @@
+/*******************************************************************************
+ * \file dvfs.c
+ * \brief Frequency scaling with named performance levels
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxScuCcu.h"
+#include "IfxStm_reg.h"
+
+#include "asclin3_public.h"
+#include "pllramp_public.h"
+#include "profiler_public.h"
+#include "cpuload_public.h"
+#include "trace_public.h"
+#include "report_public.h"
+#include "dvfs_public.h"
+
+#define DVFS_MAX_JUMP_PERCENT 134u       /**< \brief largest frequency ratio of one K2 step, as the PLL ramp */
+#define DVFS_STEP_WAIT        0.000100F  /**< \brief settling time in seconds after each K2 step */
+#define DVFS_HISTORY_SIZE     8u         /**< \brief transitions kept until DVFS_Report */
+#define DVFS_K2DIV_MAX        128u       /**< \brief largest K2 divider */
+
+/** \brief Performance level */
+typedef struct
+{
+  const char *name;          /**< \brief name used in the report */
+  float32     pllFrequency;  /**< \brief fPLL in Hz */
+} DVFS_LevelConfig;
+
+/** \brief Transition record */
+typedef struct
+{
+  uint8  from;          /**< \brief previous level */
+  uint8  to;            /**< \brief new level */
+  uint8  k2Steps;       /**< \brief number of K2 changes */
+  uint32 microSeconds;  /**< \brief duration of the transition */
+} DVFS_Transition;
+
+/** \addtogroup Dvfs_Variables */
+/* private data */
+static const DVFS_LevelConfig DVFS_levels[dvfs_Level_count] =
+{
+  /* name,      pllFrequency */
+  {"full",      (float32)IFX_CFG_SCU_PLL_FREQUENCY},
+  {"reduced",   100000000.0F},
+  {"idle",      50000000.0F},
+};
+
+/** \brief Called after each change, with interrupts disabled: UARTs which
+ * are active and timebases which are derived from the STM frequency.
+ */
+static const DVFS_ClockListener DVFS_listeners[] =
+{
+  ASCLIN3_UpdateBaudrate,
+  PROFILER_UpdateRate,
+  CPULOAD_UpdateRate,
+  TRACE_UpdateClock,
+};
+
+#define DVFS_NUM_LISTENERS (sizeof(DVFS_listeners) / sizeof(DVFS_listeners[0]))
+
+static dvfs_Level      DVFS_level = dvfs_Level_full;
+static uint32          DVFS_stmFrequency;
+static DVFS_Transition DVFS_history[DVFS_HISTORY_SIZE];
+static uint32          DVFS_historyCount;
+
+/* private functions */
+
+/** \brief K2 divider (register value + 1) which gives a level's frequency.
+ *
+ * \param level performance level
+ * \return K2 divider, 0 if the frequency cannot be reached
+ *
+ *  \ingroup Dvfs
+ */
+static uint32 DVFS_GetK2Divider(dvfs_Level level)
+{
+  uint32 k2 = (uint32)((IfxScuCcu_getPllVcoFrequency() / DVFS_levels[level].pllFrequency) + 0.5F);
+
+  if ((k2 == 0) || (k2 > DVFS_K2DIV_MAX) ||
+      (DVFS_levels[level].pllFrequency > (float32)IFX_CFG_SCU_PLL_FREQUENCY))
+  {
+    /* the flash wait states are configured for IFX_CFG_SCU_PLL_FREQUENCY */
+    k2 = 0;
+  }
+
+  return k2;
+}
+
+/** \brief Next K2 divider on the way to the target, limits the current jump.
+ *
+ * \param k2 current K2 divider
+ * \param target K2 divider of the new level
+ * \return next K2 divider
+ *
+ *  \ingroup Dvfs
+ */
+static uint32 DVFS_GetNextK2Divider(uint32 k2, uint32 target)
+{
+  uint32 next = target;
+
+  if (next < k2)
+  {
+    while ((k2 * 100u) > (next * DVFS_MAX_JUMP_PERCENT))
+    {
+      next++;
+    }
+  }
+  else
+  {
+    while ((next * 100u) > (k2 * DVFS_MAX_JUMP_PERCENT))
+    {
+      next--;
+    }
+  }
+
+  return next;
+}
+
+/** \brief Busy wait using STM0.
+ *
+ * \param ticks STM ticks to wait
+ * \return None
+ *
+ *  \ingroup Dvfs
+ */
+static void DVFS_Wait(uint32 ticks)
+{
+  uint32 start = STM0_TIM0.U;
+
+  while ((uint32)(STM0_TIM0.U - start) < ticks)
+    ;
+}
+
+/* global functions */
+
+/** \brief Switch to a performance level.
+ *
+ * \param level new performance level
+ * \return TRUE if the level is invalid
+ *
+ *  \ingroup Dvfs
+ */
+boolean DVFS_SetLevel(dvfs_Level level)
+{
+  uint32  target;
+  uint32  k2;
+  uint32  stmFrequency;
+  uint32  start;
+  uint64  us    = 0;
+  uint8   steps = 0;
+  boolean interruptState;
+
+  if (level >= dvfs_Level_count)
+  {
+    return TRUE;
+  }
+
+  target = DVFS_GetK2Divider(level);
+  if (target == 0)
+  {
+    return TRUE;
+  }
+
+  /* the frame on the line must not be cut by the baud rate change */
+  ASCLIN3_Flush();
+
+  interruptState = IfxCpu_disableInterrupts();
+
+  k2           = SCU_PLLCON1.B.K2DIV + 1u;
+  stmFrequency = DVFS_GetStmFrequency();
+  start        = STM0_TIM0.U;
+
+  while (k2 != target)
+  {
+    k2 = DVFS_GetNextK2Divider(k2, target);
+    PLLRAMP_SetK2Divider((uint8)(k2 - 1u));
+    steps++;
+
+    /* the STM runs from fPLL, convert the time spent at the old frequency */
+    us          += ((uint64)(STM0_TIM0.U - start) * 1000000u) / stmFrequency;
+    start        = STM0_TIM0.U;
+    stmFrequency = (uint32)IfxScuCcu_getStmFrequency();
+
+    DVFS_Wait((uint32)(DVFS_STEP_WAIT * stmFrequency));
+  }
+  DVFS_stmFrequency = stmFrequency;
+
+  for (uint32 i = 0; i < DVFS_NUM_LISTENERS; i++)
+  {
+    DVFS_listeners[i]();
+  }
+
+  us += ((uint64)(STM0_TIM0.U - start) * 1000000u) / stmFrequency;
+
+  if (DVFS_historyCount < DVFS_HISTORY_SIZE)
+  {
+    DVFS_history[DVFS_historyCount].from         = (uint8)DVFS_level;
+    DVFS_history[DVFS_historyCount].to           = (uint8)level;
+    DVFS_history[DVFS_historyCount].k2Steps      = steps;
+    DVFS_history[DVFS_historyCount].microSeconds = (uint32)us;
+    DVFS_historyCount++;
+  }
+  DVFS_level = level;
+
+  IfxCpu_restoreInterrupts(interruptState);
+
+  return FALSE;
+}
+
+/** \brief Get the current performance level.
+ *
+ * \param None
+ * \return current level
+ *
+ *  \ingroup Dvfs
+ */
+dvfs_Level DVFS_GetLevel(void)
+{
+  return DVFS_level;
+}
+
+/** \brief Get the STM frequency of the current level.
+ *
+ * \param None
+ * \return fSTM in Hz
+ *
+ *  \ingroup Dvfs
+ */
+uint32 DVFS_GetStmFrequency(void)
+{
+  if (DVFS_stmFrequency == 0)
+  {
+    DVFS_stmFrequency = (uint32)IfxScuCcu_getStmFrequency();
+  }
+
+  return DVFS_stmFrequency;
+}
+
+/** \brief Send the transitions since the last report over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Dvfs
+ */
+void DVFS_Report(void)
+{
+  uint32 count = DVFS_historyCount;
+
+  for (uint32 i = 0; i < count; i++)
+  {
+    REPORT_String("DVFS ");
+    REPORT_String(DVFS_levels[DVFS_history[i].from].name);
+    REPORT_String("->");
+    REPORT_String(DVFS_levels[DVFS_history[i].to].name);
+    REPORT_String(" steps=");
+    REPORT_Dec32(DVFS_history[i].k2Steps);
+    REPORT_String(" us=");
+    REPORT_Dec32(DVFS_history[i].microSeconds);
+    REPORT_NewLine();
+  }
+  DVFS_historyCount = 0;
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * \file dvfs_public.h
+ * \brief Frequency scaling with named performance levels
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef DVFS_PUBLIC_H
+#define DVFS_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+/** \brief Performance levels, see DVFS_levels[] for the frequencies */
+typedef enum
+{
+  dvfs_Level_full = 0,  /**< \brief fPLL = IFX_CFG_SCU_PLL_FREQUENCY, level after the boot */
+  dvfs_Level_reduced,   /**< \brief fPLL = 100MHz */
+  dvfs_Level_idle,      /**< \brief fPLL = 50MHz */
+  dvfs_Level_count
+} dvfs_Level;
+
+/** \brief Function called after each frequency change to adapt a peripheral
+ * or a timebase to the new clock. Called with interrupts disabled.
+ */
+typedef void (*DVFS_ClockListener)(void);
+
+/** \brief Switch to a performance level.
+ * The K2 divider of the PLL is changed step by step, all clocks derived
+ * from fPLL (CPU, SRI, SPB, STM, fASCLINF) scale together. The UART is
+ * flushed before the change and the clock listeners are called after it,
+ * with interrupts disabled. Must be called by CPU0 with global interrupts
+ * enabled.
+ *
+ * \param level new performance level
+ * \return TRUE if the level is invalid
+ *
+ *  \ingroup Dvfs
+ */
+extern boolean DVFS_SetLevel(dvfs_Level level);
+
+/** \brief Get the current performance level.
+ *
+ * \param None
+ * \return current level
+ *
+ *  \ingroup Dvfs
+ */
+extern dvfs_Level DVFS_GetLevel(void);
+
+/** \brief Get the STM frequency of the current level.
+ * Cached, cheaper than IfxScuCcu_getStmFrequency().
+ *
+ * \param None
+ * \return fSTM in Hz
+ *
+ *  \ingroup Dvfs
+ */
+extern uint32 DVFS_GetStmFrequency(void);
+
+/** \brief Send the transitions since the last report over the UART.
+ * One line per transition: levels and duration in microseconds.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Dvfs
+ */
+extern void DVFS_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * \file initseq.c
+ * \brief table-driven register initialisation with per step timing
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+#include "IfxCpu.h"
+#include "IfxScuCcu.h"
+#include "IfxScuWdt.h"
+
+#include "multicore_public.h"
+#include "report_public.h"
+#include "initseq_public.h"
+
+/** \addtogroup InitSeq_Variables */
+/* private data */
+static const INITSEQ_Script *INITSEQ_scripts[INITSEQ_MAX_SCRIPTS];
+static uint32 INITSEQ_numScripts;
+static IfxCpu_mutexLock INITSEQ_lock;
+
+/* private functions */
+
+/** \brief Open or close an ENDINIT window.
+ *
+ * \param endinit watchdog, initseq_Endinit_cpu or initseq_Endinit_safety
+ * \param open TRUE to clear ENDINIT, FALSE to set it
+ * \return None
+ *
+ *  \ingroup InitSeq
+ */
+static void INITSEQ_Endinit(uint32 endinit, boolean open)
+{
+  if (endinit == initseq_Endinit_safety)
+  {
+    /* one safety ENDINIT for all cores, the window is held under its lock */
+    if (open != FALSE)
+    {
+      MULTICORE_OpenSafetyEndinit();
+    }
+    else
+    {
+      MULTICORE_CloseSafetyEndinit();
+    }
+  }
+  else
+  {
+    uint16 password = IfxScuWdt_getCpuWatchdogPassword();
+
+    if (open != FALSE)
+    {
+      IfxScuWdt_clearCpuEndinit(password);
+    }
+    else
+    {
+      IfxScuWdt_setCpuEndinit(password);
+    }
+  }
+}
+
+/** \brief Index of the unlock step a lock step can be joined with.
+ *
+ * \param script script
+ * \param lock index of the lock step
+ * \return index of the unlock step, numSteps if there is none
+ *
+ *  \ingroup InitSeq
+ */
+static uint32 INITSEQ_FindRelock(const INITSEQ_Script *script, uint32 lock)
+{
+  uint32 i = lock + 1u;
+
+  while ((i < script->numSteps) && (script->steps[i].op == initseq_Op_wait))
+  {
+    i++;
+  }
+
+  if ((i < script->numSteps) && (script->steps[i].op == initseq_Op_unlock) &&
+      (script->steps[i].value == script->steps[lock].value))
+  {
+    return i;
+  }
+  return script->numSteps;
+}
+
+/** \brief Add a script to the ones listed by INITSEQ_Report, once.
+ *
+ * \param script script
+ * \return None
+ *
+ *  \ingroup InitSeq
+ */
+static void INITSEQ_Register(const INITSEQ_Script *script)
+{
+  while (IfxCpu_acquireMutex(&INITSEQ_lock) == FALSE)
+    ;
+
+  if (INITSEQ_numScripts < INITSEQ_MAX_SCRIPTS)
+  {
+    INITSEQ_scripts[INITSEQ_numScripts] = script;
+    INITSEQ_numScripts++;
+  }
+
+  IfxCpu_releaseMutex(&INITSEQ_lock);
+}
+
+/* global functions */
+
+/** \brief Execute the steps of a script and time them.
+ * Each step is timed from the end of the previous one, a joined lock and
+ * unlock pair costs nothing and counts as merged.
+ *
+ * \param script script to run
+ * \return TRUE if a wait step gave up
+ *
+ *  \ingroup InitSeq
+ */
+boolean INITSEQ_Run(const INITSEQ_Script *script)
+{
+  INITSEQ_Stats stats     = {0};
+  uint32        open      = 0;                /* watchdog + 1 of the open window, 0 if closed */
+  uint32        skip      = script->numSteps; /* unlock step joined with the previous lock */
+  uint32        waitTicks = 0;
+  uint32        start     = STM0_TIM0.U;
+  uint32        last      = start;
+
+  for (uint32 i = 0; i < script->numSteps; i++)
+  {
+    const INITSEQ_Step *step = &script->steps[i];
+    volatile uint32    *reg  = (volatile uint32 *)step->regAddr;
+    uint32              now;
+
+    switch (step->op)
+    {
+      case initseq_Op_write:
+        *reg = step->value;
+        break;
+
+      case initseq_Op_modify:
+        __ldmst(reg, step->mask, step->value);
+        break;
+
+      case initseq_Op_wait:
+        if (waitTicks == 0)
+        {
+          waitTicks = (uint32)(IfxScuCcu_getStmFrequency() * (INITSEQ_WAIT_US * 0.000001F)) + 1u;
+        }
+        while ((*reg & step->mask) != step->value)
+        {
+          if ((uint32)(STM0_TIM0.U - last) >= waitTicks)
+          {
+            stats.timeouts++;
+            break;
+          }
+        }
+        break;
+
+      case initseq_Op_unlock:
+        if (i != skip)
+        {
+          INITSEQ_Endinit(step->value, TRUE);
+          stats.unlocks++;
+        }
+        open = step->value + 1u;
+        break;
+
+      case initseq_Op_lock:
+        skip = INITSEQ_FindRelock(script, i);
+        if (skip < script->numSteps)
+        {
+          stats.merged++;
+        }
+        else
+        {
+          INITSEQ_Endinit(step->value, FALSE);
+          open = 0;
+        }
+        break;
+
+      default:
+        break;
+    }
+
+    now = STM0_TIM0.U;
+    if ((now - last) > stats.maxTicks)
+    {
+      stats.maxTicks = now - last;
+      stats.maxStep  = (uint16)i;
+    }
+    last = now;
+  }
+
+  if (open != 0)
+  {
+    INITSEQ_Endinit(open - 1u, FALSE);
+  }
+
+  stats.ticks = STM0_TIM0.U - start;
+  stats.runs  = script->stats->runs + 1u;
+  if (stats.runs == 1u)
+  {
+    INITSEQ_Register(script);
+  }
+  *script->stats = stats;
+
+  return (stats.timeouts != 0) ? TRUE : FALSE;
+}
+
+/** \brief Send the timing of the scripts run so far over the UART.
+ * One line per script, the times are STM0 ticks of its last run.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup InitSeq
+ */
+void INITSEQ_Report(void)
+{
+  for (uint32 i = 0; i < INITSEQ_numScripts; i++)
+  {
+    const INITSEQ_Script *script = INITSEQ_scripts[i];
+    const INITSEQ_Stats  *stats  = script->stats;
+
+    REPORT_String("INITSEQ ");
+    REPORT_String(script->name);
+    REPORT_String(" steps=");
+    REPORT_Dec32(script->numSteps);
+    REPORT_String(" runs=");
+    REPORT_Dec32(stats->runs);
+    REPORT_String(" ticks=");
+    REPORT_Dec32(stats->ticks);
+    REPORT_String(" unlocks=");
+    REPORT_Dec32(stats->unlocks);
+    REPORT_String(" merged=");
+    REPORT_Dec32(stats->merged);
+    REPORT_String(" slowest=");
+    REPORT_Dec32(stats->maxStep);
+    REPORT_String(" slowticks=");
+    REPORT_Dec32(stats->maxTicks);
+    REPORT_String(" timeouts=");
+    REPORT_Dec32(stats->timeouts);
+    REPORT_NewLine();
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
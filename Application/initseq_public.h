@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * \file initseq_public.h
+ * \brief table-driven register initialisation
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef INITSEQ_PUBLIC_H
+#define INITSEQ_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define INITSEQ_MAX_SCRIPTS 8u    /**< \brief scripts listed by INITSEQ_Report */
+#define INITSEQ_WAIT_US     1000u /**< \brief time a wait step polls before it gives up */
+
+/** \brief Operation of a step */
+typedef enum
+{
+  initseq_Op_write = 0,  /**< \brief write value to the register */
+  initseq_Op_modify,     /**< \brief replace the bits in mask by value, one load-modify-store */
+  initseq_Op_wait,       /**< \brief poll until the bits in mask equal value */
+  initseq_Op_unlock,     /**< \brief clear ENDINIT, value selects the watchdog */
+  initseq_Op_lock,       /**< \brief set ENDINIT again, value selects the watchdog */
+} initseq_Op;
+
+/** \brief Watchdog whose ENDINIT opens the window of an unlock or lock step */
+typedef enum
+{
+  initseq_Endinit_cpu = 0,  /**< \brief CPU watchdog of the executing core */
+  initseq_Endinit_safety,   /**< \brief safety watchdog */
+} initseq_Endinit;
+
+/** \brief One step of a script, kept in flash */
+typedef struct
+{
+  initseq_Op     op;        /**< \brief operation */
+  volatile void *regAddr;   /**< \brief register, NULL_PTR for unlock and lock */
+  uint32         mask;      /**< \brief bits changed by modify resp. compared by wait */
+  uint32         value;     /**< \brief register value, watchdog for unlock and lock */
+} INITSEQ_Step;
+
+/** \brief Timing of the last run of a script, STM0 ticks */
+typedef struct
+{
+  uint32 ticks;       /**< \brief whole run */
+  uint32 maxTicks;    /**< \brief slowest step */
+  uint16 maxStep;     /**< \brief index of the slowest step */
+  uint16 unlocks;     /**< \brief ENDINIT windows opened */
+  uint16 merged;      /**< \brief windows saved by joining adjacent ones */
+  uint16 timeouts;    /**< \brief wait steps which gave up */
+  uint16 runs;        /**< \brief number of runs */
+} INITSEQ_Stats;
+
+/** \brief Script, the steps in flash and the statistics in RAM */
+typedef struct
+{
+  const char         *name;      /**< \brief name in the report */
+  const INITSEQ_Step *steps;     /**< \brief steps in execution order */
+  uint16              numSteps;  /**< \brief entries in steps[] */
+  INITSEQ_Stats      *stats;     /**< \brief timing of the last run */
+} INITSEQ_Script;
+
+/** \brief Value of a bit field, e.g. INITSEQ_FIELD(ASCLIN, FRAMECON, MODE, 1) */
+#define INITSEQ_FIELD(module, reg, field, value) \
+  (((uint32)(value) & IFX_##module##_##reg##_##field##_MSK) << IFX_##module##_##reg##_##field##_OFF)
+
+/** \brief Mask of a bit field, e.g. INITSEQ_MASK(ASCLIN, FRAMECON, MODE) */
+#define INITSEQ_MASK(module, reg, field) \
+  ((uint32)IFX_##module##_##reg##_##field##_MSK << IFX_##module##_##reg##_##field##_OFF)
+
+/** \brief Step entries, reg is the register as defined in the _reg.h files */
+#define INITSEQ_WRITE(reg, value)        {initseq_Op_write, &(reg), 0xFFFFFFFFu, (uint32)(value)}
+#define INITSEQ_MODIFY(reg, mask, value) {initseq_Op_modify, &(reg), (uint32)(mask), (uint32)(value)}
+#define INITSEQ_WAIT(reg, mask, value)   {initseq_Op_wait, &(reg), (uint32)(mask), (uint32)(value)}
+#define INITSEQ_UNLOCK(endinit)          {initseq_Op_unlock, NULL_PTR, 0u, (uint32)(endinit)}
+#define INITSEQ_LOCK(endinit)            {initseq_Op_lock, NULL_PTR, 0u, (uint32)(endinit)}
+
+/** \brief Script entry for a step array */
+#define INITSEQ_SCRIPT(name, steps, stats) \
+  {(name), (steps), (uint16)(sizeof(steps) / sizeof((steps)[0])), &(stats)}
+
+/** \brief Execute the steps of a script and time them.
+ * A lock step which is followed by an unlock step of the same watchdog,
+ * with nothing but wait steps between them, keeps the window open, so
+ * windows written per register are opened once. A window left open at the
+ * end of the script is closed.
+ *
+ * \param script script to run
+ * \return TRUE if a wait step gave up, the remaining steps are executed anyway
+ *
+ *  \ingroup InitSeq
+ */
+extern boolean INITSEQ_Run(const INITSEQ_Script *script);
+
+/** \brief Send the timing of the scripts run so far over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup InitSeq
+ */
+extern void INITSEQ_Report(void);
+
+#endif	/* end of file */
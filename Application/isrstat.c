@@ -0,0 +1,435 @@
+/*******************************************************************************
+ * \file isrstat.c
+ * \brief Per vector interrupt latency and duration statistics
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Ifx_reg.h"
+#include "IfxSrc_bf.h"
+
+#include "report_public.h"
+#include "isrstat_public.h"
+
+#define ISRSTAT_NUM_SRPN 256u  /**< \brief SRPN 0 to 255 */
+
+/** \brief Statistics of one core */
+typedef struct
+{
+  uint8          slot[ISRSTAT_NUM_SRPN];     /**< \brief 1 + index into vector, 0 if not recorded */
+  uint32         used;                       /**< \brief entries of vector in use */
+  uint32         overflow;                   /**< \brief runs not recorded, vector table full */
+  uint32         busyCycles;                 /**< \brief handler cycles of all vectors, wraps */
+  uint32         pendingSrpn;                /**< \brief request raised by ISRSTAT_Trigger */
+  uint32         pendingStamp;               /**< \brief clock counter at the request */
+  boolean        pending;                    /**< \brief pendingSrpn and pendingStamp are valid */
+  volatile uint32 sequence;                  /**< \brief odd while the owning core updates the tables */
+  volatile uint32 resetRequests;             /**< \brief ISRSTAT_Reset calls, written by any core */
+  uint32         resets;                     /**< \brief requests applied by the owning core */
+  ISRSTAT_Vector vector[ISRSTAT_VECTORS];
+} ISRSTAT_Core;
+
+/** \addtogroup IsrStat_Variables */
+/* private data */
+/* Written by the handlers of the owning core only, the other cores read
+ * them under the sequence and request a reset through resetRequests */
+static ISRSTAT_Core ISRSTAT_cores[IFXCPU_NUM_MODULES];
+
+static const ISRSTAT_Metric ISRSTAT_empty;
+
+/* private functions */
+
+/** \brief Add one measurement.
+ *
+ * \param metric statistics to update
+ * \param cycles measured value
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+static void ISRSTAT_Add(ISRSTAT_Metric *metric, uint32 cycles)
+{
+  uint32 bucket = 0;
+
+  if (cycles != 0)
+  {
+    bucket = 32u - (uint32)__clz((sint32)cycles);
+    if (bucket >= ISRSTAT_BUCKETS)
+    {
+      bucket = ISRSTAT_BUCKETS - 1u;
+    }
+  }
+
+  if ((metric->count == 0) || (cycles < metric->min))
+  {
+    metric->min = cycles;
+  }
+  if (cycles > metric->max)
+  {
+    metric->max = cycles;
+  }
+  metric->count++;
+  metric->sum += cycles;
+  metric->histogram[bucket]++;
+}
+
+/** \brief Clear the measurements of the calling core if a reset has been requested.
+ * Runs on the owning core with interrupts disabled and an odd sequence.
+ * The vectors keep their entries, only the measurements are cleared.
+ *
+ * \param core statistics of the calling core
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+static void ISRSTAT_ApplyReset(ISRSTAT_Core *core)
+{
+  uint32 requests = core->resetRequests;
+
+  if (core->resets != requests)
+  {
+    for (uint32 i = 0; i < core->used; i++)
+    {
+      core->vector[i].duration = ISRSTAT_empty;
+      core->vector[i].latency  = ISRSTAT_empty;
+    }
+    core->overflow = 0;
+    core->pending  = FALSE;
+    core->resets   = requests;
+  }
+}
+
+/** \brief Send one metric over the UART.
+ * "ISR <cpu> <srpn> <name> n=<count> min=<min> mean=<mean> max=<max> h=<buckets>"
+ *
+ * \param cpu core serving the vector
+ * \param srpn priority of the vector
+ * \param name name of the metric
+ * \param metric statistics to send
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+static void ISRSTAT_ReportMetric(uint32 cpu, uint32 srpn, const char *name, const ISRSTAT_Metric *metric)
+{
+  REPORT_String("ISR ");
+  REPORT_Dec32(cpu);
+  REPORT_String(" ");
+  REPORT_Dec32(srpn);
+  REPORT_String(" ");
+  REPORT_String(name);
+  REPORT_String(" n=");
+  REPORT_Dec32(metric->count);
+  if (metric->count != 0)
+  {
+    REPORT_String(" min=");
+    REPORT_Dec32(metric->min);
+    REPORT_String(" mean=");
+    REPORT_Dec32((uint32)(metric->sum / metric->count));
+    REPORT_String(" max=");
+    REPORT_Dec32(metric->max);
+    REPORT_String(" h=");
+    for (uint32 i = 0; i < ISRSTAT_BUCKETS; i++)
+    {
+      if (i != 0)
+      {
+        REPORT_String(",");
+      }
+      REPORT_Dec32(metric->histogram[i]);
+    }
+  }
+  REPORT_NewLine();
+}
+
+/* global functions */
+
+/** \brief Start the CPU clock counter of the calling core.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+void ISRSTAT_InitCore(void)
+{
+  IfxCpu_setPerformanceCountersEnableBit(1);
+}
+
+/** \brief Account one handler run.
+ * Runs in the handler with interrupts disabled, so the tables of a core
+ * need no locking. A reset requested by another core is applied first.
+ *
+ * \param srpn priority of the vector
+ * \param entry clock counter at handler entry
+ * \param exit clock counter at handler exit
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+void ISRSTAT_Record(uint32 srpn, uint32 entry, uint32 exit)
+{
+  ISRSTAT_Core   *core   = &ISRSTAT_cores[IfxCpu_getCoreIndex()];
+  ISRSTAT_Vector *vector;
+  uint32          slot   = core->slot[srpn & (ISRSTAT_NUM_SRPN - 1u)];
+  uint32          cycles = (exit - entry) & ISRSTAT_CCNT_MASK;
+
+  core->busyCycles += cycles;
+
+  /* readers on the other cores retry while the sequence is odd or has changed */
+  core->sequence++;
+  __dsync();
+  ISRSTAT_ApplyReset(core);
+
+  if (slot == 0)
+  {
+    if (core->used >= ISRSTAT_VECTORS)
+    {
+      core->overflow++;
+      __dsync();
+      core->sequence++;
+      return;
+    }
+    core->vector[core->used].srpn = srpn;
+    core->used++;
+    slot                                       = core->used;
+    core->slot[srpn & (ISRSTAT_NUM_SRPN - 1u)] = (uint8)slot;
+  }
+
+  vector = &core->vector[slot - 1u];
+  ISRSTAT_Add(&vector->duration, cycles);
+
+  if ((core->pending != FALSE) && (core->pendingSrpn == srpn))
+  {
+    ISRSTAT_Add(&vector->latency, (entry - core->pendingStamp) & ISRSTAT_CCNT_MASK);
+    core->pending = FALSE;
+  }
+
+  __dsync();
+  core->sequence++;
+}
+
+/** \brief Raise a service request by software and stamp the request time.
+ * The stamp is taken with interrupts disabled right before SETR, so the
+ * latency starts when the caller reenables them. Calling with interrupts
+ * disabled adds the masked time to the latency. A node served by another
+ * core or the DMA is raised without a stamp.
+ *
+ * \param src service request node, configured and enabled
+ * \return TRUE if the latency of the request will be measured
+ *
+ *  \ingroup IsrStat
+ */
+boolean ISRSTAT_Trigger(volatile Ifx_SRC_SRCR *src)
+{
+  uint32        cpu  = IfxCpu_getCoreIndex();
+  ISRSTAT_Core *core = &ISRSTAT_cores[cpu];
+  Ifx_SRC_SRCR  srcr;
+  boolean       stamp;
+  boolean       enabled;
+
+  srcr.U = src->U;
+  if (srcr.B.SRE == 0)
+  {
+    return FALSE;
+  }
+
+  /* write back the configuration only, CLRR, IOVCLR and SWSCLR stay 0 */
+  srcr.U &= ((uint32)IFX_SRC_SRCR_SRPN_MSK << IFX_SRC_SRCR_SRPN_OFF) |
+            ((uint32)IFX_SRC_SRCR_SRE_MSK << IFX_SRC_SRCR_SRE_OFF) |
+            ((uint32)IFX_SRC_SRCR_TOS_MSK << IFX_SRC_SRCR_TOS_OFF) |
+            ((uint32)IFX_SRC_SRCR_ECC_MSK << IFX_SRC_SRCR_ECC_OFF);
+  srcr.U |= (uint32)IFX_SRC_SRCR_SETR_MSK << IFX_SRC_SRCR_SETR_OFF;
+  stamp   = (boolean)(srcr.B.TOS == cpu);
+
+  enabled = IfxCpu_disableInterrupts();
+  if (stamp != FALSE)
+  {
+    core->pendingSrpn  = srcr.B.SRPN;
+    core->pending      = TRUE;
+    core->pendingStamp = IfxCpu_getClockCounter();
+  }
+  src->U = srcr.U;
+  IfxCpu_restoreInterrupts(enabled);
+
+  return stamp;
+}
+
+/** \brief Handler cycles of the calling core.
+ * Sum of all instrumented handler runs, modulo 2^32.
+ *
+ * \param None
+ * \return cycles spent in instrumented handlers
+ *
+ *  \ingroup IsrStat
+ */
+uint32 ISRSTAT_GetBusyCycles(void)
+{
+  return ISRSTAT_cores[IfxCpu_getCoreIndex()].busyCycles;
+}
+
+/** \brief Copy the statistics of one vector.
+ * The copy is taken again while the owning core updates the tables, a
+ * reset the owning core has not applied yet reads as cleared.
+ *
+ * \param cpu core serving the vector
+ * \param srpn priority of the vector
+ * \param stats receives the statistics
+ * \return TRUE if the vector has been recorded
+ *
+ *  \ingroup IsrStat
+ */
+boolean ISRSTAT_Get(uint32 cpu, uint32 srpn, ISRSTAT_Vector *stats)
+{
+  ISRSTAT_Core *core;
+  uint32        slot;
+  uint32        sequence;
+  boolean       resetPending;
+
+  if ((cpu >= IFXCPU_NUM_MODULES) || (srpn >= ISRSTAT_NUM_SRPN))
+  {
+    return FALSE;
+  }
+
+  core = &ISRSTAT_cores[cpu];
+  slot = core->slot[srpn];
+  if (slot == 0)
+  {
+    return FALSE;
+  }
+
+  do
+  {
+    sequence = core->sequence;
+    __dsync();
+    *stats       = core->vector[slot - 1u];
+    resetPending = (boolean)(core->resets != core->resetRequests);
+    __dsync();
+  } while (((sequence & 1u) != 0) || (core->sequence != sequence));
+
+  if (resetPending != FALSE)
+  {
+    stats->duration = ISRSTAT_empty;
+    stats->latency  = ISRSTAT_empty;
+  }
+  return TRUE;
+}
+
+/** \brief Clear the statistics of all cores.
+ * Every core clears its own tables: the calling core at once, the other
+ * cores in their next instrumented handler. Until then ISRSTAT_Get and
+ * ISRSTAT_Report show their tables as cleared.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+void ISRSTAT_Reset(void)
+{
+  ISRSTAT_Core *self = &ISRSTAT_cores[IfxCpu_getCoreIndex()];
+  boolean       enabled;
+
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    ISRSTAT_cores[cpu].resetRequests++;
+  }
+
+  enabled = IfxCpu_disableInterrupts();
+  self->sequence++;
+  __dsync();
+  ISRSTAT_ApplyReset(self);
+  __dsync();
+  self->sequence++;
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Send the statistics of all instrumented vectors over the UART.
+ * Two lines per vector, "dur" and "lat", values in CPU clock cycles.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+void ISRSTAT_Report(void)
+{
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    ISRSTAT_Core *core = &ISRSTAT_cores[cpu];
+    uint32        srpn[ISRSTAT_VECTORS];
+    uint32        used;
+    uint32        overflow;
+    uint32        sequence;
+
+    /* vector count, overflow and the vector list of one consistent state */
+    do
+    {
+      sequence = core->sequence;
+      __dsync();
+      used     = core->used;
+      overflow = (core->resets != core->resetRequests) ? 0u : core->overflow;
+      for (uint32 i = 0; i < used; i++)
+      {
+        srpn[i] = core->vector[i].srpn;
+      }
+      __dsync();
+    } while (((sequence & 1u) != 0) || (core->sequence != sequence));
+
+    REPORT_String("ISR cpu=");
+    REPORT_Dec32(cpu);
+    REPORT_String(" vectors=");
+    REPORT_Dec32(used);
+    REPORT_String(" overflow=");
+    REPORT_Dec32(overflow);
+    REPORT_NewLine();
+
+    for (uint32 i = 0; i < used; i++)
+    {
+      ISRSTAT_Vector stats;
+
+      if (ISRSTAT_Get(cpu, srpn[i], &stats) != FALSE)
+      {
+        ISRSTAT_ReportMetric(cpu, stats.srpn, "dur", &stats.duration);
+        ISRSTAT_ReportMetric(cpu, stats.srpn, "lat", &stats.latency);
+      }
+    }
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,180 @@
+/*******************************************************************************
+ * \file isrstat_public.h
+ * \brief Per vector interrupt latency and duration statistics
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef ISRSTAT_PUBLIC_H
+#define ISRSTAT_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "Compilers.h"
+#include "IfxCpu.h"
+#include "Ifx_reg.h"
+#include "trace_public.h"
+
+#ifndef ISRSTAT_ENABLED
+#define ISRSTAT_ENABLED 1   /**< \brief 0 turns IFX_INTERRUPT_STAT into IFX_INTERRUPT */
+#endif
+
+#define ISRSTAT_VECTORS    16u  /**< \brief instrumented vectors per core */
+#define ISRSTAT_BUCKETS    16u  /**< \brief log2 buckets, the last one collects everything above */
+#define ISRSTAT_CCNT_MASK  ((uint32)0x7FFFFFFFu)  /**< \brief width of the CPU clock counter */
+
+/** \brief Statistics of one measured quantity, in CPU clock cycles */
+typedef struct
+{
+  uint32 count;                      /**< \brief number of measurements */
+  uint32 min;                        /**< \brief shortest, valid if count != 0 */
+  uint32 max;                        /**< \brief longest */
+  uint64 sum;                        /**< \brief sum for the mean */
+  uint32 histogram[ISRSTAT_BUCKETS]; /**< \brief bucket n holds values from 2^(n-1) to 2^n - 1 */
+} ISRSTAT_Metric;
+
+/** \brief Statistics of one interrupt vector */
+typedef struct
+{
+  uint32         srpn;      /**< \brief service request priority number */
+  ISRSTAT_Metric duration;  /**< \brief handler entry to handler exit */
+  ISRSTAT_Metric latency;   /**< \brief request to handler entry, requests of ISRSTAT_Trigger only */
+} ISRSTAT_Vector;
+
+/** \brief Interrupt handler with latency and duration accounting.
+ * Drop-in replacement of IFX_INTERRUPT, used the same way:
+ *
+ *   IFX_INTERRUPT_STAT(MyISR, VECTAB0, SRPN_MY_ISR);
+ *   void MyISR(void)
+ *   {
+ *   }
+ *
+ * The vector enters isr##_Stat, which stamps the CPU clock counter, calls
+ * the handler and records the result under the SRPN of the vector. Entry
+ * and exit are also trace events.
+ *
+ *  \ingroup IsrStat
+ */
+#if ISRSTAT_ENABLED
+#define IFX_INTERRUPT_STAT(isr, vectabNum, prio)                       \
+  void isr(void);                                                      \
+  IFX_INTERRUPT(isr##_Stat, vectabNum, prio);                          \
+  void isr##_Stat(void)                                                \
+  {                                                                    \
+    uint32 isrstatEntry = IfxCpu_getClockCounter();                    \
+    TRACE(trace_Event_isrEnter, (prio), 0);                            \
+    isr();                                                             \
+    TRACE(trace_Event_isrExit, (prio), 0);                             \
+    ISRSTAT_Record((prio), isrstatEntry, IfxCpu_getClockCounter());    \
+  }                                                                    \
+  void isr(void)
+#else
+#define IFX_INTERRUPT_STAT(isr, vectabNum, prio) IFX_INTERRUPT(isr, vectabNum, prio)
+#endif
+
+/** \brief Start the CPU clock counter of the calling core.
+ * Each core has its own counter, call this once on every core.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+extern void ISRSTAT_InitCore(void);
+
+/** \brief Account one handler run, called by IFX_INTERRUPT_STAT.
+ *
+ * \param srpn priority of the vector
+ * \param entry clock counter at handler entry
+ * \param exit clock counter at handler exit
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+extern void ISRSTAT_Record(uint32 srpn, uint32 entry, uint32 exit);
+
+/** \brief Raise a service request by software and stamp the request time.
+ * Hardware requests carry no time stamp, the latency statistics therefore
+ * only cover requests raised here. Only requests to the calling core are
+ * stamped, the clock counters of the cores are not synchronised; a node
+ * served by another core or the DMA is raised without a stamp.
+ *
+ * \param src service request node, configured and enabled
+ * \return TRUE if the latency of the request will be measured
+ *
+ *  \ingroup IsrStat
+ */
+extern boolean ISRSTAT_Trigger(volatile Ifx_SRC_SRCR *src);
+
+/** \brief Handler cycles of the calling core.
+ * Sum of all instrumented handler runs, modulo 2^32. The difference of two
+ * calls is the interrupt time in between.
+ *
+ * \param None
+ * \return cycles spent in instrumented handlers
+ *
+ *  \ingroup IsrStat
+ */
+extern uint32 ISRSTAT_GetBusyCycles(void);
+
+/** \brief Copy the statistics of one vector.
+ * The copy is consistent, it is repeated while the owning core updates
+ * the tables.
+ *
+ * \param cpu core serving the vector
+ * \param srpn priority of the vector
+ * \param stats receives the statistics
+ * \return TRUE if the vector has been recorded
+ *
+ *  \ingroup IsrStat
+ */
+extern boolean ISRSTAT_Get(uint32 cpu, uint32 srpn, ISRSTAT_Vector *stats);
+
+/** \brief Clear the statistics of all cores.
+ * The other cores clear their own tables in their next instrumented
+ * handler, their statistics read as cleared until then.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+extern void ISRSTAT_Reset(void);
+
+/** \brief Send the statistics of all instrumented vectors over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup IsrStat
+ */
+extern void ISRSTAT_Report(void);
+
+#endif	/* end of file */
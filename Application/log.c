@@ -0,0 +1,315 @@
+/*******************************************************************************
+ * \file log.c
+ * \brief Deferred formatting logger, the text is built on the host
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Ifx_reg.h"
+#include "NoClearDef.h"
+
+#include "log_public.h"
+#include "uarttx_public.h"
+
+#define LOG_FRAME_HEADER 3u  /**< \brief sync bytes and message count */
+#define LOG_FRAME_SIZE   (LOG_FRAME_HEADER + (LOG_FRAME_MSGS * sizeof(LOG_Message)) + 1u)
+
+/** \brief Ring indices of one core, one writer and the drain on CPU0 as reader */
+typedef struct
+{
+  volatile uint32 head;      /**< \brief next message to write, free running */
+  volatile uint32 tail;      /**< \brief next message to send, free running */
+  volatile uint32 dropped;   /**< \brief messages lost, ring full */
+  uint32          reported;  /**< \brief dropped count already sent */
+  uint16          sequence;  /**< \brief number of the next message */
+} LOG_Ring;
+
+/** \addtogroup Log_Variables */
+/* Messages in the DSPR of the logging core, only valid between tail and head */
+NOCLEAR_BEGIN(cpu0)
+LOG_Message LOG_messages0[LOG_RING_SIZE];
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu1)
+LOG_Message LOG_messages1[LOG_RING_SIZE];
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu2)
+LOG_Message LOG_messages2[LOG_RING_SIZE];
+NOCLEAR_END
+
+#define LOG_MODULE_DEFAULT(name) LOG_DEFAULT_MASK,
+
+volatile uint8 LOG_masks[log_Module_count] =
+{
+  LOG_MODULES(LOG_MODULE_DEFAULT)
+};
+
+/* private data */
+static LOG_Message * const LOG_messages[IFXCPU_NUM_MODULES] =
+{
+  LOG_messages0,
+  LOG_messages1,
+  LOG_messages2,
+};
+
+/* STMn is read by CPUn, the STMs of the cores run synchronously */
+static Ifx_STM * const LOG_stm[IFXCPU_NUM_MODULES] =
+{
+  &MODULE_STM0,
+  &MODULE_STM1,
+  &MODULE_STM2,
+};
+
+static LOG_Ring LOG_rings[IFXCPU_NUM_MODULES];
+static uint32   LOG_nextRing;
+static uint8    LOG_frame[LOG_FRAME_SIZE];
+
+/* private functions */
+
+/** \brief Append a message to the frame.
+ *
+ * \param pos write position in the frame
+ * \param message message to append
+ * \return position behind the message
+ *
+ *  \ingroup Log
+ */
+static uint32 LOG_Append(uint32 pos, const LOG_Message *message)
+{
+  const uint8 *src = (const uint8 *)message;
+
+  for (uint32 i = 0; i < sizeof(LOG_Message); i++)
+  {
+    LOG_frame[pos++] = src[i];
+  }
+
+  return pos;
+}
+
+/** \brief Value of a hexadecimal digit.
+ *
+ * \param c character
+ * \return value 0 to 15, 16 if c is not a hexadecimal digit
+ *
+ *  \ingroup Log
+ */
+static uint32 LOG_HexDigit(uint8 c)
+{
+  if ((c >= '0') && (c <= '9'))
+  {
+    return (uint32)(c - '0');
+  }
+  if ((c >= 'A') && (c <= 'F'))
+  {
+    return (uint32)(c - 'A' + 10);
+  }
+  if ((c >= 'a') && (c <= 'f'))
+  {
+    return (uint32)(c - 'a' + 10);
+  }
+  return 16u;
+}
+
+/* global functions */
+
+/** \brief Set the runtime mask of a module.
+ *
+ * \param module module to change
+ * \param mask bit n enables level n
+ * \return None
+ *
+ *  \ingroup Log
+ */
+void LOG_SetMask(log_Module module, uint8 mask)
+{
+  if (module < log_Module_count)
+  {
+    LOG_masks[module] = mask;
+  }
+}
+
+/** \brief Apply a mask command received over the UART.
+ *
+ * \param cmd received bytes
+ * \param len number of received bytes
+ * \return TRUE if the command was valid and has been applied
+ *
+ *  \ingroup Log
+ */
+boolean LOG_Command(const uint8 *cmd, uint16 len)
+{
+  uint32 module;
+  uint32 high;
+  uint32 low;
+
+  if ((len < LOG_COMMAND_SIZE) || (cmd[0] != 'L') || (cmd[1] != 'O') || (cmd[2] != 'G') ||
+      (cmd[3] != ' ') || (cmd[5] != ' '))
+  {
+    return FALSE;
+  }
+
+  module = (uint32)(cmd[4] - '0');
+  high   = LOG_HexDigit(cmd[6]);
+  low    = LOG_HexDigit(cmd[7]);
+  if ((module >= log_Module_count) || (high > 15u) || (low > 15u))
+  {
+    return FALSE;
+  }
+
+  LOG_SetMask((log_Module)module, (uint8)((high << 4) | low));
+  return TRUE;
+}
+
+/** \brief Queue a message on the calling core.
+ * Only the address of the format string and the argument words are
+ * stored, nothing is formatted.
+ *
+ * \param fmt format string
+ * \param numArgs number of valid arguments
+ * \param a1 first argument word
+ * \param a2 second argument word
+ * \param a3 third argument word
+ * \param a4 fourth argument word
+ * \return None
+ *
+ *  \ingroup Log
+ */
+void LOG_Write(const char *fmt, uint32 numArgs, uint32 a1, uint32 a2, uint32 a3, uint32 a4)
+{
+  uint32    cpu     = IfxCpu_getCoreIndex();
+  LOG_Ring *ring    = &LOG_rings[cpu];
+  boolean   enabled = IfxCpu_disableInterrupts();
+  uint32    head    = ring->head;
+
+  if ((head - ring->tail) < LOG_RING_SIZE)
+  {
+    LOG_Message *message = &LOG_messages[cpu][head & (LOG_RING_SIZE - 1u)];
+    Ifx_STM     *stm     = LOG_stm[cpu];
+
+    message->stmLow   = stm->TIM0.U;
+    message->stmHigh  = stm->CAP.U;
+    message->fmt      = (uint32)fmt;
+    message->cpu      = (uint8)cpu;
+    message->numArgs  = (uint8)numArgs;
+    message->sequence = ring->sequence;
+    message->args[0]  = a1;
+    message->args[1]  = a2;
+    message->args[2]  = a3;
+    message->args[3]  = a4;
+    /* the message must be visible to CPU0 before the index */
+    __dsync();
+    ring->head = head + 1u;
+  }
+  else
+  {
+    ring->dropped++;
+  }
+  ring->sequence++;
+
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Send one frame of queued messages if the telemetry transmit queue has room.
+ * Frame: LOG_SYNC0, LOG_SYNC1, number of messages, the messages, 8 bit sum
+ * of the messages. Decode with Tools/log_decode.py.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Log
+ */
+void LOG_Drain(void)
+{
+  uint32 pos   = LOG_FRAME_HEADER;
+  uint32 count = 0;
+  uint8  sum   = 0;
+
+  if (UARTTX_GetFree(uarttx_Class_telemetry) < LOG_FRAME_SIZE)
+  {
+    return;
+  }
+
+  for (uint32 n = 0; (n < IFXCPU_NUM_MODULES) && (count < LOG_FRAME_MSGS); n++)
+  {
+    uint32    cpu     = (LOG_nextRing + n) % IFXCPU_NUM_MODULES;
+    LOG_Ring *ring    = &LOG_rings[cpu];
+    uint32    head    = ring->head;
+    uint32    tail    = ring->tail;
+    uint32    dropped = ring->dropped;
+
+    if (dropped != ring->reported)
+    {
+      LOG_Message message = {0};
+
+      message.cpu     = (uint8)cpu;
+      message.numArgs = 1u;
+      message.args[0] = dropped - ring->reported;
+      pos             = LOG_Append(pos, &message);
+      ring->reported  = dropped;
+      count++;
+    }
+
+    while ((tail != head) && (count < LOG_FRAME_MSGS))
+    {
+      pos = LOG_Append(pos, &LOG_messages[cpu][tail & (LOG_RING_SIZE - 1u)]);
+      tail++;
+      count++;
+    }
+    ring->tail = tail;
+  }
+  LOG_nextRing = (LOG_nextRing + 1u) % IFXCPU_NUM_MODULES;
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  for (uint32 i = LOG_FRAME_HEADER; i < pos; i++)
+  {
+    sum += LOG_frame[i];
+  }
+
+  LOG_frame[0]     = LOG_SYNC0;
+  LOG_frame[1]     = LOG_SYNC1;
+  LOG_frame[2]     = (uint8)count;
+  LOG_frame[pos++] = sum;
+
+  (void)UARTTX_Send(uarttx_Class_telemetry, LOG_frame, (uint16)pos);
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * \file log_public.h
+ * \brief Deferred formatting logger, the text is built on the host
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef LOG_PUBLIC_H
+#define LOG_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "LogDef.h"
+
+#define LOG_MAX_ARGS     4u     /**< \brief argument words per message */
+#define LOG_RING_SIZE    32u    /**< \brief messages per core, power of 2 */
+#define LOG_FRAME_MSGS   6u     /**< \brief messages per UART frame, fits the ASCLIN3 transmit buffer */
+#define LOG_SYNC0        0xA5u  /**< \brief first frame byte, shared with the event trace */
+#define LOG_SYNC1        0x5Bu  /**< \brief second frame byte */
+#define LOG_COMMAND_SIZE 10u    /**< \brief mask command "LOG m hh\r\n" */
+
+#define LOG_MODULE_ENUM(name) log_Module_##name,
+
+/** \brief Modules with a runtime mask, see LOG_MODULES in LogDef.h */
+typedef enum
+{
+  LOG_MODULES(LOG_MODULE_ENUM)
+  log_Module_count
+} log_Module;
+
+/** \brief One message as stored in the ring and sent in a frame, little endian.
+ * fmt is the address of the format string, the host reads it from the ELF
+ * file. fmt 0 reports lost messages, args[0] holds their number.
+ */
+typedef struct
+{
+  uint32 stmLow;              /**< \brief STM bits 0 to 31 */
+  uint32 stmHigh;             /**< \brief STM bits 32 to 63 */
+  uint32 fmt;                 /**< \brief address of the format string */
+  uint8  cpu;                 /**< \brief logging core */
+  uint8  numArgs;             /**< \brief valid entries of args */
+  uint16 sequence;            /**< \brief message number of the core, shows gaps */
+  uint32 args[LOG_MAX_ARGS];  /**< \brief raw argument words */
+} LOG_Message;
+
+/** \brief Log a message with up to four integer arguments.
+ * The format string must be a literal, it stays in flash and is never
+ * touched on the target. %d %i %u %x %X %c %p are integers, %f takes a
+ * LOG_FLOAT argument, %s a pointer to a constant string in flash.
+ *
+ *   LOG("baud rate %u, error %d", baud, err);
+ */
+#define LOG(...)  LOG_SELECT(__VA_ARGS__, LOG_4, LOG_3, LOG_2, LOG_1, LOG_0, LOG_0)(__VA_ARGS__)
+
+/** \brief Log at a level, if the level is compiled in and enabled for the module.
+ * LOG_LEVEL in LogDef.h removes the calls of the higher levels completely.
+ *
+ *   LOG_ERROR(log_Module_asclin, "framing error, flags 0x%08X", flags);
+ */
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(module, ...)   LOG_AT((module), LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(module, ...)   do { } while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(module, ...)    LOG_AT((module), LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(module, ...)    do { } while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(module, ...)    LOG_AT((module), LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(module, ...)    do { } while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(module, ...)   LOG_AT((module), LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(module, ...)   do { } while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_VERBOSE
+#define LOG_VERBOSE(module, ...) LOG_AT((module), LOG_LEVEL_VERBOSE, __VA_ARGS__)
+#else
+#define LOG_VERBOSE(module, ...) do { } while (0)
+#endif
+
+/* runtime filter, not for direct use */
+#define LOG_AT(module, level, ...)                       \
+  do                                                     \
+  {                                                      \
+    if ((LOG_masks[(module)] & (1u << (level))) != 0)    \
+    {                                                    \
+      LOG(__VA_ARGS__);                                  \
+    }                                                    \
+  } while (0)
+
+/** \brief Raw bits of a float32 argument for %f */
+#define LOG_FLOAT(value) LOG_FloatBits(value)
+
+/* argument counting, not for direct use */
+#define LOG_SELECT(fmt, a1, a2, a3, a4, name, ...) name
+#define LOG_0(fmt)                 LOG_Write((fmt), 0u, 0u, 0u, 0u, 0u)
+#define LOG_1(fmt, a1)             LOG_Write((fmt), 1u, (uint32)(a1), 0u, 0u, 0u)
+#define LOG_2(fmt, a1, a2)         LOG_Write((fmt), 2u, (uint32)(a1), (uint32)(a2), 0u, 0u)
+#define LOG_3(fmt, a1, a2, a3)     LOG_Write((fmt), 3u, (uint32)(a1), (uint32)(a2), (uint32)(a3), 0u)
+#define LOG_4(fmt, a1, a2, a3, a4) LOG_Write((fmt), 4u, (uint32)(a1), (uint32)(a2), (uint32)(a3), (uint32)(a4))
+
+/** \brief Runtime masks per module, bit n enables level n */
+extern volatile uint8 LOG_masks[log_Module_count];
+
+/** \brief Raw bits of a float32.
+ *
+ * \param value value to log
+ * \return IEEE 754 bits of value
+ *
+ *  \ingroup Log
+ */
+IFX_INLINE uint32 LOG_FloatBits(float32 value)
+{
+  union
+  {
+    float32 f;
+    uint32  u;
+  } bits;
+
+  bits.f = value;
+  return bits.u;
+}
+
+/** \brief Queue a message on the calling core, use the LOG macro.
+ *
+ * \param fmt format string
+ * \param numArgs number of valid arguments
+ * \param a1 first argument word
+ * \param a2 second argument word
+ * \param a3 third argument word
+ * \param a4 fourth argument word
+ * \return None
+ *
+ *  \ingroup Log
+ */
+extern void LOG_Write(const char *fmt, uint32 numArgs, uint32 a1, uint32 a2, uint32 a3, uint32 a4);
+
+/** \brief Set the runtime mask of a module.
+ *
+ * \param module module to change
+ * \param mask bit n enables level n
+ * \return None
+ *
+ *  \ingroup Log
+ */
+extern void LOG_SetMask(log_Module module, uint8 mask);
+
+/** \brief Apply a mask command received over the UART.
+ * The command is "LOG m hh\r\n": module number m, mask hh in hex.
+ *
+ * \param cmd received bytes
+ * \param len number of received bytes
+ * \return TRUE if the command was valid and has been applied
+ *
+ *  \ingroup Log
+ */
+extern boolean LOG_Command(const uint8 *cmd, uint16 len);
+
+/** \brief Send one frame of queued messages if the UART is idle.
+ * Never blocks, call it from the idle loop of CPU0.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Log
+ */
+extern void LOG_Drain(void);
+
+#endif	/* end of file */
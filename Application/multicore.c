@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * \file multicore.c
+ * \brief multi-core barrier and parallel initialisation framework
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxScuCcu.h"
+#include "IfxStm_reg.h"
+
+#include "multicore_public.h"
+
+/** \addtogroup MultiCore_Variables */
+/* private data */
+/* stage barrier of MULTICORE_RunInit, shared by all cores */
+static MULTICORE_Barrier MULTICORE_stageBarrier = MULTICORE_BARRIER_INIT(MULTICORE_NUM_CORES);
+
+/* owner of the safety ENDINIT window and the password it was opened with */
+static IfxCpu_mutexLock MULTICORE_safetyLock;
+static uint16           MULTICORE_safetyPassword;
+
+/* global functions */
+
+/** \brief Wait until all cores have arrived at the barrier.
+ *
+ * \param barrier barrier shared by the cores
+ * \param timeoutMilliSec timeout in milliseconds, 0 waits forever
+ * \return TRUE on timeout
+ *
+ *  \ingroup MultiCore
+ */
+boolean MULTICORE_BarrierWait(MULTICORE_Barrier *barrier, uint32 timeoutMilliSec)
+{
+  /* the sense has to be read before arriving, the last core may flip it at any time after that */
+  uint32  mySense = barrier->sense ^ 1u;
+  uint32  arrived;
+  boolean timeout = FALSE;
+
+  do
+  {
+    arrived = barrier->count;
+  } while ((uint32)__cmpAndSwap((unsigned int *)&barrier->count, arrived + 1u, arrived) != arrived);
+
+  if ((arrived + 1u) == barrier->numCores)
+  {
+    /* last core: reopen the barrier for the next round */
+    barrier->count = 0;
+    __dsync();
+    barrier->sense = mySense;
+  }
+  else
+  {
+    uint32 stmCount      = (uint32)((IfxScuCcu_getStmFrequency() / 1000) * timeoutMilliSec);
+    uint32 stmCountBegin = STM0_TIM0.U;
+
+    while (barrier->sense != mySense)
+    {
+      __nop();
+
+      if ((timeoutMilliSec != 0) && ((uint32)(STM0_TIM0.U - stmCountBegin) >= stmCount))
+      {
+        timeout = TRUE;
+        break;
+      }
+    }
+  }
+
+  return timeout;
+}
+
+/** \brief Clear the safety ENDINIT, shared by all cores.
+ * The password is read under the lock, another core may be changing CON0.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+void MULTICORE_OpenSafetyEndinit(void)
+{
+  while (IfxCpu_acquireMutex(&MULTICORE_safetyLock) == FALSE)
+    ;
+
+  MULTICORE_safetyPassword = IfxScuWdt_getSafetyWatchdogPassword();
+  IfxScuWdt_clearSafetyEndinit(MULTICORE_safetyPassword);
+}
+
+/** \brief Set the safety ENDINIT again and release the window.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+void MULTICORE_CloseSafetyEndinit(void)
+{
+  IfxScuWdt_setSafetyEndinit(MULTICORE_safetyPassword);
+  IfxCpu_releaseMutex(&MULTICORE_safetyLock);
+}
+
+/** \brief Execute the jobs of the calling core, stage by stage.
+ *
+ * \param jobs initialisation table
+ * \param numJobs number of entries in the table
+ * \param starts job start times in STM0 ticks
+ * \param durations job durations in STM0 ticks
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+void MULTICORE_RunInit(const MULTICORE_InitJob *jobs, uint32 numJobs, uint32 *starts, uint32 *durations)
+{
+  uint32 core      = (uint32)IfxCpu_getCoreIndex();
+  uint32 numStages = 0;
+
+  for (uint32 i = 0; i < numJobs; i++)
+  {
+    if (jobs[i].stage >= numStages)
+    {
+      numStages = jobs[i].stage + 1u;
+    }
+  }
+
+  if (numStages == 0)
+  {
+    /* no jobs, the cores still have to meet once */
+    numStages = 1;
+  }
+
+  for (uint32 stage = 0; stage < numStages; stage++)
+  {
+    for (uint32 i = 0; i < numJobs; i++)
+    {
+      if ((jobs[i].core == core) && (jobs[i].stage == stage))
+      {
+        uint32 start = STM0_TIM0.U;
+        jobs[i].function();
+        starts[i]    = start;
+        durations[i] = STM0_TIM0.U - start;
+      }
+    }
+
+    (void)MULTICORE_BarrierWait(&MULTICORE_stageBarrier, 0);
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
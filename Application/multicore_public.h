@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * \file multicore_public.h
+ * \brief multi-core barrier and parallel initialisation framework
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef MULTICORE_PUBLIC_H
+#define MULTICORE_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+
+#define MULTICORE_NUM_CORES ((uint32)IFXCPU_NUM_MODULES) /**< \brief cores taking part in the boot */
+
+/** \brief Reusable barrier for N cores.
+ * Sense reversing: the last core to arrive resets the counter and flips the
+ * sense, the others spin until the sense changes. The barrier can be passed
+ * any number of times without re-initialisation. It must be located in
+ * memory which is accessed through its global address by all cores.
+ */
+typedef struct
+{
+  volatile uint32 count;     /**< \brief cores arrived in the current round */
+  volatile uint32 sense;     /**< \brief flips each time the barrier opens */
+  uint32          numCores;  /**< \brief cores which have to arrive */
+} MULTICORE_Barrier;
+
+/** \brief Static initialiser for a barrier of numCores cores */
+#define MULTICORE_BARRIER_INIT(numCores) {0u, 0u, (numCores)}
+
+/** \brief Initialisation function executed by one core */
+typedef void (*MULTICORE_InitFunction)(void);
+
+/** \brief Entry of an initialisation table.
+ * All jobs of a stage run in parallel on their cores, the next stage starts
+ * when every core has finished all its jobs of the current stage.
+ */
+typedef struct
+{
+  MULTICORE_InitFunction function;  /**< \brief job to execute */
+  const char            *name;      /**< \brief name used in the report */
+  uint8                  core;      /**< \brief core index executing the job */
+  uint8                  stage;     /**< \brief stage number, starting with 0 */
+} MULTICORE_InitJob;
+
+/** \brief Wait until all cores have arrived at the barrier.
+ *
+ * \param barrier barrier shared by the cores
+ * \param timeoutMilliSec timeout in milliseconds, 0 waits forever
+ * \return TRUE on timeout, the barrier must be re-initialised in this case
+ *
+ *  \ingroup MultiCore
+ */
+extern boolean MULTICORE_BarrierWait(MULTICORE_Barrier *barrier, uint32 timeoutMilliSec);
+
+/** \brief Clear the safety ENDINIT, shared by all cores.
+ * There is one safety ENDINIT for the device: the window is held under a
+ * lock until MULTICORE_CloseSafetyEndinit, a core opening it meanwhile
+ * waits. Windows must not be nested.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+extern void MULTICORE_OpenSafetyEndinit(void);
+
+/** \brief Set the safety ENDINIT again and release the window.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+extern void MULTICORE_CloseSafetyEndinit(void);
+
+/** \brief Execute the jobs of the calling core, stage by stage.
+ * Must be called by every core with the same table. Returns when all cores
+ * have finished the last stage. The STM0 duration of each job is recorded
+ * in durations[] and its STM0 start in starts[], both must have numJobs
+ * entries.
+ *
+ * \param jobs initialisation table
+ * \param numJobs number of entries in the table
+ * \param starts job start times in STM0 ticks, written by the executing core
+ * \param durations job durations in STM0 ticks, written by the executing core
+ * \return None
+ *
+ *  \ingroup MultiCore
+ */
+extern void MULTICORE_RunInit(const MULTICORE_InitJob *jobs, uint32 numJobs, uint32 *starts, uint32 *durations);
+
+#endif	/* end of file */
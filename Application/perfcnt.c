@@ -0,0 +1,326 @@
+/*******************************************************************************
+ * \file perfcnt.c
+ * \brief Code region profiling with the CPU performance counters
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Ifx_reg.h"
+
+#include "report_public.h"
+#include "perfcnt_public.h"
+
+#define PERFCNT_NUM_COUNTERS (2u + PERFCNT_NUM_MULTI)
+#define PERFCNT_COUNT_MASK   ((uint32)0x7FFFFFFFu)  /**< \brief 31 bit counters */
+
+/* index into PERFCNT_Scope */
+#define PERFCNT_CCNT  0u
+#define PERFCNT_ICNT  1u
+#define PERFCNT_M1CNT 2u
+
+/** \addtogroup PerfCnt_Variables */
+/* private data */
+static PERFCNT_Region *PERFCNT_regions[IFXCPU_NUM_MODULES];
+static PERFCNT_Events  PERFCNT_events[IFXCPU_NUM_MODULES];
+
+/* event names of M1CNT to M3CNT */
+static const char * const PERFCNT_eventNames[perfcnt_Events_count][PERFCNT_NUM_MULTI] =
+{
+  {"ipStall",   "lsStall",         "lpStall"},
+  {"pcacheHit", "pcacheMiss",      "multiIssue"},
+  {"dcacheHit", "dcacheMissClean", "dcacheMissDirty"},
+  {"branch",    "pmemStall",       "dmemStall"},
+};
+
+/* private functions */
+
+/** \brief Read ICNT and the multi counters of the calling core.
+ * CCNT is read by the callers, last on entry and first on exit.
+ *
+ * \param count receives the counter values
+ * \param sticky receives the sticky overflow bits
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+IFX_INLINE void PERFCNT_ReadMulti(uint32 *count, boolean *sticky)
+{
+  count[PERFCNT_ICNT]       = IfxCpu_getInstructionCounter();
+  sticky[PERFCNT_ICNT]      = IfxCpu_getInstructionCounterStickyOverflow();
+  count[PERFCNT_M1CNT]      = IfxCpu_getPerformanceCounter(CPU_M1CNT);
+  sticky[PERFCNT_M1CNT]     = IfxCpu_getPerformanceCounterStickyOverflow(CPU_M1CNT);
+  count[PERFCNT_M1CNT + 1]  = IfxCpu_getPerformanceCounter(CPU_M2CNT);
+  sticky[PERFCNT_M1CNT + 1] = IfxCpu_getPerformanceCounterStickyOverflow(CPU_M2CNT);
+  count[PERFCNT_M1CNT + 2]  = IfxCpu_getPerformanceCounter(CPU_M3CNT);
+  sticky[PERFCNT_M1CNT + 2] = IfxCpu_getPerformanceCounterStickyOverflow(CPU_M3CNT);
+}
+
+/** \brief Clear the sticky overflow bits which are set.
+ * Rewriting a counter stops it for a few cycles, this happens once per
+ * wrap only.
+ *
+ * \param sticky sticky overflow bits read at the end of the region
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+static void PERFCNT_ClearSticky(const boolean *sticky)
+{
+  if (sticky[PERFCNT_CCNT] != FALSE)
+  {
+    IfxCpu_updateClockCounter(IfxCpu_getClockCounter());
+  }
+  if (sticky[PERFCNT_ICNT] != FALSE)
+  {
+    IfxCpu_updateInstructionCounter(IfxCpu_getInstructionCounter());
+  }
+  if (sticky[PERFCNT_M1CNT] != FALSE)
+  {
+    IfxCpu_updatePerformanceCounter(CPU_M1CNT, IfxCpu_getPerformanceCounter(CPU_M1CNT));
+  }
+  if (sticky[PERFCNT_M1CNT + 1] != FALSE)
+  {
+    IfxCpu_updatePerformanceCounter(CPU_M2CNT, IfxCpu_getPerformanceCounter(CPU_M2CNT));
+  }
+  if (sticky[PERFCNT_M1CNT + 2] != FALSE)
+  {
+    IfxCpu_updatePerformanceCounter(CPU_M3CNT, IfxCpu_getPerformanceCounter(CPU_M3CNT));
+  }
+}
+
+/** \brief Clear the counts of a region, the list link is kept.
+ *
+ * \param region region to clear
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+static void PERFCNT_Clear(PERFCNT_Region *region)
+{
+  region->calls        = 0;
+  region->overflows    = 0;
+  region->cycles       = 0;
+  region->instructions = 0;
+  for (uint32 i = 0; i < PERFCNT_NUM_MULTI; i++)
+  {
+    region->multi[i] = 0;
+  }
+}
+
+/** \brief Send a value with two decimals, e.g. 0.87.
+ *
+ * \param hundredths value times 100
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+static void PERFCNT_ReportFixed(uint32 hundredths)
+{
+  REPORT_Dec32(hundredths / 100u);
+  REPORT_String((hundredths % 100u) < 10u ? ".0" : ".");
+  REPORT_Dec32(hundredths % 100u);
+}
+
+/* global functions */
+
+/** \brief Select the events of the multi counters and start the counters.
+ * Must be called on the core to be measured. The CCNT value is kept, it is
+ * the time base of the interrupt statistics.
+ *
+ * \param events events of M1CNT to M3CNT
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+void PERFCNT_SetEvents(PERFCNT_Events events)
+{
+  uint32        cpu     = IfxCpu_getCoreIndex();
+  boolean       enabled = IfxCpu_disableInterrupts();
+  Ifx_CPU_CCTRL cctrl;
+
+  cctrl.U    = __mfcr(CPU_CCTRL);
+  cctrl.B.CE = 0;
+  __mtcr(CPU_CCTRL, cctrl.U);
+
+  cctrl.B.M1 = events;
+  cctrl.B.M2 = events;
+  cctrl.B.M3 = events;
+  cctrl.B.CE = 1;
+  __mtcr(CPU_CCTRL, cctrl.U);
+  __isync();
+
+  PERFCNT_events[cpu] = events;
+  for (PERFCNT_Region *region = PERFCNT_regions[cpu]; region != NULL_PTR; region = region->next)
+  {
+    PERFCNT_Clear(region);
+  }
+
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Start a region, snapshot the counters of the calling core.
+ *
+ * \param scope receives the snapshot
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+void PERFCNT_Enter(PERFCNT_Scope *scope)
+{
+  PERFCNT_ReadMulti(scope->count, scope->sticky);
+  scope->count[PERFCNT_CCNT]  = IfxCpu_getClockCounter();
+  scope->sticky[PERFCNT_CCNT] = IfxCpu_getClockCounterStickyOverflow();
+}
+
+/** \brief End a region, add the counts since PERFCNT_Enter.
+ * The differences are taken modulo 2^31, which is correct for one wrap.
+ * A counter which wraps sets its sticky bit; a set sticky bit which was
+ * clear at the start and a value not below the start value means more
+ * than one wrap, the run is dropped and counted in overflows. The sticky
+ * bits are cleared here, so each wrap is seen by the next region.
+ *
+ * \param region accumulated counts
+ * \param scope snapshot of PERFCNT_Enter
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+void PERFCNT_Exit(PERFCNT_Region *region, const PERFCNT_Scope *scope)
+{
+  uint32  cpu = IfxCpu_getCoreIndex();
+  uint32  count[PERFCNT_NUM_COUNTERS];
+  boolean sticky[PERFCNT_NUM_COUNTERS];
+  boolean wrapped = FALSE;
+  boolean lost    = FALSE;
+  boolean enabled;
+
+  count[PERFCNT_CCNT]  = IfxCpu_getClockCounter();
+  sticky[PERFCNT_CCNT] = IfxCpu_getClockCounterStickyOverflow();
+  PERFCNT_ReadMulti(count, sticky);
+
+  for (uint32 i = 0; i < PERFCNT_NUM_COUNTERS; i++)
+  {
+    if (sticky[i] != FALSE)
+    {
+      wrapped = TRUE;
+      if ((scope->sticky[i] == FALSE) && (count[i] >= scope->count[i]))
+      {
+        lost = TRUE;
+      }
+    }
+    count[i] = (count[i] - scope->count[i]) & PERFCNT_COUNT_MASK;
+  }
+
+  enabled = IfxCpu_disableInterrupts();
+
+  if (wrapped != FALSE)
+  {
+    PERFCNT_ClearSticky(sticky);
+  }
+
+  if (region->registered == FALSE)
+  {
+    region->registered   = TRUE;
+    region->cpu          = cpu;
+    region->next         = PERFCNT_regions[cpu];
+    PERFCNT_regions[cpu] = region;
+  }
+
+  if (lost != FALSE)
+  {
+    region->overflows++;
+  }
+  else
+  {
+    region->calls++;
+    region->cycles       += count[PERFCNT_CCNT];
+    region->instructions += count[PERFCNT_ICNT];
+    for (uint32 i = 0; i < PERFCNT_NUM_MULTI; i++)
+    {
+      region->multi[i] += count[PERFCNT_M1CNT + i];
+    }
+  }
+
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Send the regions of all cores over the UART.
+ * One line per region with the mean counts per run:
+ * "PERF <cpu> <name> calls=<n> cycles=<n> instr=<n> ipc=<n.nn> <event>=<n> ... ovf=<n>"
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+void PERFCNT_Report(void)
+{
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    for (const PERFCNT_Region *region = PERFCNT_regions[cpu]; region != NULL_PTR; region = region->next)
+    {
+      uint32 calls = (region->calls != 0) ? region->calls : 1u;
+
+      REPORT_String("PERF ");
+      REPORT_Dec32(cpu);
+      REPORT_String(" ");
+      REPORT_String(region->name);
+      REPORT_String(" calls=");
+      REPORT_Dec32(region->calls);
+      REPORT_String(" cycles=");
+      REPORT_Dec32((uint32)(region->cycles / calls));
+      REPORT_String(" instr=");
+      REPORT_Dec32((uint32)(region->instructions / calls));
+      REPORT_String(" ipc=");
+      PERFCNT_ReportFixed((region->cycles != 0) ? (uint32)((region->instructions * 100u) / region->cycles) : 0u);
+      for (uint32 i = 0; i < PERFCNT_NUM_MULTI; i++)
+      {
+        REPORT_String(" ");
+        REPORT_String(PERFCNT_eventNames[PERFCNT_events[cpu]][i]);
+        REPORT_String("=");
+        REPORT_Dec32((uint32)(region->multi[i] / calls));
+      }
+      REPORT_String(" ovf=");
+      REPORT_Dec32(region->overflows);
+      REPORT_NewLine();
+    }
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
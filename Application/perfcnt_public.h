@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * \file perfcnt_public.h
+ * \brief Code region profiling with the CPU performance counters
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef PERFCNT_PUBLIC_H
+#define PERFCNT_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define PERFCNT_NUM_MULTI 3u  /**< \brief multi counters M1CNT to M3CNT */
+
+/** \brief Events counted by M1CNT, M2CNT and M3CNT.
+ * Value of CCTRL.M1/M2/M3, all three use the same row of the TC1.6P table.
+ */
+typedef enum
+{
+  perfcnt_Events_dispatchStall = 0,  /**< \brief IP, LS and LP dispatch stalls */
+  perfcnt_Events_programCache  = 1,  /**< \brief program cache hits and misses, multi issues */
+  perfcnt_Events_dataCache     = 2,  /**< \brief data cache hits, clean and dirty misses */
+  perfcnt_Events_memory        = 3,  /**< \brief branches, program and data memory stalls */
+  perfcnt_Events_count
+} PERFCNT_Events;
+
+/** \brief Accumulated counts of one named code region.
+ * A region is measured on one core only, define it with PERFCNT_REGION.
+ */
+typedef struct PERFCNT_Region_s
+{
+  const char              *name;                       /**< \brief name in the report */
+  struct PERFCNT_Region_s *next;                       /**< \brief next region of the same core */
+  boolean                  registered;                 /**< \brief linked into the list of its core */
+  uint32                   cpu;                        /**< \brief measuring core */
+  uint32                   calls;                      /**< \brief measured runs */
+  uint32                   overflows;                  /**< \brief runs dropped, a counter wrapped more than once */
+  uint64                   cycles;                     /**< \brief CCNT */
+  uint64                   instructions;               /**< \brief ICNT */
+  uint64                   multi[PERFCNT_NUM_MULTI];   /**< \brief M1CNT to M3CNT */
+} PERFCNT_Region;
+
+/** \brief Counter snapshot taken at the start of a region */
+typedef struct
+{
+  uint32  count[2u + PERFCNT_NUM_MULTI];   /**< \brief CCNT, ICNT, M1CNT to M3CNT */
+  boolean sticky[2u + PERFCNT_NUM_MULTI];  /**< \brief sticky overflow bits */
+} PERFCNT_Scope;
+
+/** \brief Define a region, e.g. static PERFCNT_REGION(PROTO_rxRegion, "rx"); */
+#define PERFCNT_REGION(var, regionName) PERFCNT_Region var = {regionName}
+
+/** \brief Select the events of the multi counters of the calling core and start the counters.
+ * The regions of the core are cleared.
+ *
+ * \param events events of M1CNT to M3CNT
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+extern void PERFCNT_SetEvents(PERFCNT_Events events);
+
+/** \brief Start a region, snapshot the counters of the calling core.
+ *
+ * \param scope receives the snapshot
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+extern void PERFCNT_Enter(PERFCNT_Scope *scope);
+
+/** \brief End a region, add the counts since PERFCNT_Enter.
+ *
+ * \param region accumulated counts
+ * \param scope snapshot of PERFCNT_Enter
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+extern void PERFCNT_Exit(PERFCNT_Region *region, const PERFCNT_Scope *scope);
+
+/** \brief Send the regions of all cores over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PerfCnt
+ */
+extern void PERFCNT_Report(void);
+
+#endif	/* end of file */
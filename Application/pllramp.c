@@ -0,0 +1,320 @@
+/*******************************************************************************
+ * \file pllramp.c
+ * \brief PLL ramp profile with per step timing
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "Ifx_reg.h"
+#include "IfxScuCcu.h"
+#include "IfxScuWdt.h"
+
+#include "PllRampDef.h"
+#include "asclin3_public.h"
+#include "bootprof_public.h"
+#include "multicore_public.h"
+#include "report_public.h"
+#include "pllramp_public.h"
+
+#define PLLRAMP_K2DIV_MAX 127u /**< \brief PLLCON1.K2DIV is 7 bit wide */
+
+/** \addtogroup PllRamp_Variables */
+static const IfxScuCcu_PllStepsConfig PLLRAMP_defaultSteps[] =
+{
+  PLLRAMP_PROFILE
+};
+
+const PLLRAMP_Profile PLLRAMP_defaultProfile =
+{
+  PLLRAMP_defaultSteps,
+  (uint8)(sizeof(PLLRAMP_defaultSteps) / sizeof(PLLRAMP_defaultSteps[0])),
+  PLLRAMP_EARLY_STEPS,
+  PLLRAMP_INITIAL_WAIT,
+};
+
+/* private data */
+static const PLLRAMP_Profile *PLLRAMP_profile;
+static uint32 PLLRAMP_numStamps;
+static uint32 PLLRAMP_startTicks;     /* PLLRAMP_Start entered */
+static uint32 PLLRAMP_initTicks;      /* IfxScuCcu_init returned */
+static uint32 PLLRAMP_endTicks;       /* last step has settled */
+static uint32 PLLRAMP_bootStmFreq;
+static uint32 PLLRAMP_stepTicks[PLLRAMP_MAX_STEPS];
+static uint32 PLLRAMP_stepStmFreq[PLLRAMP_MAX_STEPS];
+static uint32 PLLRAMP_stepPllFreq[PLLRAMP_MAX_STEPS];
+
+/* private functions */
+
+/** \brief Busy wait using STM0 at the current STM frequency.
+ *
+ * \param timeSec time to wait in seconds
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+static void PLLRAMP_Wait(float32 timeSec)
+{
+  uint32 ticks = (uint32)(timeSec * IfxScuCcu_getStmFrequency());
+  uint32 start = STM0_TIM0.U;
+
+  while ((uint32)(STM0_TIM0.U - start) < ticks)
+    ;
+}
+
+/** \brief Convert an STM0 interval into microseconds.
+ *
+ * \param from start of the interval
+ * \param to end of the interval
+ * \param stmFreq STM frequency in Hz during the interval
+ * \return microseconds
+ *
+ *  \ingroup PllRamp
+ */
+static uint32 PLLRAMP_GetMicroseconds(uint32 from, uint32 to, uint32 stmFreq)
+{
+  return (stmFreq != 0) ? (uint32)(((uint64)(to - from) * 1000000u) / stmFreq) : 0;
+}
+
+/* global functions */
+
+/** \brief Check a profile against the PLL configuration of Ifx_Cfg.h.
+ *
+ * \param profile profile to check
+ * \return TRUE if the profile is invalid
+ *
+ *  \ingroup PllRamp
+ */
+boolean PLLRAMP_CheckProfile(const PLLRAMP_Profile *profile)
+{
+  const IfxScuCcu_InitialStepConfig *initial = &IfxScuCcu_defaultClockConfig.sysPll.pllInitialStep;
+  float32 fVco  = ((float32)IFX_CFG_SCU_XTAL_FREQUENCY * (initial->nDivider + 1u)) / (initial->pDivider + 1u);
+  uint32  k2    = initial->k2Initial;
+  float32 fPll;
+  boolean error = FALSE;
+
+  if ((profile->numSteps == 0) || (profile->numSteps > PLLRAMP_MAX_STEPS) ||
+      (profile->earlySteps > profile->numSteps))
+  {
+    error = TRUE;
+  }
+  else
+  {
+    for (uint32 i = 0; i < profile->numSteps; i++)
+    {
+      /* each step must raise the frequency */
+      if ((profile->steps[i].k2Step >= k2) || (profile->steps[i].k2Step > PLLRAMP_K2DIV_MAX))
+      {
+        error = TRUE;
+      }
+      k2 = profile->steps[i].k2Step;
+    }
+
+    /* the last step must reach the configured PLL frequency (+-1%) */
+    fPll = fVco / (k2 + 1u);
+    if ((fPll > (IFX_CFG_SCU_PLL_FREQUENCY * 1.01F)) || (fPll < (IFX_CFG_SCU_PLL_FREQUENCY * 0.99F)))
+    {
+      error = TRUE;
+    }
+  }
+
+  return error;
+}
+
+/** \brief Lock the PLL and run the early steps of a profile.
+ *
+ * \param profile ramp profile
+ * \return TRUE on error
+ *
+ *  \ingroup PllRamp
+ */
+boolean PLLRAMP_Start(const PLLRAMP_Profile *profile)
+{
+  IfxScuCcu_Config config = IfxScuCcu_defaultClockConfig;
+  boolean          error;
+
+  PLLRAMP_profile     = NULL_PTR;
+  PLLRAMP_numStamps   = 0;
+  PLLRAMP_bootStmFreq = (uint32)IfxScuCcu_getStmFrequency();
+  PLLRAMP_startTicks  = STM0_TIM0.U;
+
+  if (PLLRAMP_CheckProfile(profile) == FALSE)
+  {
+    PLLRAMP_profile = profile;
+    config.sysPll.numOfPllDividerSteps    = profile->earlySteps;
+    config.sysPll.pllDividerStep          = (IfxScuCcu_PllStepsConfig *)profile->steps;
+    config.sysPll.pllInitialStep.waitTime = profile->initialWait;
+  }
+
+  error             = IfxScuCcu_init(&config);
+  PLLRAMP_initTicks = STM0_TIM0.U;
+  PLLRAMP_endTicks  = PLLRAMP_initTicks;
+
+  return error;
+}
+
+/** \brief Run the remaining steps of the profile started with PLLRAMP_Start.
+ * The UART is flushed before each K2 change and re-bauded after it, so
+ * output written during the ramp is not corrupted.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+void PLLRAMP_Complete(void)
+{
+  if ((PLLRAMP_profile != NULL_PTR) && (PLLRAMP_profile->earlySteps < PLLRAMP_profile->numSteps))
+  {
+    for (uint32 i = PLLRAMP_profile->earlySteps; i < PLLRAMP_profile->numSteps; i++)
+    {
+      const IfxScuCcu_PllStepsConfig *step = &PLLRAMP_profile->steps[i];
+
+      ASCLIN3_Flush();
+      PLLRAMP_SetK2Divider(step->k2Step);
+
+      if (step->hookFunction != (IfxScuCcu_PllStepsFunctionHook)0)
+      {
+        step->hookFunction();
+      }
+
+      ASCLIN3_UpdateBaudrate();
+      PLLRAMP_Wait(step->waitTime);
+    }
+    PLLRAMP_endTicks = STM0_TIM0.U;
+  }
+
+  BOOTPROF_Mark(bootprof_Phase_rampDone);
+}
+
+/** \brief Write the K2 divider of the system PLL.
+ * All clocks derived from fPLL change immediately, the caller has to take
+ * care of the current jump and of the peripherals depending on the clock.
+ *
+ * \param k2Step K2 register value (divider - 1)
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+void PLLRAMP_SetK2Divider(uint8 k2Step)
+{
+  MULTICORE_OpenSafetyEndinit();
+  while (SCU_PLLSTAT.B.K2RDY == 0U)
+  {
+    /*Wait until K2 divider is ready */
+  }
+  SCU_PLLCON1.B.K2DIV = k2Step;
+  MULTICORE_CloseSafetyEndinit();
+}
+
+/** \brief Hook function of the profile steps, stamps the step with STM0.
+ * Called right after the K2 divider has been written.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+void PLLRAMP_StepHook(void)
+{
+  if (PLLRAMP_numStamps < PLLRAMP_MAX_STEPS)
+  {
+    PLLRAMP_stepTicks[PLLRAMP_numStamps]   = STM0_TIM0.U;
+    PLLRAMP_stepStmFreq[PLLRAMP_numStamps] = (uint32)IfxScuCcu_getStmFrequency();
+    PLLRAMP_stepPllFreq[PLLRAMP_numStamps] = (uint32)IfxScuCcu_getPllFrequency();
+    PLLRAMP_numStamps++;
+  }
+}
+
+/** \brief Send the duration of the PLL lock and of each step over the UART.
+ * A step lasts from its K2 change to the next K2 change, or to the end of
+ * IfxScuCcu_init resp. PLLRAMP_Complete for the last early resp. last step.
+ * The time between IfxScuCcu_init and PLLRAMP_Complete is not part of the
+ * ramp.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+void PLLRAMP_Report(void)
+{
+  uint32 earlySteps = (PLLRAMP_profile != NULL_PTR) ? PLLRAMP_profile->earlySteps : 0;
+  uint32 lockEnd    = ((earlySteps > 0) && (PLLRAMP_numStamps > 0)) ? PLLRAMP_stepTicks[0] : PLLRAMP_initTicks;
+  uint32 us         = PLLRAMP_GetMicroseconds(PLLRAMP_startTicks, lockEnd, PLLRAMP_bootStmFreq);
+  uint32 total      = us;
+
+  REPORT_String("PLL lock us=");
+  REPORT_Dec32(us);
+  REPORT_NewLine();
+
+  for (uint32 i = 0; i < PLLRAMP_numStamps; i++)
+  {
+    uint32 end;
+
+    if ((i + 1u) == earlySteps)
+    {
+      end = PLLRAMP_initTicks;
+    }
+    else if ((i + 1u) == PLLRAMP_numStamps)
+    {
+      end = PLLRAMP_endTicks;
+    }
+    else
+    {
+      end = PLLRAMP_stepTicks[i + 1u];
+    }
+
+    us     = PLLRAMP_GetMicroseconds(PLLRAMP_stepTicks[i], end, PLLRAMP_stepStmFreq[i]);
+    total += us;
+
+    REPORT_String("PLL step=");
+    REPORT_Dec32(i);
+    REPORT_String(" k2=");
+    REPORT_Dec32(PLLRAMP_profile->steps[i].k2Step + 1u);
+    REPORT_String(" mhz=");
+    REPORT_Dec32(PLLRAMP_stepPllFreq[i] / 1000000u);
+    REPORT_String(" us=");
+    REPORT_Dec32(us);
+    REPORT_NewLine();
+  }
+
+  REPORT_String("PLL total us=");
+  REPORT_Dec32(total);
+  REPORT_NewLine();
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
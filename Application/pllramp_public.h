@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * \file pllramp_public.h
+ * \brief PLL ramp profile with per step timing
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef PLLRAMP_PUBLIC_H
+#define PLLRAMP_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxScuCcu.h"
+
+#define PLLRAMP_MAX_STEPS 8u /**< \brief steps which can be timed */
+
+/** \brief PLL ramp profile.
+ * The steps are IfxScuCcu_PllStepsConfig entries, their hook function must
+ * be PLLRAMP_StepHook to get the step timed.
+ */
+typedef struct
+{
+  const IfxScuCcu_PllStepsConfig *steps;        /**< \brief K2 divider steps, lowest frequency first */
+  uint8                           numSteps;     /**< \brief entries in steps[], at most PLLRAMP_MAX_STEPS */
+  uint8                           earlySteps;   /**< \brief steps executed by IfxScuCcu_init */
+  float32                         initialWait;  /**< \brief settling time in seconds at the initial K2 divider */
+} PLLRAMP_Profile;
+
+/** \brief Step entry of a profile, k2Div is the divider (register value + 1) */
+#define PLLRAMP_STEP(k2Div, waitTime) {(uint8)((k2Div) - 1u), (waitTime), PLLRAMP_StepHook},
+
+/** \brief Profile built from Configurations/PllRampDef.h */
+extern const PLLRAMP_Profile PLLRAMP_defaultProfile;
+
+/** \brief Check a profile against the PLL configuration of Ifx_Cfg.h.
+ * The K2 dividers must be in range, start below the initial divider,
+ * decrease strictly and end at IFX_CFG_SCU_PLL_FREQUENCY.
+ *
+ * \param profile profile to check
+ * \return TRUE if the profile is invalid
+ *
+ *  \ingroup PllRamp
+ */
+extern boolean PLLRAMP_CheckProfile(const PLLRAMP_Profile *profile);
+
+/** \brief Lock the PLL and run the early steps of a profile.
+ * Replaces IfxScuCcu_init. An invalid profile is replaced by the library
+ * default steps.
+ *
+ * \param profile ramp profile, must stay valid until PLLRAMP_Complete returns
+ * \return TRUE on error, as returned by IfxScuCcu_init
+ *
+ *  \ingroup PllRamp
+ */
+extern boolean PLLRAMP_Start(const PLLRAMP_Profile *profile);
+
+/** \brief Run the remaining steps of the profile started with PLLRAMP_Start.
+ * ASCLIN3 is re-bauded after each step, it must be initialised.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+extern void PLLRAMP_Complete(void);
+
+/** \brief Write the K2 divider of the system PLL.
+ * All clocks derived from fPLL change immediately.
+ *
+ * \param k2Step K2 register value (divider - 1)
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+extern void PLLRAMP_SetK2Divider(uint8 k2Step);
+
+/** \brief Hook function of the profile steps, stamps the step with STM0.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+extern void PLLRAMP_StepHook(void);
+
+/** \brief Send the duration of the PLL lock and of each step over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup PllRamp
+ */
+extern void PLLRAMP_Report(void);
+
+#endif	/* end of file */
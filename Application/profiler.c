@@ -0,0 +1,349 @@
+/*******************************************************************************
+ * \file profiler.c
+ * \brief Statistical sampling profiler driven by the STM compare interrupts
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Ifx_reg.h"
+#include "IfxStm_bf.h"
+#include "NoClearDef.h"
+
+#include "IntPrioDef.h"
+#include "dvfs_public.h"
+#include "report_public.h"
+#include "profiler_public.h"
+
+#define PROFILER_PCXI_LINK ((uint32)0x000FFFFFu)  /**< \brief PCXS and PCXO */
+#define PROFILER_PCXI_UL   ((uint32)0x00100000u)  /**< \brief linked context is an upper context */
+#define PROFILER_LOWER_A11 1u                     /**< \brief word of A11 in a lower context */
+
+/** \addtogroup Profiler_Variables */
+/* Histograms in the DSPR of the sampled core, not cleared by the startup
+ * code; they hold random values until PROFILER_Start clears them */
+NOCLEAR_BEGIN(cpu0)
+PROFILER_Histogram PROFILER_histogram0;
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu1)
+PROFILER_Histogram PROFILER_histogram1;
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu2)
+PROFILER_Histogram PROFILER_histogram2;
+NOCLEAR_END
+
+/* private data */
+/* the histograms are valid, cleared on every reset */
+static boolean PROFILER_started;
+
+static PROFILER_Histogram * const PROFILER_histograms[IFXCPU_NUM_MODULES] =
+{
+  &PROFILER_histogram0,
+  &PROFILER_histogram1,
+  &PROFILER_histogram2,
+};
+
+/* STMn samples CPUn */
+static Ifx_STM * const PROFILER_stm[IFXCPU_NUM_MODULES] =
+{
+  &MODULE_STM0,
+  &MODULE_STM1,
+  &MODULE_STM2,
+};
+
+static volatile Ifx_SRC_SRCR * const PROFILER_src[IFXCPU_NUM_MODULES] =
+{
+  &SRC_STM0SR0,
+  &SRC_STM1SR0,
+  &SRC_STM2SR0,
+};
+
+static const uint32 PROFILER_srcConfig[IFXCPU_NUM_MODULES] =
+{
+  TOS_CPU0 | SRE_ON | SRPN_CPU0_STM0_SR0,
+  TOS_CPU1 | SRE_ON | SRPN_CPU1_STM1_SR0,
+  TOS_CPU2 | SRE_ON | SRPN_CPU2_STM2_SR0,
+};
+
+static uint32          PROFILER_rateHz = PROFILER_DEFAULT_RATE_HZ;
+static volatile uint32 PROFILER_period;
+
+/* STM time written to CMP0, written by the sampled core only after PROFILER_Start */
+static uint32 PROFILER_compare[IFXCPU_NUM_MODULES];
+
+/* private functions */
+void PROFILER_Cpu0ISR(void);
+void PROFILER_Cpu1ISR(void);
+void PROFILER_Cpu2ISR(void);
+
+/** \brief Read the interrupted PC from the context saved on interrupt entry.
+ * Must be expanded in the interrupt handler itself, not in a function
+ * called by it.
+ *
+ * \param None
+ * \return address of the interrupted instruction
+ *
+ *  \ingroup Profiler
+ */
+IFX_INLINE uint32 PROFILER_GetInterruptedPc(void)
+{
+  uint32 pcxi = (uint32)__mfcr(CPU_PCXI);
+  uint32 pc;
+
+  if ((pcxi & PROFILER_PCXI_UL) == 0)
+  {
+    /* lower context saved by bisr/svlcx, its A11 is the interrupted PC */
+    pc = ((const uint32 *)__cx_to_addr(pcxi & PROFILER_PCXI_LINK))[PROFILER_LOWER_A11];
+  }
+  else
+  {
+    /* only the upper context was saved, A11 still holds the interrupted PC */
+    pc = (uint32)__getA11();
+  }
+
+  return pc;
+}
+
+/** \brief Add one sample to the histogram of a core and rearm the compare.
+ *
+ * \param cpu sampled core
+ * \param pc interrupted address
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+static void PROFILER_Sample(uint32 cpu, uint32 pc)
+{
+  PROFILER_Histogram *histogram = PROFILER_histograms[cpu];
+  Ifx_STM            *stm       = PROFILER_stm[cpu];
+  uint32              period    = PROFILER_period;
+  uint32              tim0      = stm->TIM0.U;
+  uint32              idx       = (((pc >> 1) * 2654435761u) >> 16) & (PROFILER_TABLE_SIZE - 1u);
+
+  /* relative to the last compare to keep the rate, unless it was missed */
+  PROFILER_compare[cpu] += period;
+  if ((sint32)(PROFILER_compare[cpu] - tim0) <= 0)
+  {
+    PROFILER_compare[cpu] = tim0 + period;
+  }
+  stm->CMP[0].U = PROFILER_compare[cpu];
+  stm->ISCR.U   = (uint32)IFX_STM_ISCR_CMP0IRR_MSK << IFX_STM_ISCR_CMP0IRR_OFF;
+
+  histogram->samples++;
+
+  for (uint32 probe = 0; probe < PROFILER_PROBES; probe++)
+  {
+    PROFILER_Entry *entry = &histogram->entry[idx];
+
+    if (entry->pc == pc)
+    {
+      entry->count++;
+      return;
+    }
+    if (entry->pc == 0)
+    {
+      entry->pc    = pc;
+      entry->count = 1;
+      return;
+    }
+    idx = (idx + 1u) & (PROFILER_TABLE_SIZE - 1u);
+  }
+
+  histogram->lost++;
+}
+
+/** \addtogroup Profiler_InterruptFunctions
+ * \{ */
+
+/** \brief STM0 compare 0 interrupt, samples CPU0.
+ * The cores share one vector table, see IntPrioDef.h.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup Profiler
+ */
+IFX_INTERRUPT(PROFILER_Cpu0ISR, VECTAB0, SRPN_CPU0_STM0_SR0);
+void PROFILER_Cpu0ISR(void)
+{
+  PROFILER_Sample(0, PROFILER_GetInterruptedPc());
+}
+
+/** \brief STM1 compare 0 interrupt, samples CPU1.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup Profiler
+ */
+IFX_INTERRUPT(PROFILER_Cpu1ISR, VECTAB0, SRPN_CPU1_STM1_SR0);
+void PROFILER_Cpu1ISR(void)
+{
+  PROFILER_Sample(1, PROFILER_GetInterruptedPc());
+}
+
+/** \brief STM2 compare 0 interrupt, samples CPU2.
+ *
+ * \param None
+ * \return Nothing
+ *
+ * \ingroup Profiler
+ */
+IFX_INTERRUPT(PROFILER_Cpu2ISR, VECTAB0, SRPN_CPU2_STM2_SR0);
+void PROFILER_Cpu2ISR(void)
+{
+  PROFILER_Sample(2, PROFILER_GetInterruptedPc());
+}
+
+/** \} */
+
+/* global functions */
+
+/** \brief Clear the histograms and start sampling on all cores.
+ *
+ * \param rateHz samples per second and core
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+void PROFILER_Start(uint32 rateHz)
+{
+  PROFILER_Stop();
+
+  PROFILER_rateHz = (rateHz != 0) ? rateHz : PROFILER_DEFAULT_RATE_HZ;
+  PROFILER_UpdateRate();
+
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    PROFILER_Histogram *histogram = PROFILER_histograms[cpu];
+    Ifx_STM            *stm       = PROFILER_stm[cpu];
+
+    histogram->samples = 0;
+    histogram->lost    = 0;
+    for (uint32 i = 0; i < PROFILER_TABLE_SIZE; i++)
+    {
+      histogram->entry[i].pc    = 0;
+      histogram->entry[i].count = 0;
+    }
+    PROFILER_started = TRUE;
+
+    /* compare all 32 bits of TIM0 */
+    stm->CMCON.B.MSIZE0   = 31;
+    stm->CMCON.B.MSTART0  = 0;
+    PROFILER_compare[cpu] = stm->TIM0.U + PROFILER_period;
+    stm->CMP[0].U         = PROFILER_compare[cpu];
+    stm->ISCR.U           = (uint32)IFX_STM_ISCR_CMP0IRR_MSK << IFX_STM_ISCR_CMP0IRR_OFF;
+    stm->ICR.B.CMP0OS     = 0;
+    stm->ICR.B.CMP0EN     = 1;
+
+    PROFILER_src[cpu]->U = PROFILER_srcConfig[cpu];
+  }
+}
+
+/** \brief Stop sampling on all cores.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+void PROFILER_Stop(void)
+{
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    PROFILER_stm[cpu]->ICR.B.CMP0EN = 0;
+    PROFILER_src[cpu]->U            = CLRR;
+  }
+}
+
+/** \brief Recalculate the sample period after a clock change.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+void PROFILER_UpdateRate(void)
+{
+  PROFILER_period = DVFS_GetStmFrequency() / PROFILER_rateHz;
+}
+
+/** \brief Send the histograms over the UART.
+ * One header line per core, then one line per sampled address:
+ * "PROF <cpu> <pc> <count>". Stop the profiler first to get a consistent
+ * snapshot. Before the first PROFILER_Start only the header lines with
+ * 0 samples are sent.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+void PROFILER_Report(void)
+{
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    PROFILER_Histogram *histogram = PROFILER_histograms[cpu];
+
+    REPORT_String("PROF cpu=");
+    REPORT_Dec32(cpu);
+    REPORT_String(" samples=");
+    REPORT_Dec32((PROFILER_started != FALSE) ? histogram->samples : 0u);
+    REPORT_String(" lost=");
+    REPORT_Dec32((PROFILER_started != FALSE) ? histogram->lost : 0u);
+    REPORT_String(" rate=");
+    REPORT_Dec32(PROFILER_rateHz);
+    REPORT_NewLine();
+
+    for (uint32 i = 0; (PROFILER_started != FALSE) && (i < PROFILER_TABLE_SIZE); i++)
+    {
+      if (histogram->entry[i].pc != 0)
+      {
+        REPORT_String("PROF ");
+        REPORT_Dec32(cpu);
+        REPORT_String(" ");
+        REPORT_Hex32(histogram->entry[i].pc);
+        REPORT_String(" ");
+        REPORT_Dec32(histogram->entry[i].count);
+        REPORT_NewLine();
+      }
+    }
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
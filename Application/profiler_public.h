@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * \file profiler_public.h
+ * \brief Statistical sampling profiler driven by the STM compare interrupts
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef PROFILER_PUBLIC_H
+#define PROFILER_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define PROFILER_DEFAULT_RATE_HZ 1000u  /**< \brief samples per second and core */
+#define PROFILER_TABLE_SIZE      256u   /**< \brief distinct PCs per core, power of 2 */
+#define PROFILER_PROBES          8u     /**< \brief hash table entries tried per sample */
+
+/** \brief Histogram entry */
+typedef struct
+{
+  uint32 pc;     /**< \brief sampled address, 0 marks a free entry */
+  uint32 count;  /**< \brief samples at this address */
+} PROFILER_Entry;
+
+/** \brief Histogram of one core */
+typedef struct
+{
+  uint32         samples;                       /**< \brief samples taken */
+  uint32         lost;                          /**< \brief samples not stored, table full */
+  PROFILER_Entry entry[PROFILER_TABLE_SIZE];    /**< \brief open addressing hash table */
+} PROFILER_Histogram;
+
+/** \brief Clear the histograms and start sampling on all cores.
+ *
+ * \param rateHz samples per second and core
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+extern void PROFILER_Start(uint32 rateHz);
+
+/** \brief Stop sampling on all cores, the histograms are kept.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+extern void PROFILER_Stop(void);
+
+/** \brief Recalculate the sample period after a clock change.
+ * Clock listener of the frequency scaling.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+extern void PROFILER_UpdateRate(void);
+
+/** \brief Send the histograms over the UART.
+ * Resolve the addresses with Tools/profiler_resolve.py.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Profiler
+ */
+extern void PROFILER_Report(void);
+
+#endif	/* end of file */
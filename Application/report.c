@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * \file report.c
+ * \brief line based text reports sent over ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+
+#include "report_public.h"
+#include "uarttx_public.h"
+
+#define REPORT_LINE_SIZE ((uint16)96u) /**< \brief size of the line buffer */
+
+/** \addtogroup Report_Variables */
+/* private data */
+static uint8  REPORT_line[REPORT_LINE_SIZE];
+static uint16 REPORT_lineIdx;
+
+/* private functions */
+
+/** \brief Append one character to the line buffer, flush if it is full.
+ *
+ * \param c character to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+static inline void REPORT_PutChar(char c)
+{
+	REPORT_line[REPORT_lineIdx++] = (uint8)c;
+
+	if (REPORT_lineIdx >= REPORT_LINE_SIZE)
+	{
+		REPORT_Flush();
+	}
+}
+
+/* global functions */
+
+/** \brief Queue the buffered characters in the control class.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Report
+ */
+void REPORT_Flush(void)
+{
+	if (REPORT_lineIdx > 0)
+	{
+		UARTTX_SendWait(uarttx_Class_control, REPORT_line, REPORT_lineIdx);
+		REPORT_lineIdx = 0;
+	}
+}
+
+/** \brief Append a zero terminated string.
+ *
+ * \param str string to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+void REPORT_String(const char *str)
+{
+	while (*str != '\0')
+	{
+		REPORT_PutChar(*str++);
+	}
+}
+
+/** \brief Append a value as 8 digit hexadecimal number with "0x" prefix.
+ *
+ * \param value value to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+void REPORT_Hex32(uint32 value)
+{
+	static const char digits[] = "0123456789ABCDEF";
+
+	REPORT_PutChar('0');
+	REPORT_PutChar('x');
+
+	for (sint32 shift = 28; shift >= 0; shift -= 4)
+	{
+		REPORT_PutChar(digits[(value >> shift) & 0xFu]);
+	}
+}
+
+/** \brief Append a value as unsigned decimal number.
+ *
+ * \param value value to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+void REPORT_Dec32(uint32 value)
+{
+	char   buf[10];
+	uint32 len = 0;
+
+	do
+	{
+		buf[len++] = (char)('0' + (value % 10u));
+		value /= 10u;
+	} while (value != 0);
+
+	while (len > 0)
+	{
+		REPORT_PutChar(buf[--len]);
+	}
+}
+
+/** \brief Terminate the current line and send it.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Report
+ */
+void REPORT_NewLine(void)
+{
+	REPORT_PutChar('\r');
+	REPORT_PutChar('\n');
+	REPORT_Flush();
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
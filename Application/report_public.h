@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * \file report_public.h
+ * \brief line based text reports sent over ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef REPORT_PUBLIC_H
+#define REPORT_PUBLIC_H
+
+/** \brief Append a zero terminated string to the current report line.
+ *
+ * \param str string to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+extern void REPORT_String(const char *str);
+
+/** \brief Append a value as 8 digit hexadecimal number.
+ *
+ * \param value value to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+extern void REPORT_Hex32(uint32 value);
+
+/** \brief Append a value as unsigned decimal number.
+ *
+ * \param value value to append
+ * \return None
+ *
+ *  \ingroup Report
+ */
+extern void REPORT_Dec32(uint32 value);
+
+/** \brief Terminate the current report line and send it over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Report
+ */
+extern void REPORT_NewLine(void);
+
+/** \brief Send the characters buffered so far without terminating the line.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Report
+ */
+extern void REPORT_Flush(void);
+
+#endif	/* end of file */
@@ -37,9 +37,24 @@
 #include "IfxScuWdt.h"
 #include "Ifx_reg.h"
 
-#include "intpriodef.h"
+#include "IntPrioDef.h"
 #include "ports.h"
 #include "asclin3_public.h"
+#include "bootprof_public.h"
+#include "bootinit_public.h"
+#include "initseq_public.h"
+#include "dmaalloc_public.h"
+#include "dmacopy_public.h"
+#include "pllramp_public.h"
+#include "dvfs_public.h"
+#include "crashdump_public.h"
+#include "profiler_public.h"
+#include "isrstat_public.h"
+#include "perfcnt_public.h"
+#include "cpuload_public.h"
+#include "trace_public.h"
+#include "log_public.h"
+#include "uarttx_public.h"
 
 volatile uint32 cnt;
 volatile uint32 test;
@@ -47,6 +62,9 @@ volatile uint16 txCnt;
 
 extern void ASCLIN3_DMA_Init(uint16 trel);
 
+static PERFCNT_REGION(SCHEDULER_bootReport, "bootReport");
+static PERFCNT_REGION(SCHEDULER_dmaInit, "dmaInit");
+
 /*! \fn void scheduler(void)
  *  \brief This is simple loop for CPU0 to allow user input from a debugger.
  *  The variable "test' is used to
@@ -55,8 +73,11 @@ extern void ASCLIN3_DMA_Init(uint16 trel);
  */
 void scheduler(void)
 {
-	/* initialize ASCLIN0 to be used for UART communication using the DMA */
-	ASCLIN3_Init();
+	PERFCNT_Scope scope;
+	uint32        events = perfcnt_Events_dispatchStall;
+	uint8         rxBlock[LOG_COMMAND_SIZE];
+
+	/* ASCLIN3 has been initialized by CPU1 during BOOTINIT_Run() */
 
 	/*txCnt*/
 	txCnt = 10;
@@ -64,17 +85,37 @@ void scheduler(void)
 	/* Enable global interrupts */
 	IfxCpu_enableInterrupts();
 
+	/* send the boot time record, this is the first output on the UART */
+	PERFCNT_Enter(&scope);
+	BOOTPROF_Report();
+	/* replay the trap recorded before the last reset, if any */
+	CRASHDUMP_Report();
+	BOOTINIT_Report();
+	INITSEQ_Report();
+	DMAALLOC_Report();
+	PLLRAMP_Report();
+	PERFCNT_Exit(&SCHEDULER_bootReport, &scope);
+
+	/* load measurement windows of all cores */
+	CPULOAD_Start(CPULOAD_DEFAULT_WINDOW_MS);
+
+	LOG_INFO(log_Module_scheduler, "scheduler running, fSTM %u Hz, %u cores", DVFS_GetStmFrequency(), IFXCPU_NUM_MODULES);
+
 	while (1)
 	{
 		if (test > 0)
 		{
 			/* user testing control, manipulated using a debugger */
+			TRACE(trace_Event_command, test, 0);
+			LOG_DEBUG(log_Module_scheduler, "command %u", test);
 			switch (test)
 			{
 
 				case 1:
           /* Re-initialize the transmit transfer byte count to the value = to txCnt */
+				  PERFCNT_Enter(&scope);
 				  ASCLIN3_DMA_Init(txCnt);
+				  PERFCNT_Exit(&SCHEDULER_dmaInit, &scope);
 					break;
 
         case 2:
@@ -83,8 +124,91 @@ void scheduler(void)
           break;
 
         case 3:
-          /* Initiate the transmit transfer using the SRC interrupt node */
-          SRC_ASCLIN3TX.U |= SETR;
+          /* Initiate the transmit transfer using the SRC interrupt node,
+           * the latency is measured if the node is served by this core */
+          (void)ISRSTAT_Trigger(&SRC_ASCLIN3TX);
+          break;
+
+        case 4:
+          /* Scale the clocks down, ASCLIN3 keeps its baud rate */
+          (void)DVFS_SetLevel(dvfs_Level_idle);
+          break;
+
+        case 5:
+          /* Back to the full frequency */
+          (void)DVFS_SetLevel(dvfs_Level_full);
+          break;
+
+        case 6:
+          /* Send the duration of the frequency transitions */
+          DVFS_Report();
+          break;
+
+        case 7:
+          /* Start the sampling profiler on all cores */
+          PROFILER_Start(PROFILER_DEFAULT_RATE_HZ);
+          break;
+
+        case 8:
+          /* Stop the profiler and send the histograms */
+          PROFILER_Stop();
+          PROFILER_Report();
+          break;
+
+        case 9:
+          /* Send the interrupt latency and duration statistics */
+          ISRSTAT_Report();
+          break;
+
+        case 10:
+          /* Clear the interrupt statistics */
+          ISRSTAT_Reset();
+          break;
+
+        case 11:
+          /* Send the counts of the measured code regions */
+          PERFCNT_Report();
+          break;
+
+        case 12:
+          /* Count the next set of events with the multi counters, clears the regions */
+          events = (events + 1u) % perfcnt_Events_count;
+          PERFCNT_SetEvents((PERFCNT_Events)events);
+          break;
+
+        case 13:
+          /* Send the load of all cores */
+          CPULOAD_Report();
+          break;
+
+        case 14:
+          /* Start the binary event trace, decode with Tools/trace_decode.py */
+          TRACE_Start();
+          break;
+
+        case 15:
+          /* Stop the event trace */
+          TRACE_Stop();
+          break;
+
+        case 16:
+          /* Report the transmit queues */
+          UARTTX_Report();
+          break;
+
+        case 17:
+          /* Report the owners and the usage of the DMA channels */
+          DMAALLOC_Report();
+          break;
+
+        case 18:
+          /* Stage a buffer from the LMU into DSPR0 with the copy engines */
+          DMACOPY_SelfTest();
+          break;
+
+        case 19:
+          /* Report the copy engines and the self test */
+          DMACOPY_Report();
           break;
 
 				default:
@@ -93,7 +217,22 @@ void scheduler(void)
 			test = 0;
 		}
 
+		/* log mask commands received over the UART */
+		if (ASCLIN3_ReadBlock(rxBlock, sizeof(rxBlock)) != 0)
+		{
+			if (LOG_Command(rxBlock, sizeof(rxBlock)) != FALSE)
+			{
+				LOG_INFO(log_Module_scheduler, "log masks %02X %02X %02X", LOG_masks[0], LOG_masks[1], LOG_masks[2]);
+			}
+		}
+
+		/* queue recorded trace events and log messages, start the next transmission */
+		TRACE_Drain();
+		LOG_Drain();
+		UARTTX_Poll();
+
 		cnt++;
+		CPULOAD_Idle();
 	}
 
 }
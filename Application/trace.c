@@ -0,0 +1,306 @@
+/*******************************************************************************
+ * \file trace.c
+ * \brief Binary event trace streamed over ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "IfxCpu_Intrinsics.h"
+#include "Ifx_reg.h"
+#include "NoClearDef.h"
+
+#include "dvfs_public.h"
+#include "trace_public.h"
+#include "uarttx_public.h"
+
+#define TRACE_FRAME_HEADER 3u  /**< \brief sync bytes and event count */
+#define TRACE_FRAME_SIZE   (TRACE_FRAME_HEADER + (TRACE_FRAME_EVENTS * sizeof(TRACE_Record)) + 1u)
+
+/** \brief Ring indices of one core.
+ * head is written by the recording core only, tail by the drain on CPU0
+ * only, so the rings need no lock between the cores.
+ */
+typedef struct
+{
+  volatile uint32 head;      /**< \brief next record to write, free running */
+  volatile uint32 tail;      /**< \brief next record to send, free running */
+  volatile uint32 dropped;   /**< \brief records lost, ring full */
+  uint32          reported;  /**< \brief dropped count already sent */
+} TRACE_Ring;
+
+/** \addtogroup Trace_Variables */
+/* Records in the DSPR of the recording core, only valid between tail and head */
+NOCLEAR_BEGIN(cpu0)
+TRACE_Record TRACE_records0[TRACE_RING_SIZE];
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu1)
+TRACE_Record TRACE_records1[TRACE_RING_SIZE];
+NOCLEAR_END
+NOCLEAR_BEGIN(cpu2)
+TRACE_Record TRACE_records2[TRACE_RING_SIZE];
+NOCLEAR_END
+
+/* private data */
+static TRACE_Record * const TRACE_records[IFXCPU_NUM_MODULES] =
+{
+  TRACE_records0,
+  TRACE_records1,
+  TRACE_records2,
+};
+
+/* STMn is read by CPUn, the STMs of the cores run synchronously */
+static Ifx_STM * const TRACE_stm[IFXCPU_NUM_MODULES] =
+{
+  &MODULE_STM0,
+  &MODULE_STM1,
+  &MODULE_STM2,
+};
+
+static TRACE_Ring       TRACE_rings[IFXCPU_NUM_MODULES];
+static volatile boolean TRACE_running;
+static uint32           TRACE_nextRing;
+static uint8            TRACE_frame[TRACE_FRAME_SIZE];
+
+/* private functions */
+
+/** \brief Fill a record with the current time of the calling core.
+ * Interrupts must be disabled, TIM0 and CAP are read as one pair.
+ *
+ * \param record record to fill
+ * \param cpu calling core
+ * \param id event ID
+ * \param arg0 first argument
+ * \param arg1 second argument
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+IFX_INLINE void TRACE_Fill(TRACE_Record *record, uint32 cpu, uint8 id, uint16 arg0, uint32 arg1)
+{
+  Ifx_STM *stm = TRACE_stm[cpu];
+
+  record->stmLow  = stm->TIM0.U;
+  record->stmHigh = stm->CAP.U;
+  record->cpu     = (uint8)cpu;
+  record->id      = id;
+  record->arg0    = arg0;
+  record->arg1    = arg1;
+}
+
+/** \brief Append a record to the frame.
+ *
+ * \param pos write position in the frame
+ * \param record record to append
+ * \return position behind the record
+ *
+ *  \ingroup Trace
+ */
+static uint32 TRACE_Append(uint32 pos, const TRACE_Record *record)
+{
+  const uint8 *src = (const uint8 *)record;
+
+  for (uint32 i = 0; i < sizeof(TRACE_Record); i++)
+  {
+    TRACE_frame[pos++] = src[i];
+  }
+
+  return pos;
+}
+
+/* global functions */
+
+/** \brief Record an event on the calling core.
+ * Costs a few cycles: one index check, a copy of the STM and the arguments
+ * and a store of the head index.
+ *
+ * \param id event ID
+ * \param arg0 first argument
+ * \param arg1 second argument
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+void TRACE_Event(uint8 id, uint16 arg0, uint32 arg1)
+{
+  uint32      cpu;
+  TRACE_Ring *ring;
+  uint32      head;
+  boolean     enabled;
+
+  if (TRACE_running == FALSE)
+  {
+    return;
+  }
+
+  cpu     = IfxCpu_getCoreIndex();
+  ring    = &TRACE_rings[cpu];
+  enabled = IfxCpu_disableInterrupts();
+  head    = ring->head;
+
+  if ((head - ring->tail) < TRACE_RING_SIZE)
+  {
+    TRACE_Fill(&TRACE_records[cpu][head & (TRACE_RING_SIZE - 1u)], cpu, id, arg0, arg1);
+    /* the record must be visible to CPU0 before the index */
+    __dsync();
+    ring->head = head + 1u;
+  }
+  else
+  {
+    ring->dropped++;
+  }
+
+  IfxCpu_restoreInterrupts(enabled);
+}
+
+/** \brief Clear the rings and start recording on all cores.
+ * The first event is the STM frequency, the decoder needs it to convert
+ * the time stamps.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+void TRACE_Start(void)
+{
+  TRACE_running = FALSE;
+
+  for (uint32 cpu = 0; cpu < IFXCPU_NUM_MODULES; cpu++)
+  {
+    TRACE_rings[cpu].tail     = TRACE_rings[cpu].head;
+    TRACE_rings[cpu].reported = TRACE_rings[cpu].dropped;
+  }
+
+  TRACE_running = TRUE;
+  TRACE_UpdateClock();
+}
+
+/** \brief Stop recording.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+void TRACE_Stop(void)
+{
+  TRACE_running = FALSE;
+}
+
+/** \brief Send one frame of recorded events if the bulk transmit queue has room.
+ * Frame: TRACE_SYNC0, TRACE_SYNC1, number of records, the records, 8 bit
+ * sum of the records. The rings are visited in turn, so a busy core can
+ * not starve the others.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+void TRACE_Drain(void)
+{
+  uint32 pos   = TRACE_FRAME_HEADER;
+  uint32 count = 0;
+  uint8  sum   = 0;
+
+  if (UARTTX_GetFree(uarttx_Class_bulk) < TRACE_FRAME_SIZE)
+  {
+    return;
+  }
+
+  for (uint32 n = 0; (n < IFXCPU_NUM_MODULES) && (count < TRACE_FRAME_EVENTS); n++)
+  {
+    uint32      cpu     = (TRACE_nextRing + n) % IFXCPU_NUM_MODULES;
+    TRACE_Ring *ring    = &TRACE_rings[cpu];
+    uint32      head    = ring->head;
+    uint32      tail    = ring->tail;
+    uint32      dropped = ring->dropped;
+
+    if ((dropped != ring->reported) && (count < TRACE_FRAME_EVENTS))
+    {
+      TRACE_Record record;
+      boolean      enabled = IfxCpu_disableInterrupts();
+
+      TRACE_Fill(&record, IfxCpu_getCoreIndex(), trace_Event_dropped, (uint16)cpu, dropped - ring->reported);
+      IfxCpu_restoreInterrupts(enabled);
+      pos            = TRACE_Append(pos, &record);
+      ring->reported = dropped;
+      count++;
+    }
+
+    while ((tail != head) && (count < TRACE_FRAME_EVENTS))
+    {
+      pos = TRACE_Append(pos, &TRACE_records[cpu][tail & (TRACE_RING_SIZE - 1u)]);
+      tail++;
+      count++;
+    }
+    ring->tail = tail;
+  }
+  TRACE_nextRing = (TRACE_nextRing + 1u) % IFXCPU_NUM_MODULES;
+
+  if (count == 0)
+  {
+    return;
+  }
+
+  for (uint32 i = TRACE_FRAME_HEADER; i < pos; i++)
+  {
+    sum += TRACE_frame[i];
+  }
+
+  TRACE_frame[0]     = TRACE_SYNC0;
+  TRACE_frame[1]     = TRACE_SYNC1;
+  TRACE_frame[2]     = (uint8)count;
+  TRACE_frame[pos++] = sum;
+
+  (void)UARTTX_Send(uarttx_Class_bulk, TRACE_frame, (uint16)pos);
+}
+
+/** \brief Record the STM frequency after a clock change.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+void TRACE_UpdateClock(void)
+{
+  TRACE(trace_Event_clock, 0, DVFS_GetStmFrequency());
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
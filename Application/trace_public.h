@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * \file trace_public.h
+ * \brief Binary event trace streamed over ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef TRACE_PUBLIC_H
+#define TRACE_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1   /**< \brief 0 removes all trace points */
+#endif
+
+#define TRACE_RING_SIZE    128u  /**< \brief events per core, power of 2 */
+#define TRACE_FRAME_EVENTS 12u   /**< \brief events per UART frame, fits the ASCLIN3 transmit buffer */
+#define TRACE_SYNC0        0xA5u /**< \brief first frame byte, never part of the ASCII text output */
+#define TRACE_SYNC1        0x5Au /**< \brief second frame byte */
+
+/** \brief Event IDs, keep Tools/trace_decode.py in sync */
+typedef enum
+{
+  trace_Event_clock      = 0,  /**< \brief arg1: STM frequency in Hz from here on */
+  trace_Event_dropped    = 1,  /**< \brief arg1: events lost, ring full */
+  trace_Event_isrEnter   = 2,  /**< \brief arg0: SRPN */
+  trace_Event_isrExit    = 3,  /**< \brief arg0: SRPN */
+  trace_Event_dmaTxDone  = 4,  /**< \brief arg1: completed transfers */
+  trace_Event_dmaRxDone  = 5,  /**< \brief arg1: completed transfers */
+  trace_Event_uartError  = 6,  /**< \brief arg1: ASCLIN3 FLAGS */
+  trace_Event_command    = 7,  /**< \brief arg0: scheduler test command */
+  trace_Event_user       = 32  /**< \brief first ID free for the application */
+} trace_Event;
+
+/** \brief One event as stored in the ring and sent in a frame, little endian */
+typedef struct
+{
+  uint32 stmLow;   /**< \brief STM bits 0 to 31 */
+  uint32 stmHigh;  /**< \brief STM bits 32 to 63 */
+  uint8  cpu;      /**< \brief recording core */
+  uint8  id;       /**< \brief trace_Event */
+  uint16 arg0;     /**< \brief first argument */
+  uint32 arg1;     /**< \brief second argument */
+} TRACE_Record;
+
+#if TRACE_ENABLED
+/** \brief Record an event on the calling core, e.g. TRACE(trace_Event_command, test, 0) */
+#define TRACE(id, arg0, arg1) TRACE_Event((id), (uint16)(arg0), (uint32)(arg1))
+#else
+#define TRACE(id, arg0, arg1)
+#endif
+
+/** \brief Record an event on the calling core.
+ * Does nothing while the trace is stopped. Use the TRACE macro.
+ *
+ * \param id event ID
+ * \param arg0 first argument
+ * \param arg1 second argument
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+extern void TRACE_Event(uint8 id, uint16 arg0, uint32 arg1);
+
+/** \brief Clear the rings and start recording on all cores.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+extern void TRACE_Start(void);
+
+/** \brief Stop recording, the recorded events are still sent.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+extern void TRACE_Stop(void);
+
+/** \brief Send one frame of recorded events if the UART is idle.
+ * Never blocks, call it from the idle loop of CPU0.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+extern void TRACE_Drain(void);
+
+/** \brief Record the STM frequency after a clock change.
+ * Clock listener of the frequency scaling.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup Trace
+ */
+extern void TRACE_UpdateClock(void);
+
+#endif	/* end of file */
@@ -0,0 +1,432 @@
+/*******************************************************************************
+ * \file uarttx.c
+ * \brief Prioritised and rate limited transmit queues of ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxStm_reg.h"
+
+#include "asclin3_public.h"
+#include "dvfs_public.h"
+#include "report_public.h"
+#include "uarttx_public.h"
+
+#define UARTTX_HEADER 6u  /**< \brief length and time stamp in front of each message */
+
+/** \brief Queue and token bucket of one class */
+typedef struct
+{
+  const char *name;      /**< \brief name in the report */
+  uint8      *buffer;    /**< \brief message bytes, wrap around */
+  uint32      size;      /**< \brief size of buffer, power of 2 */
+  uint32      rate;      /**< \brief bytes per second, 0 for no limit */
+  uint32      burst;     /**< \brief bucket depth in bytes */
+  uint32      head;      /**< \brief next byte to write, free running */
+  uint32      tail;      /**< \brief next byte to send, free running */
+  uint32      threshold; /**< \brief coalescing threshold in bytes, 0 for none */
+  uint32      maxDelay;  /**< \brief coalescing window in us */
+  uint32      queued;    /**< \brief messages in the queue */
+  uint32      pending;   /**< \brief message bytes in the queue, without headers */
+  uint64      credit;    /**< \brief tokens in bytes times fSTM */
+  uint32      refilled;  /**< \brief STM time of the last refill */
+  UARTTX_Stats stats;
+} UARTTX_Queue;
+
+/** \addtogroup UartTx_Variables */
+/* private data */
+#define UARTTX_CLASS_BUFFER(name, queueSize, rate, burst, threshold, maxDelay) static uint8 UARTTX_buffer_##name[queueSize];
+UARTTX_CLASSES(UARTTX_CLASS_BUFFER)
+
+#define UARTTX_CLASS_QUEUE(name, queueSize, rate, burst, threshold, maxDelay) \
+  {#name, UARTTX_buffer_##name, (queueSize), (rate), (((burst) < UARTTX_MAX_MESSAGE) ? UARTTX_MAX_MESSAGE : (burst)), \
+   0, 0, (threshold), (maxDelay)},
+
+static UARTTX_Queue UARTTX_queues[uarttx_Class_count] =
+{
+  UARTTX_CLASSES(UARTTX_CLASS_QUEUE)
+};
+
+/* one transfer, contiguous for the DMA */
+static uint8 UARTTX_message[UARTTX_MAX_MESSAGE];
+
+/* private functions */
+
+/** \brief Copy bytes into a queue.
+ *
+ * \param queue destination queue
+ * \param src bytes to copy
+ * \param len number of bytes
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+static void UARTTX_Put(UARTTX_Queue *queue, const uint8 *src, uint32 len)
+{
+  for (uint32 i = 0; i < len; i++)
+  {
+    queue->buffer[queue->head++ & (queue->size - 1u)] = src[i];
+  }
+}
+
+/** \brief Copy bytes out of a queue.
+ *
+ * \param queue source queue
+ * \param dst destination
+ * \param len number of bytes
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+static void UARTTX_Get(UARTTX_Queue *queue, uint8 *dst, uint32 len)
+{
+  for (uint32 i = 0; i < len; i++)
+  {
+    dst[i] = queue->buffer[queue->tail++ & (queue->size - 1u)];
+  }
+}
+
+/** \brief Read a header field of the first message, the queue must not be empty.
+ *
+ * \param queue queue to inspect
+ * \param offset first byte of the field in the header
+ * \param size field size in bytes
+ * \return field value
+ *
+ *  \ingroup UartTx
+ */
+static uint32 UARTTX_Peek(const UARTTX_Queue *queue, uint32 offset, uint32 size)
+{
+  uint32 mask  = queue->size - 1u;
+  uint32 value = 0;
+
+  for (uint32 i = size; i > 0; i--)
+  {
+    value = (value << 8) | queue->buffer[(queue->tail + offset + i - 1u) & mask];
+  }
+
+  return value;
+}
+
+/** \brief Check if a coalescing class should wait for more messages.
+ *
+ * \param queue queue to check, must not be empty
+ * \param now STM time
+ * \param stmFrequency STM frequency in Hz
+ * \return TRUE while below the threshold and within the window of the oldest message
+ *
+ *  \ingroup UartTx
+ */
+static boolean UARTTX_IsGathering(const UARTTX_Queue *queue, uint32 now, uint32 stmFrequency)
+{
+  uint32 age = now - UARTTX_Peek(queue, 2u, 4u);
+
+  if ((queue->threshold == 0) || (queue->pending >= queue->threshold))
+  {
+    return FALSE;
+  }
+
+  return (age < (queue->maxDelay * (stmFrequency / 1000000u))) ? TRUE : FALSE;
+}
+
+/** \brief Add the tokens earned since the last refill.
+ *
+ * \param queue queue to refill
+ * \param now STM time
+ * \param stmFrequency STM frequency in Hz
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+static void UARTTX_Refill(UARTTX_Queue *queue, uint32 now, uint32 stmFrequency)
+{
+  uint64 limit = (uint64)queue->burst * stmFrequency;
+
+  queue->credit  += (uint64)(now - queue->refilled) * queue->rate;
+  queue->refilled = now;
+  if (queue->credit > limit)
+  {
+    queue->credit = limit;
+  }
+}
+
+/* global functions */
+
+/** \brief Queue a message, never blocks.
+ *
+ * \param cls priority class
+ * \param data message, copied into the queue
+ * \param len message length, at most UARTTX_MAX_MESSAGE
+ * \return TRUE if the message has been queued
+ *
+ *  \ingroup UartTx
+ */
+boolean UARTTX_Send(uarttx_Class cls, const uint8 *data, uint16 len)
+{
+  UARTTX_Queue *queue = &UARTTX_queues[cls];
+  uint8         header[UARTTX_HEADER];
+  uint32        stamp = STM0_TIM0.U;
+
+  if ((len == 0) || (len > UARTTX_GetFree(cls)))
+  {
+    queue->stats.dropped++;
+    return FALSE;
+  }
+
+  header[0] = (uint8)len;
+  header[1] = (uint8)(len >> 8);
+  header[2] = (uint8)stamp;
+  header[3] = (uint8)(stamp >> 8);
+  header[4] = (uint8)(stamp >> 16);
+  header[5] = (uint8)(stamp >> 24);
+
+  UARTTX_Put(queue, header, UARTTX_HEADER);
+  UARTTX_Put(queue, data, len);
+  queue->queued++;
+  queue->pending += len;
+
+  return TRUE;
+}
+
+/** \brief Queue a message, wait for space in the queue.
+ * The queues are served while waiting.
+ *
+ * \param cls priority class
+ * \param data message, copied into the queue
+ * \param len message length, at most UARTTX_MAX_MESSAGE
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_SendWait(uarttx_Class cls, const uint8 *data, uint16 len)
+{
+  while (len > UARTTX_GetFree(cls))
+  {
+    UARTTX_Poll();
+  }
+
+  (void)UARTTX_Send(cls, data, len);
+  UARTTX_Poll();
+}
+
+/** \brief Largest message which fits into the queue of a class now.
+ *
+ * \param cls priority class
+ * \return message length in bytes
+ *
+ *  \ingroup UartTx
+ */
+uint32 UARTTX_GetFree(uarttx_Class cls)
+{
+  const UARTTX_Queue *queue = &UARTTX_queues[cls];
+  uint32              free  = queue->size - (queue->head - queue->tail);
+
+  free = (free > UARTTX_HEADER) ? (free - UARTTX_HEADER) : 0;
+
+  return (free < UARTTX_MAX_MESSAGE) ? free : UARTTX_MAX_MESSAGE;
+}
+
+/** \brief Start the next transfer if the transmit DMA is idle.
+ * The classes are checked from the highest priority down. A class with a
+ * rate limit sends only if its bucket holds the first message, otherwise a
+ * lower class may use the link. A coalescing class waits until its queued
+ * bytes reach the threshold or its oldest message the end of the window,
+ * then as many messages as the bucket and UARTTX_MAX_MESSAGE allow are
+ * sent in one transfer.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_Poll(void)
+{
+  uint32 now;
+  uint32 stmFrequency;
+
+  if (ASCLIN3_IsTxBusy() != FALSE)
+  {
+    return;
+  }
+
+  now          = STM0_TIM0.U;
+  stmFrequency = DVFS_GetStmFrequency();
+
+  for (uint32 cls = 0; cls < uarttx_Class_count; cls++)
+  {
+    UARTTX_Queue *queue = &UARTTX_queues[cls];
+    uint32        total = 0;
+
+    if ((queue->queued == 0) || (UARTTX_IsGathering(queue, now, stmFrequency) != FALSE))
+    {
+      continue;
+    }
+
+    if (queue->rate != 0)
+    {
+      UARTTX_Refill(queue, now, stmFrequency);
+    }
+
+    do
+    {
+      uint32 len  = UARTTX_Peek(queue, 0u, 2u);
+      uint64 cost = (uint64)len * stmFrequency;
+      uint8  header[UARTTX_HEADER];
+      uint32 delay;
+
+      if (((total + len) > UARTTX_MAX_MESSAGE) || ((queue->rate != 0) && (queue->credit < cost)))
+      {
+        break;
+      }
+      if (queue->rate != 0)
+      {
+        queue->credit -= cost;
+      }
+
+      UARTTX_Get(queue, header, UARTTX_HEADER);
+      UARTTX_Get(queue, &UARTTX_message[total], len);
+      queue->queued--;
+      queue->pending -= len;
+      total          += len;
+
+      delay = now - ((uint32)header[2] | ((uint32)header[3] << 8) | ((uint32)header[4] << 16) | ((uint32)header[5] << 24));
+      queue->stats.messages++;
+      queue->stats.delaySum += delay;
+      if (delay > queue->stats.delayMax)
+      {
+        queue->stats.delayMax = delay;
+      }
+    } while ((queue->threshold != 0) && (queue->queued != 0));
+
+    if (total != 0)
+    {
+      queue->stats.transfers++;
+      queue->stats.bytes += total;
+      ASCLIN3_Write(UARTTX_message, (uint16)total);
+      return;
+    }
+  }
+}
+
+/** \brief Change the token bucket of a class.
+ *
+ * \param cls priority class
+ * \param rate bytes per second, 0 for no limit
+ * \param burst bucket depth in bytes, raised to UARTTX_MAX_MESSAGE
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_SetRate(uarttx_Class cls, uint32 rate, uint32 burst)
+{
+  UARTTX_Queue *queue = &UARTTX_queues[cls];
+
+  queue->rate     = rate;
+  queue->burst    = (burst < UARTTX_MAX_MESSAGE) ? UARTTX_MAX_MESSAGE : burst;
+  queue->credit   = 0;
+  queue->refilled = STM0_TIM0.U;
+}
+
+/** \brief Change the coalescing of a class.
+ *
+ * \param cls priority class
+ * \param threshold queued bytes which start a transfer, 0 to disable coalescing
+ * \param maxDelay longest wait of a message for more data in us
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_SetCoalescing(uarttx_Class cls, uint32 threshold, uint32 maxDelay)
+{
+  UARTTX_queues[cls].threshold = threshold;
+  UARTTX_queues[cls].maxDelay  = maxDelay;
+}
+
+/** \brief Copy the statistics of a class.
+ *
+ * \param cls priority class
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_GetStats(uarttx_Class cls, UARTTX_Stats *stats)
+{
+  *stats = UARTTX_queues[cls].stats;
+}
+
+/** \brief Send the statistics of all classes over the UART.
+ * "TXQ <class> msgs=<n> xfers=<n> bytes=<n> dropped=<n> queued=<n> delay=<mean us> max=<us>"
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+void UARTTX_Report(void)
+{
+  uint32 ticksPerUs = DVFS_GetStmFrequency() / 1000000u;
+
+  for (uint32 cls = 0; cls < uarttx_Class_count; cls++)
+  {
+    UARTTX_Stats  stats;
+    UARTTX_Queue *queue = &UARTTX_queues[cls];
+
+    UARTTX_GetStats((uarttx_Class)cls, &stats);
+
+    REPORT_String("TXQ ");
+    REPORT_String(queue->name);
+    REPORT_String(" msgs=");
+    REPORT_Dec32(stats.messages);
+    REPORT_String(" xfers=");
+    REPORT_Dec32(stats.transfers);
+    REPORT_String(" bytes=");
+    REPORT_Dec32(stats.bytes);
+    REPORT_String(" dropped=");
+    REPORT_Dec32(stats.dropped);
+    REPORT_String(" queued=");
+    REPORT_Dec32(queue->queued);
+    REPORT_String(" delay=");
+    REPORT_Dec32((stats.messages != 0) ? (uint32)(stats.delaySum / stats.messages / ticksPerUs) : 0u);
+    REPORT_String("us max=");
+    REPORT_Dec32(stats.delayMax / ticksPerUs);
+    REPORT_String("us");
+    REPORT_NewLine();
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * \file uarttx_public.h
+ * \brief Prioritised and rate limited transmit queues of ASCLIN3
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef UARTTX_PUBLIC_H
+#define UARTTX_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "UartTxDef.h"
+
+#define UARTTX_MAX_MESSAGE 200u  /**< \brief largest message, one DMA transfer */
+
+#define UARTTX_CLASS_ENUM(name, queueSize, rate, burst, threshold, maxDelay) uarttx_Class_##name,
+
+/** \brief Priority classes, highest first, see UARTTX_CLASSES in UartTxDef.h */
+typedef enum
+{
+  UARTTX_CLASSES(UARTTX_CLASS_ENUM)
+  uarttx_Class_count
+} uarttx_Class;
+
+/** \brief Queueing statistics of one class, times in STM ticks */
+typedef struct
+{
+  uint32 messages;  /**< \brief messages sent */
+  uint32 transfers; /**< \brief DMA transfers, less than messages when coalescing */
+  uint32 bytes;     /**< \brief bytes sent */
+  uint32 dropped;   /**< \brief messages rejected, queue full */
+  uint32 delayMax;  /**< \brief longest time from UARTTX_Send to the DMA start */
+  uint64 delaySum;  /**< \brief sum for the mean delay */
+} UARTTX_Stats;
+
+/** \brief Queue a message, never blocks.
+ * CPU0 only, the queues are not shared between the cores.
+ *
+ * \param cls priority class
+ * \param data message, copied into the queue
+ * \param len message length, at most UARTTX_MAX_MESSAGE
+ * \return TRUE if the message has been queued
+ *
+ *  \ingroup UartTx
+ */
+extern boolean UARTTX_Send(uarttx_Class cls, const uint8 *data, uint16 len);
+
+/** \brief Queue a message, wait for space in the queue.
+ *
+ * \param cls priority class
+ * \param data message, copied into the queue
+ * \param len message length, at most UARTTX_MAX_MESSAGE
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_SendWait(uarttx_Class cls, const uint8 *data, uint16 len);
+
+/** \brief Largest message which fits into the queue of a class now.
+ *
+ * \param cls priority class
+ * \return message length in bytes
+ *
+ *  \ingroup UartTx
+ */
+extern uint32 UARTTX_GetFree(uarttx_Class cls);
+
+/** \brief Start the next transfer if the transmit DMA is idle.
+ * Call it from the idle loop of CPU0, it also ends the coalescing windows.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_Poll(void);
+
+/** \brief Change the token bucket of a class.
+ *
+ * \param cls priority class
+ * \param rate bytes per second, 0 for no limit
+ * \param burst bucket depth in bytes, raised to UARTTX_MAX_MESSAGE
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_SetRate(uarttx_Class cls, uint32 rate, uint32 burst);
+
+/** \brief Change the coalescing of a class.
+ *
+ * \param cls priority class
+ * \param threshold queued bytes which start a transfer, 0 to disable coalescing
+ * \param maxDelay longest wait of a message for more data in us
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_SetCoalescing(uarttx_Class cls, uint32 threshold, uint32 maxDelay);
+
+/** \brief Copy the statistics of a class.
+ *
+ * \param cls priority class
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_GetStats(uarttx_Class cls, UARTTX_Stats *stats);
+
+/** \brief Send the statistics of all classes over the UART.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup UartTx
+ */
+extern void UARTTX_Report(void);
+
+#endif	/* end of file */
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * \file DmaDef.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef DMADEF_H
+#define DMADEF_H 1
+
+#include "IntPrioDef.h"
+
+/******************************************************************************/
+/* DMA channel users, see Application/dmaalloc.c
+ *
+ * Every driver which uses a DMA channel is listed here and claims its
+ * channel with DMAALLOC_Claim when it initialises. The allocator checks
+ * that no channel and no interrupt priority is given to two users.
+ *
+ * X(name, channel, partition, tos, srpn):
+ *   channel    channel for hardware requests, it is the SRPN of the service
+ *              request node which triggers it (TOS_DMA). DMAALLOC_ANY for
+ *              software requests, the user gets the lowest free channel of
+ *              DMAALLOC_POOL_FIRST..DMAALLOC_POOL_LAST. A higher channel
+ *              wins the arbitration of the move engine.
+ *   partition  hardware resource partition 0..3 of the channel (HRR.HRP)
+ *   tos        core which services the channel interrupt, TOS_CPU0..2
+ *   srpn       priority of the channel interrupt, 0 for none; the cores
+ *              share one vector table, so it must be unique
+ */
+/******************************************************************************/
+#define DMAALLOC_USERS(X)                                                   \
+    X(asclin3Tx, SRPN_DMA_CH_QSPI3_TX, 0, TOS_CPU0, SRPN_CPU0_DMA_CH5)      \
+    X(asclin3Rx, SRPN_DMA_CH_QSPI3_RX, 0, TOS_CPU0, SRPN_CPU0_DMA_CH6)      \
+    X(copy0,     DMAALLOC_ANY,         0, TOS_CPU0, SRPN_CPU0_DMA_COPY0)    \
+    X(copy1,     DMAALLOC_ANY,         0, TOS_CPU0, SRPN_CPU0_DMA_COPY1)
+
+#define DMAALLOC_POOL_FIRST  16u   /* channels handed out for DMAALLOC_ANY */
+#define DMAALLOC_POOL_LAST   31u
+
+/******************************************************************************/
+
+#endif /* DMADEF_H */
@@ -46,6 +46,11 @@
 /*********************************************************************************************************************/
 /*---------------------------------Configuration for Trap Hook Functions' Extensions---------------------------------*/
 /*********************************************************************************************************************/
-/* #define IFX_CFG_EXTEND_TRAP_HOOKS */ /* Decomment this line if the project needs to extend trap hook functions */
+#define IFX_CFG_EXTEND_TRAP_HOOKS /* Trap hooks are defined in Ifx_Cfg_Trap.h (crash recorder) */
+
+/*********************************************************************************************************************/
+/*--------------------------------Configuration for Startup Hook Functions' Extensions-------------------------------*/
+/*********************************************************************************************************************/
+#define IFX_CFG_EXTEND_CSTART_HOOKS /* Startup hooks are defined in Ifx_Cfg_CStart.h (boot time profiling) */
 
 #endif /* IFX_CFG_H */
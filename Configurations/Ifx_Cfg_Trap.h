@@ -0,0 +1,52 @@
+/**********************************************************************************************************************
+ * \file Ifx_Cfg_Trap.h
+ * \brief Trap hook configuration, included by IfxCpu_Trap.c.
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ * 
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of 
+ * business you are acting and (ii) Infineon Technologies AG or its licensees. If and as long as no such terms of use
+ * are agreed, use of this file is subject to following:
+ * 
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ * 
+ * Permission is hereby granted, free of charge, to any person or organization obtaining a copy of the software and 
+ * accompanying documentation covered by this license (the "Software") to use, reproduce, display, distribute, execute,
+ * and transmit the Software, and to prepare derivative works of the Software, and to permit third-parties to whom the
+ * Software is furnished to do so, all subject to the following:
+ * 
+ * The copyright notices in the Software and this entire statement, including the above license grant, this restriction
+ * and the following disclaimer, must be included in all copies of the Software, in whole or in part, and all 
+ * derivative works of the Software, unless such copies or derivative works are solely in the form of 
+ * machine-executable object code generated by a source language processor.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE 
+ * COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN 
+ * CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS 
+ * IN THE SOFTWARE.
+ *********************************************************************************************************************/
+
+#ifndef IFX_CFG_TRAP_H
+#define IFX_CFG_TRAP_H 1
+
+#include "crashdump_public.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------Crash recorder hooks------------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Snapshot the trap into the crash record of the core, it is sent over the UART at the next boot */
+#define IFX_CFG_CPU_TRAP_MME_HOOK(trapWatch)    CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+#define IFX_CFG_CPU_TRAP_IPE_HOOK(trapWatch)    CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+#define IFX_CFG_CPU_TRAP_IE_HOOK(trapWatch)     CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+#define IFX_CFG_CPU_TRAP_BE_HOOK(trapWatch)     CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+#define IFX_CFG_CPU_TRAP_ASSERT_HOOK(trapWatch) CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+#define IFX_CFG_CPU_TRAP_NMI_HOOK(trapWatch)    CRASHDUMP_Capture(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr)
+
+/* Halt if a debugger is attached, otherwise restart with an application reset which keeps the record */
+#define IFX_CFG_CPU_TRAP_DEBUG                  {__debug(); CRASHDUMP_Restart();}
+
+/* A context management trap may have no free context left for a call: capture, halt and restart inline */
+#define IFX_CFG_CPU_TRAP_CME_HOOK(trapWatch) \
+  {CRASHDUMP_CaptureInline(trapWatch.tClass, trapWatch.tId, trapWatch.tAddr); __debug(); CRASHDUMP_RestartInline();}
+
+#endif /* IFX_CFG_TRAP_H */
@@ -89,6 +89,21 @@
 #define SRPN_CPU0_DMA_CH5      19
 #define SRPN_CPU0_DMA_CH6      20
 
+/* Memory copy engines, see Application/dmacopy.c */
+#define SRPN_CPU0_DMA_COPY0    21
+#define SRPN_CPU0_DMA_COPY1    22
+
+/* Sampling profiler, one STM per core. The cores share one vector table,
+ * so the priorities must be unique */
+#define SRPN_CPU0_STM0_SR0     40
+#define SRPN_CPU1_STM1_SR0     41
+#define SRPN_CPU2_STM2_SR0     42
+
+/* CPU load windows, STMn compare 1 on CPUn */
+#define SRPN_CPU0_STM0_SR1     35
+#define SRPN_CPU1_STM1_SR1     36
+#define SRPN_CPU2_STM2_SR1     37
+
 
 /* Enter the DMA Channel in order */
 #define SRPN_DMA_CH_QSPI3_TX    5
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * \file LogDef.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef LOGDEF_H
+#define LOGDEF_H 1
+
+/******************************************************************************/
+/* Log levels and modules, see Application/log_public.h
+ *
+ * LOG_LEVEL selects the most verbose level which is compiled in. Calls of
+ * the levels above it expand to nothing, neither code nor format strings
+ * end up in the image. Production builds keep the default, lab builds set
+ * it on the command line, e.g. -DLOG_LEVEL=LOG_LEVEL_VERBOSE.
+ *
+ * The compiled levels are filtered at run time per module with a mask,
+ * bit n enables level n. LOG_DEFAULT_MASK is the mask after reset; the
+ * masks are changed with LOG_SetMask or over the UART with the 10 byte
+ * command "LOG m hh\r\n" (module m, mask hh in hex).
+ */
+/******************************************************************************/
+#define LOG_LEVEL_ERROR    0
+#define LOG_LEVEL_WARN     1
+#define LOG_LEVEL_INFO     2
+#define LOG_LEVEL_DEBUG    3
+#define LOG_LEVEL_VERBOSE  4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL          LOG_LEVEL_INFO
+#endif
+
+#define LOG_DEFAULT_MASK   0x07u  /* error, warning and info */
+
+/* Modules with their own mask, the number is used by the UART command */
+#define LOG_MODULES(X)      \
+    X(asclin)    /* 0 */    \
+    X(dma)       /* 1 */    \
+    X(scheduler) /* 2 */
+
+/******************************************************************************/
+
+#endif /* LOGDEF_H */
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ * \file NoClearDef.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef NOCLEARDEF_H
+#define NOCLEARDEF_H 1
+
+#include "Compilers.h"
+
+/******************************************************************************/
+/* Placement of variables which are not cleared by the startup code.
+ *
+ * Ifx_C_Init clears every .bss section listed in the copy table. Large I/O
+ * rings, trace buffers and crash records do not need this, and crash records
+ * must survive a warm reset. Variables placed between NOCLEAR_BEGIN and
+ * NOCLEAR_END keep their content over resets and contain random values after
+ * power on, their users must validate them (e.g. with a magic number).
+ *
+ * The memory is selected with one of the NOCLEAR_MEM_xxx names, the linker
+ * file locates the matching .bss.noclear_xxx section. Any other name fails to
+ * compile:
+ *
+ *   NOCLEAR_BEGIN(cpu0)
+ *   uint8 traceBuffer[4096];
+ *   NOCLEAR_END
+ */
+/******************************************************************************/
+#define NOCLEAR_MEM_cpu0  /* DSPR0 */
+#define NOCLEAR_MEM_cpu1  /* DSPR1 */
+#define NOCLEAR_MEM_cpu2  /* DSPR2 */
+#define NOCLEAR_MEM_lmu   /* LMU RAM */
+
+#if defined(__TASKING__)
+#define NOCLEAR_BEGIN(mem) NOCLEAR_MEM_##mem _Pragma("noclear") BEGIN_DATA_SECTION(noclear_##mem)
+#define NOCLEAR_END        END_DATA_SECTION _Pragma("clear")
+#else
+#define NOCLEAR_BEGIN(mem) NOCLEAR_MEM_##mem BEGIN_DATA_SECTION(noclear_##mem)
+#define NOCLEAR_END        END_DATA_SECTION
+#endif
+
+/******************************************************************************/
+
+#endif /* NOCLEARDEF_H */
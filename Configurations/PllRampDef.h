@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * \file PllRampDef.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef PLLRAMPDEF_H
+#define PLLRAMPDEF_H 1
+
+/******************************************************************************/
+/* PLL ramp profile, see Application/pllramp.c
+ *
+ * IfxScuCcu_init locks the PLL at the initial K2 divider (fVCO / 6 = 100MHz
+ * for a 20MHz crystal and a 200MHz target) and then lowers K2 step by step
+ * to limit the current jump. Each step is one PLLRAMP_STEP(k2Div, waitTime)
+ * entry: the K2 divider (not the register value) and the settling time in
+ * seconds before the next step. The K2 dividers must decrease strictly and
+ * the last one must give IFX_CFG_SCU_PLL_FREQUENCY, this is checked at run
+ * time and on the host with Tools/pllramp_check.py.
+ *
+ * The first PLLRAMP_EARLY_STEPS steps run inside IfxScuCcu_init. The
+ * remaining steps run after the UART is up, ASCLIN3 is re-bauded after each
+ * of them.
+ */
+/******************************************************************************/
+#define PLLRAMP_PROFILE                                \
+    PLLRAMP_STEP(5, 0.000100F) /* 120MHz */           \
+    PLLRAMP_STEP(4, 0.000100F) /* 150MHz */           \
+    PLLRAMP_STEP(3, 0.000100F) /* 200MHz */
+
+#define PLLRAMP_EARLY_STEPS   0          /* steps before the UART is up */
+#define PLLRAMP_INITIAL_WAIT  0.000200F  /* settling time at the initial K2 divider */
+
+/******************************************************************************/
+
+#endif /* PLLRAMPDEF_H */
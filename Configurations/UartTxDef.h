@@ -0,0 +1,67 @@
+/*******************************************************************************
+ * \file UartTxDef.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+#ifndef UARTTXDEF_H
+#define UARTTXDEF_H 1
+
+/******************************************************************************/
+/* Transmit priority classes of ASCLIN3, see Application/uarttx.c
+ *
+ * One queue per class, listed from the highest to the lowest priority.
+ * When the transmit DMA is idle the highest class with a queued message
+ * and enough tokens sends its next message, so a lower class is preempted
+ * at message boundaries only.
+ *
+ * X(name, queueSize, rate, burst, threshold, maxDelay):
+ *   queueSize  bytes of the queue including 6 bytes per message, power of 2
+ *   rate       token bucket rate in bytes per second, 0 for no limit
+ *   burst      token bucket depth in bytes, at least one full message
+ *   threshold  coalescing: queued bytes which start a transfer, 0 to send
+ *              every message on its own
+ *   maxDelay   coalescing: the oldest message is sent after this many us
+ *              even below the threshold
+ *
+ * A coalescing class gathers its messages into one DMA transfer of up to
+ * UARTTX_MAX_MESSAGE bytes. 115200 baud carry about 11500 bytes per
+ * second. The bulk classes are limited, so control responses wait for at
+ * most one bulk transfer.
+ */
+/******************************************************************************/
+#define UARTTX_CLASSES(X)                                                          \
+    X(control,   512,  0,    0,   0,   0)     /* REPORT text, command responses */ \
+    X(telemetry, 1024, 4000, 400, 160, 20000) /* deferred log messages */          \
+    X(bulk,      1024, 6000, 400, 160, 50000) /* event trace */
+
+/******************************************************************************/
+
+#endif /* UARTTXDEF_H */
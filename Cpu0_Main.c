@@ -27,22 +27,27 @@
 #include "Ifx_Types.h"
 #include "IfxCpu.h"
 #include "IfxScuWdt.h"
+#include "bootprof_public.h"
+#include "bootinit_public.h"
+#include "multicore_public.h"
 
 extern void scheduler(void);
 
-IfxCpu_syncEvent g_cpuSyncEvent = 0;
-
 int core0_main(void)
 {
+    BOOTPROF_Mark(bootprof_Phase_core0Main);
+
     /* !!WATCHDOG0 AND SAFETY WATCHDOG ARE DISABLED HERE!!
      * Enable the watchdogs and service them periodically if it is required
      */
     IfxScuWdt_disableCpuWatchdog(IfxScuWdt_getCpuWatchdogPassword());
-    IfxScuWdt_disableSafetyWatchdog(IfxScuWdt_getSafetyWatchdogPassword());
+    MULTICORE_OpenSafetyEndinit();    /* CPU1 and CPU2 are running and may hold the window */
+    SCU_WDTS_CON1.B.DR = 1;
+    MULTICORE_CloseSafetyEndinit();
     
-    /* Wait for CPU sync event */
-    IfxCpu_emitEvent(&g_cpuSyncEvent);
-    IfxCpu_waitEvent(&g_cpuSyncEvent, 1);
+    /* Run the initialisation jobs of this core, returns when all cores are done */
+    BOOTINIT_Run();
+    BOOTPROF_Mark(bootprof_Phase_cpuSync);
     
     scheduler();
 
@@ -27,8 +27,8 @@
 #include "Ifx_Types.h"
 #include "IfxCpu.h"
 #include "IfxScuWdt.h"
-
-extern IfxCpu_syncEvent g_cpuSyncEvent;
+#include "bootinit_public.h"
+#include "cpuload_public.h"
 
 int core1_main(void)
 {
@@ -39,12 +39,12 @@ int core1_main(void)
      */
     IfxScuWdt_disableCpuWatchdog(IfxScuWdt_getCpuWatchdogPassword());
     
-    /* Wait for CPU sync event */
-    IfxCpu_emitEvent(&g_cpuSyncEvent);
-    IfxCpu_waitEvent(&g_cpuSyncEvent, 1);
+    /* Run the initialisation jobs of this core, returns when all cores are done */
+    BOOTINIT_Run();
     
     while(1)
     {
+        CPULOAD_Idle();
     }
     return (1);
 }
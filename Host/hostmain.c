@@ -0,0 +1,443 @@
+/*******************************************************************************
+ * \file hostmain.c
+ * \brief Runs the firmware of CPU0 against the peripheral models
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* Usage: tc29x_sim [-t ms] [-q ms] [-s scale] [-o file | -p] [-u] [-k costs] [-a file] [-c ms:command]... [-r ms:hex]...
+ *   -t  simulated run time, default 2000ms, 0 runs until the process is stopped
+ *   -q  pace the script by the ASCLIN3 transmit line instead of the clock: an
+ *       action waits in addition until the line has been quiet for this time,
+ *       both simulated and of host CPU time of CPU0, the run ends at the first
+ *       quiet line after the last action. The traffic does not depend on the
+ *       speed or the load of the host, -t is the upper bound
+ *   -s  host time per simulated time, default 1
+ *   -o  file receiving the ASCLIN3 transmit line, default uart.bin
+ *   -p  connect the ASCLIN3 lines to a pseudo-terminal instead, its path is
+ *       printed as "SIM pty <path>" before the cores start
+ *   -u  no baud rate pacing, frames move as fast as the firmware handles them
+ *   -k  cycles of the timing model, e.g. access=12,move=10,irq=40
+ *   -a  trace every register access of the firmware into a file, see
+ *       Tools/sfr_report.py
+ *   -c  write the scheduler variable test at a simulated time, like the debugger
+ *   -r  put bytes, given in hex, on the ASCLIN3 receive line at a simulated time
+ *
+ * The unmodified core0_main, core1_main and core2_main run on one thread
+ * each, the main thread runs the time base. At the end the traffic, DMA and
+ * interrupt statistics and the estimate of the timing model are printed and the process exits; built with
+ * ThreadSanitizer the exit status reports the races found. With -p and the
+ * default scale host tools talk to the firmware like over a serial adapter,
+ * Tools/pty_bench.py measures the round trip and the throughput.
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "Ifx_Types.h"
+
+#include "simcore_public.h"
+#include "simirq_public.h"
+#include "simscu_public.h"
+#include "simcpu_public.h"
+#include "simstm_public.h"
+#include "simdma_public.h"
+#include "simasclin_public.h"
+#include "simpty_public.h"
+#include "simcost_public.h"
+#include "simtrace_public.h"
+
+#define HOSTMAIN_MAX_EVENTS   64u
+#define HOSTMAIN_MAX_RX       256u
+#define HOSTMAIN_ASCLIN       3u      /**< \brief ASCLIN3 */
+#define HOSTMAIN_TICK_US      20u     /**< \brief period of the time base */
+
+/** \brief Scripted action at a simulated time */
+typedef struct
+{
+  uint64 time;                    /**< \brief simulated time in ns */
+  uint32 command;                 /**< \brief value for test, 0 for received bytes */
+  uint8  rx[HOSTMAIN_MAX_RX];     /**< \brief bytes for the receive line */
+  uint32 rxLen;
+} HOSTMAIN_Event;
+
+extern int core0_main(void);
+extern int core1_main(void);
+extern int core2_main(void);
+extern volatile uint32 test;
+
+/** \addtogroup HostMain_Variables */
+/* private data */
+static HOSTMAIN_Event HOSTMAIN_events[HOSTMAIN_MAX_EVENTS];
+static uint32         HOSTMAIN_numEvents;
+static uint32         HOSTMAIN_nextEvent;
+static uint64         HOSTMAIN_duration = 2000000000u;
+static uint64         HOSTMAIN_quiet;
+static uint32         HOSTMAIN_txBytes;      /**< \brief frames sent at the last activity */
+static uint64         HOSTMAIN_activity;     /**< \brief CPU time of CPU0 at the last frame or command */
+static SIMCOST_Costs  HOSTMAIN_costs    = {SIMCOST_DEFAULT_ACCESS, SIMCOST_DEFAULT_MOVE, SIMCOST_DEFAULT_IRQ};
+
+/* private functions */
+
+/** \brief Print the statistics of the run.
+ *
+ * \param now simulated time
+ * \return None
+ *
+ *  \ingroup HostMain
+ */
+static void HOSTMAIN_Summary(uint64 now)
+{
+  SIMASCLIN_Stats  uart;
+  SIMCOST_Estimate cost;
+  uint64           span;
+
+  SIMASCLIN_GetStats(HOSTMAIN_ASCLIN, &uart);
+  span = uart.txLast - uart.txFirst;
+
+  printf("SIM time=%llums fCPU=%uHz fSTM=%uHz\n", (unsigned long long)(now / 1000000u),
+         SIMSCU_GetCpuFrequency(0), SIMSCU_GetStmFrequency());
+  printf("SIM ASCLIN3 tx=%u rx=%u txOverflow=%u rxOverflow=%u throughput=%lluB/s\n",
+         uart.txBytes, uart.rxBytes, uart.txOverflow, uart.rxOverflow,
+         (unsigned long long)((span != 0) ? (((uint64)(uart.txBytes - 1u) * 1000000000u) / span) : 0u));
+
+  for (uint32 channel = 0; channel < SIMDMA_NUM_CHANNELS; channel++)
+  {
+    SIMDMA_Stats dma;
+
+    SIMDMA_GetStats(channel, &dma);
+    if ((dma.transfers != 0) || (dma.lost != 0))
+    {
+      printf("SIM DMA ch%u transactions=%u transfers=%u bytes=%u lost=%u\n",
+             channel, dma.transactions, dma.transfers, dma.bytes, dma.lost);
+    }
+  }
+
+  for (uint32 core = 0; core < SIMCPU_NUM_CORES; core++)
+  {
+    for (uint32 srpn = 1; srpn < 256u; srpn++)
+    {
+      SIMIRQ_Stats irq;
+
+      SIMIRQ_GetStats(core, srpn, &irq);
+      if ((irq.count != 0) || (irq.lost != 0))
+      {
+        printf("SIM IRQ cpu=%u prio=%u count=%u lost=%u latency=%lluus max=%lluus\n", core, srpn, irq.count, irq.lost,
+               (unsigned long long)((irq.count != 0) ? (irq.latencySum / irq.count / 1000u) : 0u),
+               (unsigned long long)(irq.latencyMax / 1000u));
+      }
+    }
+  }
+
+  for (uint32 core = 0; core < SIMCPU_NUM_CORES; core++)
+  {
+    SIMTRACE_Stats sfr;
+
+    if (SIMTRACE_GetStats(core, &sfr) != FALSE)
+    {
+      printf("SIM SFR cpu=%u reads=%llu writes=%llu rmw=%llu\n", core, (unsigned long long)sfr.reads,
+             (unsigned long long)sfr.writes, (unsigned long long)sfr.rmw);
+    }
+  }
+
+  SIMCOST_GetEstimate(&cost);
+  printf("SIM TIMING path=%s intlevel=%u chdw=%uB frame=%lluns access=%u move=%u irq=%u\n",
+         (cost.dmaPath != FALSE) ? "dma" : "isr", cost.intLevel, cost.moveBytes, (unsigned long long)cost.frame,
+         HOSTMAIN_costs.access, HOSTMAIN_costs.move, HOSTMAIN_costs.irq);
+  printf("SIM TIMING accesses=%llu moves=%llu irqs=%llu requests=%u blocks=%u cpu=%.1fcyc/B dma=%.1fcyc/B "
+         "service=%lluns slack=%lldns\n",
+         (unsigned long long)cost.accesses, (unsigned long long)cost.moves, (unsigned long long)cost.irqs,
+         cost.requests, cost.transactions, cost.cpuPerByte, cost.dmaPerByte, (unsigned long long)cost.service,
+         (long long)cost.slack);
+  printf("SIM TIMING throughput=%uB/s bound=%s size=%uB first=%lluns latency=%lluns\n",
+         cost.throughput, cost.bound, cost.size, (unsigned long long)cost.first, (unsigned long long)cost.latency);
+  fflush(stdout);
+}
+
+/** \brief Execute the scripted actions which are due, end the run.
+ *
+ * \param now simulated time
+ * \return None
+ *
+ *  \ingroup HostMain
+ */
+static void HOSTMAIN_Step(uint64 now)
+{
+  boolean quiet = TRUE;
+
+  if (HOSTMAIN_quiet != 0)
+  {
+    SIMASCLIN_Stats uart;
+
+    uint64          cpu = SIMCORE_GetCpuTime(0);
+
+    /* the output of the boot or of the last command is on the line, CPU0 had
+     * the time to queue more: a host which does not run it does not end the run */
+    SIMASCLIN_GetStats(HOSTMAIN_ASCLIN, &uart);
+    if (uart.txBytes != HOSTMAIN_txBytes)
+    {
+      HOSTMAIN_txBytes  = uart.txBytes;
+      HOSTMAIN_activity = cpu;
+    }
+    quiet = (boolean)((uart.txBytes != 0) && ((now - uart.txLast) >= HOSTMAIN_quiet) &&
+                      ((cpu - HOSTMAIN_activity) >= HOSTMAIN_quiet));
+  }
+
+  while ((quiet != FALSE) && (HOSTMAIN_nextEvent < HOSTMAIN_numEvents) &&
+         (HOSTMAIN_events[HOSTMAIN_nextEvent].time <= now))
+  {
+    HOSTMAIN_Event *event = &HOSTMAIN_events[HOSTMAIN_nextEvent];
+
+    if (event->command != 0)
+    {
+      if (test != 0)
+      {
+        /* the last command is still being executed, retry on the next tick */
+        break;
+      }
+      test              = event->command;
+      HOSTMAIN_activity = SIMCORE_GetCpuTime(0);
+      quiet             = FALSE;
+    }
+    else
+    {
+      (void)SIMASCLIN_Receive(HOSTMAIN_ASCLIN, event->rx, event->rxLen);
+    }
+    HOSTMAIN_nextEvent++;
+  }
+
+  if ((HOSTMAIN_duration != 0) && (now >= HOSTMAIN_duration))
+  {
+    HOSTMAIN_Summary(now);
+    exit(0);
+  }
+
+  if ((HOSTMAIN_quiet != 0) && (quiet != FALSE) && (HOSTMAIN_nextEvent == HOSTMAIN_numEvents) && (test == 0))
+  {
+    HOSTMAIN_Summary(now);
+    exit(0);
+  }
+}
+
+/** \brief Parse a scripted action.
+ *
+ * \param arg time in ms, a colon and the command or the hex bytes
+ * \param command TRUE for a command, FALSE for received bytes
+ * \return None
+ *
+ *  \ingroup HostMain
+ */
+static void HOSTMAIN_AddEvent(const char *arg, boolean command)
+{
+  HOSTMAIN_Event *event = &HOSTMAIN_events[HOSTMAIN_numEvents];
+  char           *rest;
+
+  if (HOSTMAIN_numEvents == HOSTMAIN_MAX_EVENTS)
+  {
+    fprintf(stderr, "too many events\n");
+    exit(2);
+  }
+
+  memset(event, 0, sizeof(*event));
+  event->time = strtoull(arg, &rest, 0) * 1000000u;
+  if (*rest++ != ':')
+  {
+    fprintf(stderr, "expected ms:value, got %s\n", arg);
+    exit(2);
+  }
+
+  if (command != FALSE)
+  {
+    event->command = (uint32)strtoul(rest, NULL, 0);
+  }
+  else
+  {
+    while ((rest[0] != '\0') && (rest[1] != '\0') && (event->rxLen < HOSTMAIN_MAX_RX))
+    {
+      char byte[3] = {rest[0], rest[1], '\0'};
+
+      event->rx[event->rxLen++] = (uint8)strtoul(byte, NULL, 16);
+      rest += 2;
+    }
+  }
+
+  /* keep the script sorted by time */
+  for (uint32 i = HOSTMAIN_numEvents; (i > 0) && (HOSTMAIN_events[i - 1u].time > event->time); i--)
+  {
+    HOSTMAIN_Event swap = HOSTMAIN_events[i - 1u];
+
+    HOSTMAIN_events[i - 1u] = HOSTMAIN_events[i];
+    HOSTMAIN_events[i]      = swap;
+    event                   = &HOSTMAIN_events[i - 1u];
+  }
+  HOSTMAIN_numEvents++;
+}
+
+/** \brief Parse the costs of the timing model.
+ *
+ * \param arg comma separated name=cycles pairs of access, move and irq
+ * \return None
+ *
+ *  \ingroup HostMain
+ */
+static void HOSTMAIN_SetCosts(char *arg)
+{
+  for (char *item = strtok(arg, ","); item != NULL; item = strtok(NULL, ","))
+  {
+    char   *value = strchr(item, '=');
+    uint32 *cost  = NULL;
+
+    if (value != NULL)
+    {
+      *value++ = '\0';
+      cost     = (strcmp(item, "access") == 0) ? &HOSTMAIN_costs.access :
+                 ((strcmp(item, "move") == 0) ? &HOSTMAIN_costs.move :
+                 ((strcmp(item, "irq") == 0) ? &HOSTMAIN_costs.irq : NULL));
+    }
+    if (cost == NULL)
+    {
+      fprintf(stderr, "expected access=n, move=n or irq=n, got %s\n", item);
+      exit(2);
+    }
+    *cost = (uint32)strtoul(value, NULL, 0);
+  }
+}
+
+/* global functions */
+
+int main(int argc, char **argv)
+{
+  const char *output = "uart.bin";
+  uint32      scale  = 1;
+  boolean     pty    = FALSE;
+  boolean     paced  = TRUE;
+  int         fd     = -1;
+  int         opt;
+
+  while ((opt = getopt(argc, argv, "t:q:s:o:puk:a:c:r:")) != -1)
+  {
+    switch (opt)
+    {
+    case 't':
+      HOSTMAIN_duration = strtoull(optarg, NULL, 0) * 1000000u;
+      break;
+    case 'q':
+      HOSTMAIN_quiet = strtoull(optarg, NULL, 0) * 1000000u;
+      break;
+    case 's':
+      scale = (uint32)strtoul(optarg, NULL, 0);
+      break;
+    case 'o':
+      output = optarg;
+      break;
+    case 'p':
+      pty = TRUE;
+      break;
+    case 'u':
+      paced = FALSE;
+      break;
+    case 'k':
+      HOSTMAIN_SetCosts(optarg);
+      break;
+    case 'a':
+      if (SIMTRACE_Open(optarg) == FALSE)
+      {
+        perror(optarg);
+        return 1;
+      }
+      break;
+    case 'c':
+      HOSTMAIN_AddEvent(optarg, TRUE);
+      break;
+    case 'r':
+      HOSTMAIN_AddEvent(optarg, FALSE);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-t ms] [-q ms] [-s scale] [-o file | -p] [-u] [-k costs] [-a file] [-c ms:command]... [-r ms:hex]...\n",
+              argv[0]);
+      return 2;
+    }
+  }
+
+  if (pty == FALSE)
+  {
+    fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+      perror(output);
+      return 1;
+    }
+  }
+
+  SIMCORE_Init(scale);
+  SIMSCU_Init();
+  SIMCPU_Init();
+  SIMSTM_Init();
+  SIMIRQ_Init();
+  SIMDMA_Init();
+  SIMCOST_Init(HOSTMAIN_ASCLIN, &HOSTMAIN_costs);
+  if (pty != FALSE)
+  {
+    const char *name = SIMPTY_Open(HOSTMAIN_ASCLIN);
+
+    if (name == NULL)
+    {
+      perror("pty");
+      return 1;
+    }
+    printf("SIM pty %s\n", name);
+    fflush(stdout);
+  }
+  else
+  {
+    SIMASCLIN_Init(HOSTMAIN_ASCLIN, fd);
+  }
+  SIMASCLIN_SetPacing(HOSTMAIN_ASCLIN, paced);
+  SIMCORE_AddStep(HOSTMAIN_Step);
+
+  /* all cores start together, on the target CPU0 starts CPU1 and CPU2 in its startup code */
+  SIMCORE_StartCore(0, core0_main);
+  SIMCORE_StartCore(1, core1_main);
+  SIMCORE_StartCore(2, core2_main);
+  SIMCORE_Run(HOSTMAIN_TICK_US);
+
+  return 0;
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,569 @@
+/*******************************************************************************
+ * \file simasclin.c
+ * \brief ASCLIN model of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* ASC mode only. A frame written into the transmit FIFO moves into the shift
+ * register when it is idle and leaves it after the frame time given by BRG,
+ * BITCON, FRAMECON and fASCLINF. Every frame taken from the transmit FIFO
+ * which leaves it at or below TXFIFOCON.INTLEVEL is a TFL event, every frame which
+ * fills the receive FIFO to RXFIFOCON.INTLEVEL or more is an RFL event. An
+ * event sets its flag and, if enabled in FLAGSENABLE, raises the TX, RX or
+ * ERR service request. Without pacing every frame takes SIMASCLIN_UNPACED_NS.
+ */
+#include <unistd.h>
+
+#include "Ifx_Types.h"
+#include "IfxAsclin_reg.h"
+#include "IfxAsclin_bf.h"
+#include "IfxSrc_reg.h"
+
+#include "simcore_public.h"
+#include "simirq_public.h"
+#include "simscu_public.h"
+#include "simasclin_public.h"
+
+#define SIMASCLIN_LINE_SIZE    4096u   /**< \brief bytes waiting on the receive line, power of 2 */
+#define SIMASCLIN_MODE_ASC     1u
+#define SIMASCLIN_CLK_ASCLINF  8u
+#define SIMASCLIN_UNPACED_NS   1u      /**< \brief frame time without baud pacing */
+
+#define SIMASCLIN_FLAG(name)   (1u << IFX_ASCLIN_FLAGS_##name##_OFF)
+#define SIMASCLIN_TX_FLAGS     SIMASCLIN_FLAG(TFL)
+#define SIMASCLIN_RX_FLAGS     SIMASCLIN_FLAG(RFL)
+#define SIMASCLIN_ERR_FLAGS    (SIMASCLIN_FLAG(PE) | SIMASCLIN_FLAG(FE) | SIMASCLIN_FLAG(CE) | SIMASCLIN_FLAG(RFO) | \
+                                SIMASCLIN_FLAG(RFU) | SIMASCLIN_FLAG(TFO))
+
+/** \brief A FIFO of frames */
+typedef struct
+{
+  uint8  data[SIMASCLIN_FIFO_SIZE];
+  uint32 head;   /**< \brief next frame to read, free running */
+  uint32 fill;   /**< \brief frames in the FIFO */
+} SIMASCLIN_Fifo;
+
+/** \brief State of one module */
+typedef struct
+{
+  boolean         attached;
+  boolean         unpaced;     /**< \brief frames take SIMASCLIN_UNPACED_NS instead of the frame time */
+  boolean         advancing;   /**< \brief in SIMASCLIN_Advance, the DMA accesses of an event don't advance */
+  int             txFd;
+  SIMASCLIN_Fifo  tx;
+  SIMASCLIN_Fifo  rx;
+  boolean         shifting;    /**< \brief a frame is in the transmit shift register */
+  uint8           shift;       /**< \brief frame being sent */
+  uint64          txDone;      /**< \brief end of the frame being sent */
+  uint8           line[SIMASCLIN_LINE_SIZE];
+  uint32          lineHead;    /**< \brief next byte on the receive line, free running */
+  uint32          lineTail;    /**< \brief end of the bytes on the receive line, free running */
+  uint64          rxDone;      /**< \brief end of the frame being received */
+  SIMASCLIN_Stats stats;
+} SIMASCLIN_Port;
+
+/** \addtogroup SimAsclin_Variables */
+/* private data */
+static Ifx_ASCLIN * const SIMASCLIN_modules[SIMASCLIN_NUM_MODULES] =
+{
+  &MODULE_ASCLIN0, &MODULE_ASCLIN1, &MODULE_ASCLIN2, &MODULE_ASCLIN3
+};
+
+static SIMASCLIN_Port SIMASCLIN_ports[SIMASCLIN_NUM_MODULES];
+
+/* private functions */
+
+/** \brief Find the module of a register address.
+ *
+ * \param address register address
+ * \return module index
+ *
+ *  \ingroup SimAsclin
+ */
+static uint32 SIMASCLIN_Index(uint32 address)
+{
+  return (address - SIMCORE_ADDRESS(MODULE_ASCLIN0)) / sizeof(Ifx_ASCLIN);
+}
+
+/** \brief Duration of a frame, SIMASCLIN_UNPACED_NS without pacing.
+ *
+ * \param index module index
+ * \return frame time in ns, 0 if the baud rate logic has no clock
+ *
+ *  \ingroup SimAsclin
+ */
+static uint64 SIMASCLIN_FrameTime(uint32 index)
+{
+  uint64 frame = SIMASCLIN_GetFrameTime(index);
+
+  return ((frame != 0) && (SIMASCLIN_ports[index].unpaced != FALSE)) ? SIMASCLIN_UNPACED_NS : frame;
+}
+
+/** \brief Set flags, raise the service requests of the enabled ones.
+ *
+ * \param index module index
+ * \param flags FLAGS bits of the events
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Event(uint32 index, uint32 flags)
+{
+  Ifx_ASCLIN     *asclin  = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  Ifx_SRC_ASCLIN *src     = &MODULE_SRC.ASCLIN.ASCLIN[index];
+  uint32          enabled = flags & asclin->FLAGSENABLE.U;
+
+  asclin->FLAGS.U |= flags;
+
+  if ((enabled & SIMASCLIN_TX_FLAGS) != 0)
+  {
+    SIMIRQ_Raise(&src->TX);
+  }
+  if ((enabled & SIMASCLIN_RX_FLAGS) != 0)
+  {
+    SIMIRQ_Raise(&src->RX);
+  }
+  if ((enabled & SIMASCLIN_ERR_FLAGS) != 0)
+  {
+    SIMIRQ_Raise(&src->ERR);
+  }
+}
+
+/** \brief Copy the FIFO levels into the register image.
+ *
+ * \param index module index
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_UpdateFill(uint32 index)
+{
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+
+  asclin->TXFIFOCON.B.FILL = port->tx.fill;
+  asclin->RXFIFOCON.B.FILL = port->rx.fill;
+}
+
+/** \brief Check the transmit FIFO level after a frame has been taken.
+ *
+ * \param index module index
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_TxLevel(uint32 index)
+{
+  Ifx_ASCLIN *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+
+  SIMASCLIN_UpdateFill(index);
+  if (SIMASCLIN_ports[index].tx.fill <= asclin->TXFIFOCON.B.INTLEVEL)
+  {
+    SIMASCLIN_Event(index, SIMASCLIN_FLAG(TFL));
+  }
+}
+
+/** \brief Move the next frame of the transmit FIFO into the shift register.
+ *
+ * \param index module index
+ * \param start start of the frame
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_StartFrame(uint32 index, uint64 start)
+{
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+  uint64          frame  = SIMASCLIN_FrameTime(index);
+
+  if ((port->tx.fill == 0) || (frame == 0) || (asclin->TXFIFOCON.B.ENO == 0) ||
+      (asclin->FRAMECON.B.MODE != SIMASCLIN_MODE_ASC))
+  {
+    return;
+  }
+
+  port->shift    = port->tx.data[port->tx.head++ % SIMASCLIN_FIFO_SIZE];
+  port->tx.fill--;
+  port->shifting = TRUE;
+  port->txDone   = start + frame;
+  SIMASCLIN_TxLevel(index);
+}
+
+/** \brief Send and receive the frames which are complete at now.
+ *
+ * \param index module index
+ * \param now simulated time
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Advance(uint32 index, uint64 now)
+{
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+
+  if (port->advancing != FALSE)
+  {
+    /* the DMA serves an event of the frame before, it may not see the next
+     * frame before it has finished, or its requests would be lost */
+    return;
+  }
+  port->advancing = TRUE;
+
+  while ((port->shifting != FALSE) && (now >= port->txDone))
+  {
+    if (port->txFd >= 0)
+    {
+      (void)write(port->txFd, &port->shift, 1);
+    }
+    if (port->stats.txBytes == 0)
+    {
+      port->stats.txFirst = port->txDone;
+    }
+    port->stats.txBytes++;
+    port->stats.txLast = port->txDone;
+    port->shifting     = FALSE;
+    asclin->FLAGS.B.TC = 1;
+    SIMASCLIN_StartFrame(index, port->txDone);
+  }
+
+  while ((port->lineHead != port->lineTail) && (now >= port->rxDone))
+  {
+    uint64 frame = SIMASCLIN_FrameTime(index);
+    uint8  data  = port->line[port->lineHead++ % SIMASCLIN_LINE_SIZE];
+
+    if ((asclin->RXFIFOCON.B.ENI == 0) || (asclin->FRAMECON.B.MODE != SIMASCLIN_MODE_ASC) || (frame == 0))
+    {
+      /* receiver off, the line is idle */
+      port->lineHead = port->lineTail;
+      break;
+    }
+
+    if (port->rx.fill == SIMASCLIN_FIFO_SIZE)
+    {
+      port->stats.rxOverflow++;
+      SIMASCLIN_Event(index, SIMASCLIN_FLAG(RFO));
+    }
+    else
+    {
+      port->rx.data[(port->rx.head + port->rx.fill++) % SIMASCLIN_FIFO_SIZE] = data;
+      port->stats.rxBytes++;
+      SIMASCLIN_UpdateFill(index);
+      if (port->rx.fill >= asclin->RXFIFOCON.B.INTLEVEL)
+      {
+        SIMASCLIN_Event(index, SIMASCLIN_FLAG(RFL));
+      }
+    }
+
+    if (port->lineHead != port->lineTail)
+    {
+      port->rxDone += frame;
+    }
+  }
+
+  port->advancing = FALSE;
+}
+
+/** \brief Reset the module with KRST0 and KRST1.
+ *
+ * \param index module index
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Reset(uint32 index)
+{
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+
+  for (uint32 offset = offsetof(Ifx_ASCLIN, IOCR); offset <= offsetof(Ifx_ASCLIN, RXDATAD); offset += sizeof(uint32))
+  {
+    if (offset != offsetof(Ifx_ASCLIN, ID))
+    {
+      *(volatile uint32 *)((volatile uint8 *)asclin + offset) = 0;
+    }
+  }
+
+  port->tx.fill       = 0;
+  port->rx.fill       = 0;
+  port->shifting      = FALSE;
+  port->lineHead      = port->lineTail;
+  asclin->KRST0.U     = 0;
+  asclin->KRST1.U     = 0;
+  asclin->KRST0.B.RSTSTAT = 1;
+}
+
+/** \brief Update the FIFO levels and pop the receive FIFO.
+ *
+ * \param address accessed register
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Read(uint32 address)
+{
+  uint32          index  = SIMASCLIN_Index(address);
+  uint32          offset = address - SIMCORE_ADDRESS(*SIMASCLIN_modules[index]);
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+
+  SIMASCLIN_Advance(index, SIMCORE_Now());
+
+  if (offset == offsetof(Ifx_ASCLIN, RXDATA))
+  {
+    if (port->rx.fill == 0)
+    {
+      asclin->RXDATA.U = 0;
+      SIMASCLIN_Event(index, SIMASCLIN_FLAG(RFU));
+    }
+    else
+    {
+      asclin->RXDATA.U = port->rx.data[port->rx.head++ % SIMASCLIN_FIFO_SIZE];
+      port->rx.fill--;
+    }
+  }
+  else if (offset == offsetof(Ifx_ASCLIN, RXDATAD))
+  {
+    /* debug view, does not pop */
+    asclin->RXDATAD.U = (port->rx.fill != 0) ? port->rx.data[port->rx.head % SIMASCLIN_FIFO_SIZE] : 0u;
+  }
+
+  SIMASCLIN_UpdateFill(index);
+}
+
+/** \brief Execute a register write.
+ *
+ * \param address written register
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Write(uint32 address, uint32 old)
+{
+  uint32          index  = SIMASCLIN_Index(address);
+  uint32          offset = address - SIMCORE_ADDRESS(*SIMASCLIN_modules[index]);
+  Ifx_ASCLIN     *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+  uint64          now    = SIMCORE_Now();
+  uint32          value  = *(volatile uint32 *)SIMCORE_Image(address);
+
+  (void)old;
+  SIMASCLIN_Advance(index, now);
+
+  switch (offset)
+  {
+  case offsetof(Ifx_ASCLIN, TXFIFOCON):
+    if (asclin->TXFIFOCON.B.FLUSH != 0)
+    {
+      asclin->TXFIFOCON.B.FLUSH = 0;
+      port->tx.fill             = 0;
+    }
+    SIMASCLIN_UpdateFill(index);
+    break;
+
+  case offsetof(Ifx_ASCLIN, RXFIFOCON):
+    if (asclin->RXFIFOCON.B.FLUSH != 0)
+    {
+      asclin->RXFIFOCON.B.FLUSH = 0;
+      port->rx.fill             = 0;
+    }
+    SIMASCLIN_UpdateFill(index);
+    break;
+
+  case offsetof(Ifx_ASCLIN, FLAGSSET):
+    asclin->FLAGSSET.U = 0;
+    SIMASCLIN_Event(index, value);
+    break;
+
+  case offsetof(Ifx_ASCLIN, FLAGSCLEAR):
+    asclin->FLAGSCLEAR.U = 0;
+    asclin->FLAGS.U     &= ~value;
+    break;
+
+  case offsetof(Ifx_ASCLIN, TXDATA):
+    /* one frame per write, TXFIFOCON.INW = 1 */
+    if (port->tx.fill == SIMASCLIN_FIFO_SIZE)
+    {
+      port->stats.txOverflow++;
+      SIMASCLIN_Event(index, SIMASCLIN_FLAG(TFO));
+    }
+    else
+    {
+      port->tx.data[(port->tx.head + port->tx.fill++) % SIMASCLIN_FIFO_SIZE] = (uint8)value;
+      if (port->shifting == FALSE)
+      {
+        SIMASCLIN_StartFrame(index, now);
+      }
+      else
+      {
+        /* the level only triggers when it falls */
+        SIMASCLIN_UpdateFill(index);
+      }
+    }
+    break;
+
+  case offsetof(Ifx_ASCLIN, CSR):
+    asclin->CSR.B.CON = (asclin->CSR.B.CLKSEL != 0) ? 1u : 0u;
+    SIMASCLIN_StartFrame(index, now);
+    break;
+
+  case offsetof(Ifx_ASCLIN, FRAMECON):
+    if (port->shifting == FALSE)
+    {
+      SIMASCLIN_StartFrame(index, now);
+    }
+    break;
+
+  case offsetof(Ifx_ASCLIN, KRST0):
+  case offsetof(Ifx_ASCLIN, KRST1):
+    if (offset == offsetof(Ifx_ASCLIN, KRST0))
+    {
+      /* the reset status is read only */
+      asclin->KRST0.B.RSTSTAT = (old >> IFX_ASCLIN_KRST0_RSTSTAT_OFF) & 1u;
+    }
+    if ((asclin->KRST0.B.RST != 0) && (asclin->KRST1.B.RST != 0))
+    {
+      SIMASCLIN_Reset(index);
+    }
+    break;
+
+  case offsetof(Ifx_ASCLIN, KRSTCLR):
+    if (asclin->KRSTCLR.B.CLR != 0)
+    {
+      asclin->KRST0.B.RSTSTAT = 0;
+    }
+    asclin->KRSTCLR.U = 0;
+    break;
+
+  default:
+    break;
+  }
+}
+
+/** \brief Advance all attached modules.
+ *
+ * \param now simulated time
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+static void SIMASCLIN_Step(uint64 now)
+{
+  for (uint32 index = 0; index < SIMASCLIN_NUM_MODULES; index++)
+  {
+    if (SIMASCLIN_ports[index].attached != FALSE)
+    {
+      SIMASCLIN_Advance(index, now);
+    }
+  }
+}
+
+/* global functions */
+
+void SIMASCLIN_Init(uint32 index, int txFd)
+{
+  SIMASCLIN_Port *port = &SIMASCLIN_ports[index];
+  boolean         first = TRUE;
+
+  for (uint32 i = 0; i < SIMASCLIN_NUM_MODULES; i++)
+  {
+    first = (boolean)(first && (SIMASCLIN_ports[i].attached == FALSE));
+  }
+
+  port->attached = TRUE;
+  port->txFd     = txFd;
+  SIMCORE_Attach(SIMCORE_ADDRESS(*SIMASCLIN_modules[index]), sizeof(Ifx_ASCLIN), SIMASCLIN_Read, SIMASCLIN_Write);
+
+  if (first != FALSE)
+  {
+    SIMCORE_AddStep(SIMASCLIN_Step);
+  }
+}
+
+uint32 SIMASCLIN_Receive(uint32 index, const uint8 *data, uint32 len)
+{
+  SIMASCLIN_Port *port   = &SIMASCLIN_ports[index];
+  uint32          queued = 0;
+
+  if (port->lineHead == port->lineTail)
+  {
+    /* idle line, the first frame starts now */
+    port->rxDone = SIMCORE_Now() + SIMASCLIN_FrameTime(index);
+  }
+
+  while ((queued < len) && ((port->lineTail - port->lineHead) < SIMASCLIN_LINE_SIZE))
+  {
+    port->line[port->lineTail++ % SIMASCLIN_LINE_SIZE] = data[queued++];
+  }
+
+  return queued;
+}
+
+uint64 SIMASCLIN_GetFrameTime(uint32 index)
+{
+  Ifx_ASCLIN *asclin = &SIMCORE_IMAGE(*SIMASCLIN_modules[index]);
+  uint64      bits;
+  uint64      divider;
+  uint64      frequency;
+
+  if ((asclin->CSR.B.CLKSEL != SIMASCLIN_CLK_ASCLINF) || (asclin->BRG.B.NUMERATOR == 0))
+  {
+    return 0;
+  }
+
+  /* start, data, parity, stop bits and the idle delay */
+  bits      = 1u + (asclin->DATCON.B.DATLEN + 1u) + asclin->FRAMECON.B.PEN + asclin->FRAMECON.B.STOP + asclin->FRAMECON.B.IDLE;
+  divider   = (uint64)asclin->BRG.B.DENOMINATOR * (asclin->BITCON.B.OVERSAMPLING + 1u) * (asclin->BITCON.B.PRESCALER + 1u);
+  frequency = (uint64)SIMSCU_GetAsclinFrequency() * asclin->BRG.B.NUMERATOR;
+
+  return (frequency != 0) ? (uint64)(((unsigned __int128)bits * divider * 1000000000u) / frequency) : 0u;
+}
+
+void SIMASCLIN_SetPacing(uint32 index, boolean paced)
+{
+  SIMASCLIN_ports[index].unpaced = (boolean)(paced == FALSE);
+}
+
+void SIMASCLIN_GetStats(uint32 index, SIMASCLIN_Stats *stats)
+{
+  *stats = SIMASCLIN_ports[index].stats;
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
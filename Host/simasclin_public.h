@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * \file simasclin_public.h
+ * \brief ASCLIN model of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMASCLIN_PUBLIC_H
+#define SIMASCLIN_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define SIMASCLIN_NUM_MODULES 4u
+#define SIMASCLIN_FIFO_SIZE   16u   /**< \brief bytes in the transmit and receive FIFO */
+
+/** \brief Traffic of one module, times in ns of simulated time */
+typedef struct
+{
+  uint32 txBytes;    /**< \brief frames sent */
+  uint32 rxBytes;    /**< \brief frames received */
+  uint32 txOverflow; /**< \brief writes to the full transmit FIFO */
+  uint32 rxOverflow; /**< \brief frames lost, receive FIFO full */
+  uint64 txFirst;    /**< \brief end of the first frame sent */
+  uint64 txLast;     /**< \brief end of the last frame sent */
+} SIMASCLIN_Stats;
+
+/** \brief Attach a module in ASC mode.
+ *
+ * \param index module index
+ * \param txFd file descriptor which receives the sent frames, -1 to discard them
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+extern void SIMASCLIN_Init(uint32 index, int txFd);
+
+/** \brief Put bytes on the receive line, they arrive at the baud rate.
+ * Call it from a step hook of the time base.
+ *
+ * \param index module index
+ * \param data bytes to receive
+ * \param len number of bytes
+ * \return number of bytes queued, less than len if the line buffer is full
+ *
+ *  \ingroup SimAsclin
+ */
+extern uint32 SIMASCLIN_Receive(uint32 index, const uint8 *data, uint32 len);
+
+/** \brief Duration of a frame at the baud rate programmed in BRG, BITCON and FRAMECON.
+ *
+ * \param index module index
+ * \return frame time in ns, 0 if the baud rate logic has no clock
+ *
+ *  \ingroup SimAsclin
+ */
+extern uint64 SIMASCLIN_GetFrameTime(uint32 index);
+
+/** \brief Select the timing of the frames.
+ * Paced frames take the time given by the baud rate, unpaced frames leave
+ * and arrive as fast as the firmware moves them. The firmware still needs a
+ * clocked baud rate generator in both cases.
+ *
+ * \param index module index
+ * \param paced TRUE for the baud rate timing, the default
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+extern void SIMASCLIN_SetPacing(uint32 index, boolean paced);
+
+/** \brief Copy the statistics of a module.
+ *
+ * \param index module index
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup SimAsclin
+ */
+extern void SIMASCLIN_GetStats(uint32 index, SIMASCLIN_Stats *stats);
+
+#endif	/* end of file */
@@ -0,0 +1,818 @@
+/*******************************************************************************
+ * \file simcore.c
+ * \brief Register space, time base and access traps of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The register space of the TriCore is mapped at its own addresses, so the
+ * unmodified register macros work. The pages of a modelled register block
+ * are inaccessible: an access of the firmware faults and the read hook
+ * updates the register image. The models use a second mapping of the same
+ * memory, which never faults. The faulting instruction is copied to a buffer
+ * of the thread, its address is moved to the second mapping, and it is
+ * executed there for a single step; the write hook sees the new value in the
+ * trap which follows. The pages stay closed, so the accesses of the other
+ * threads keep trapping. An instruction whose address cannot be moved, e.g.
+ * a string instruction, is executed with its page opened instead.
+ *
+ * Every core runs on its own thread. The models are serialised by one lock,
+ * held from the fault to the trap of an access and during a tick of the time
+ * base. Interrupts are signalled to the thread of their core and are not
+ * taken inside an access.
+ */
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "Ifx_Types.h"
+
+#include "simirq_public.h"
+#include "simcpu_public.h"
+#include "simcost_public.h"
+#include "simtrace_public.h"
+#include "simcore_public.h"
+
+#define SIMCORE_PAGE        0x1000u
+#define SIMCORE_MAX_RANGES  32u
+#define SIMCORE_MAX_STEPS   16u
+#define SIMCORE_EFLAGS_TF   0x100u   /**< \brief x86 single step flag */
+#define SIMCORE_ERR_WRITE   0x2u     /**< \brief page fault error code, write access */
+#define SIMCORE_SIGIRQ      SIGSYS   /**< \brief interrupt request to the thread of a core */
+#define SIMCORE_MAX_INSN    16u      /**< \brief x86 instructions are at most 15 bytes */
+#define SIMCORE_NO_BASE     (-1)     /**< \brief moved instruction with an absolute address */
+
+/** \brief Part of the TriCore address space backed by the register image */
+typedef struct
+{
+  uint32 base;    /**< \brief TriCore address */
+  uint32 size;    /**< \brief size in bytes */
+  uint32 offset;  /**< \brief offset in the register image */
+} SIMCORE_Region;
+
+/** \brief Register range of a model */
+typedef struct
+{
+  uint32            base;
+  uint32            size;
+  SIMCORE_ReadHook  read;
+  SIMCORE_WriteHook write;
+} SIMCORE_Range;
+
+/** \brief Access in flight between the fault and the trap */
+typedef struct
+{
+  const SIMCORE_Range *range;
+  uint32               address;   /**< \brief word address */
+  uint32               old;       /**< \brief word before a write */
+  void                *page;      /**< \brief opened page, NULL for a moved instruction */
+  greg_t               rip;       /**< \brief trapped instruction */
+  greg_t               site;      /**< \brief address of the access in the firmware */
+  int                  base;      /**< \brief moved base register, SIMCORE_NO_BASE for none */
+  greg_t               original;  /**< \brief base register before the move */
+  greg_t               moved;     /**< \brief base register after the move */
+  boolean              write;
+  boolean              unblock;   /**< \brief SIMCORE_SIGIRQ was not blocked at the fault */
+  boolean              active;    /**< \brief between the fault and the trap */
+  boolean              deferred;  /**< \brief interrupt signalled during the access */
+} SIMCORE_Access;
+
+/** \addtogroup SimCore_Variables */
+/* private data */
+static const SIMCORE_Region SIMCORE_regions[] =
+{
+  {0xF0000000u, 0x00100000u, 0x00000000u},  /* peripherals */
+  {0xF8000000u, 0x01000000u, 0x00100000u},  /* flash, CPU and core registers */
+};
+
+#define SIMCORE_NUM_REGIONS (sizeof(SIMCORE_regions) / sizeof(SIMCORE_regions[0]))
+#define SIMCORE_IMAGE_SIZE  0x01100000u
+
+static uint8            *SIMCORE_image;
+static SIMCORE_Range     SIMCORE_ranges[SIMCORE_MAX_RANGES];
+static uint32            SIMCORE_numRanges;
+static SIMCORE_StepHook  SIMCORE_steps[SIMCORE_MAX_STEPS];
+static uint32            SIMCORE_numSteps;
+static struct timespec   SIMCORE_start;
+static uint32            SIMCORE_timeScale = 1;
+static atomic_flag       SIMCORE_lock      = ATOMIC_FLAG_INIT;
+static pthread_t         SIMCORE_threads[SIMCPU_NUM_CORES];
+static SIMCORE_CoreMain  SIMCORE_entries[SIMCPU_NUM_CORES];
+static _Thread_local SIMCORE_Access SIMCORE_access;
+static _Thread_local uint8         *SIMCORE_xol;  /**< \brief buffer of the moved instruction */
+
+/* code of the executable, from the default linker script */
+extern const char __executable_start[];
+extern const char etext[];
+
+/* x86 register number to the index of the saved register */
+static const uint8 SIMCORE_gregs[16] =
+{
+  REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+  REG_R8,  REG_R9,  REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15,
+};
+
+/* private functions */
+
+/** \brief Find the region of an address.
+ *
+ * \param address TriCore address
+ * \return region, NULL outside of the register space
+ *
+ *  \ingroup SimCore
+ */
+static const SIMCORE_Region *SIMCORE_FindRegion(uint32 address)
+{
+  for (uint32 i = 0; i < SIMCORE_NUM_REGIONS; i++)
+  {
+    if ((address - SIMCORE_regions[i].base) < SIMCORE_regions[i].size)
+    {
+      return &SIMCORE_regions[i];
+    }
+  }
+  return NULL;
+}
+
+/** \brief Find the model range of an address.
+ *
+ * \param address TriCore address
+ * \return range, NULL if no model is attached
+ *
+ *  \ingroup SimCore
+ */
+static const SIMCORE_Range *SIMCORE_FindRange(uint32 address)
+{
+  for (uint32 i = 0; i < SIMCORE_numRanges; i++)
+  {
+    if ((address - SIMCORE_ranges[i].base) < SIMCORE_ranges[i].size)
+    {
+      return &SIMCORE_ranges[i];
+    }
+  }
+  return NULL;
+}
+
+/** \brief Take the pending interrupts of the calling core.
+ * The handlers access registers, their faults must not be blocked. A signal
+ * handler called by ThreadSanitizer runs with all signals blocked.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+static void SIMCORE_Dispatch(void)
+{
+  sigset_t mask;
+
+  sigemptyset(&mask);
+  sigaddset(&mask, SIGSEGV);
+  sigaddset(&mask, SIGTRAP);
+  pthread_sigmask(SIG_UNBLOCK, &mask, NULL);
+  SIMIRQ_Dispatch();
+}
+
+/** \brief Find the memory operand of a faulting instruction.
+ *
+ * \param code instruction
+ * \param moffs receives the position of a 64 bit absolute address, 0 for a base register
+ * \param base receives the x86 number of the base register
+ * \return FALSE if the address cannot be moved
+ *
+ *  \ingroup SimCore
+ */
+static boolean SIMCORE_Decode(const uint8 *code, uint32 *moffs, uint32 *base)
+{
+  uint32 i   = 0;
+  uint32 rex = 0;
+  uint32 op;
+  uint32 mod;
+  uint32 rm;
+
+  /* operand size, lock and repeat prefixes; address size and segment overrides are not moved */
+  while ((code[i] == 0x66u) || (code[i] == 0xF0u) || (code[i] == 0xF2u) || (code[i] == 0xF3u))
+  {
+    i++;
+  }
+  if ((code[i] & 0xF0u) == 0x40u)
+  {
+    rex = code[i++];
+  }
+
+  op = code[i++];
+  if ((op >= 0xA0u) && (op <= 0xA3u))
+  {
+    /* mov between the accumulator and an absolute address */
+    *moffs = i;
+    return TRUE;
+  }
+
+  if (op == 0x0Fu)
+  {
+    /* the memory operands of the two and three byte opcodes are all given by ModRM */
+    op = code[i++];
+    if ((op == 0x38u) || (op == 0x3Au))
+    {
+      i++;
+    }
+  }
+  else if (!(((op < 0x40u) && ((op & 7u) < 4u)) || (op == 0x63u) || (op == 0x69u) || (op == 0x6Bu) ||
+             ((op >= 0x80u) && (op <= 0x8Fu)) || (op == 0xC0u) || (op == 0xC1u) || (op == 0xC6u) ||
+             (op == 0xC7u) || ((op >= 0xD0u) && (op <= 0xD3u)) || ((op >= 0xD8u) && (op <= 0xDFu)) ||
+             (op == 0xF6u) || (op == 0xF7u) || (op == 0xFEu) || (op == 0xFFu)))
+  {
+    /* string instructions, VEX and the other implicit operands */
+    return FALSE;
+  }
+
+  mod = code[i] >> 6;
+  rm  = code[i] & 7u;
+  if (mod == 3u)
+  {
+    return FALSE;
+  }
+
+  if (rm == 4u)
+  {
+    uint32 sib   = code[i + 1u];
+    uint32 index = ((sib >> 3) & 7u) | (((rex & 2u) != 0) ? 8u : 0u);
+
+    rm = sib & 7u;
+    if ((mod == 0) && (rm == 5u))
+    {
+      /* no base register */
+      return FALSE;
+    }
+    *base = rm | (((rex & 1u) != 0) ? 8u : 0u);
+    if ((index != 4u) && (index == *base))
+    {
+      return FALSE;
+    }
+  }
+  else if ((mod == 0) && (rm == 5u))
+  {
+    /* relative to the instruction pointer, cannot reach the registers */
+    return FALSE;
+  }
+  else
+  {
+    *base = rm | (((rex & 1u) != 0) ? 8u : 0u);
+  }
+
+  *moffs = 0;
+  return (boolean)(*base != 4u);
+}
+
+/** \brief Move a faulting instruction to the register image.
+ *
+ * \param uc interrupted context
+ * \param region region of the accessed register
+ * \return FALSE if the instruction has to be executed in place
+ *
+ *  \ingroup SimCore
+ */
+static boolean SIMCORE_Move(ucontext_t *uc, const SIMCORE_Region *region)
+{
+  SIMCORE_Access *access = &SIMCORE_access;
+  greg_t         *gregs  = uc->uc_mcontext.gregs;
+  const uint8    *code   = (const uint8 *)gregs[REG_RIP];
+  intptr_t        delta  = (intptr_t)&SIMCORE_image[region->offset] - (intptr_t)region->base;
+  uint32          moffs = 0;
+  uint32          base  = 0;
+
+  if (SIMCORE_xol == NULL)
+  {
+    void *xol = mmap(NULL, SIMCORE_PAGE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    SIMCORE_xol = (xol != MAP_FAILED) ? xol : NULL;
+  }
+
+  if ((SIMCORE_xol == NULL) || (SIMCORE_Decode(code, &moffs, &base) == FALSE))
+  {
+    return FALSE;
+  }
+
+  memcpy(SIMCORE_xol, code, SIMCORE_MAX_INSN);
+  if (moffs != 0)
+  {
+    uint64 target;
+
+    memcpy(&target, &SIMCORE_xol[moffs], sizeof(target));
+    target += (uint64)delta;
+    memcpy(&SIMCORE_xol[moffs], &target, sizeof(target));
+    access->base = SIMCORE_NO_BASE;
+  }
+  else
+  {
+    access->base     = SIMCORE_gregs[base];
+    access->original = gregs[access->base];
+    access->moved    = access->original + delta;
+    gregs[access->base] = access->moved;
+  }
+
+  access->rip     = gregs[REG_RIP];
+  gregs[REG_RIP]  = (greg_t)(uintptr_t)SIMCORE_xol;
+  return TRUE;
+}
+
+/** \brief Page fault of a trapped register access.
+ *
+ * \param sig SIGSEGV
+ * \param info faulting address
+ * \param context interrupted context, single stepping is enabled in it
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+static void SIMCORE_Fault(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t           *uc      = (ucontext_t *)context;
+  uintptr_t             host    = (uintptr_t)info->si_addr;
+  uint32                address = (uint32)host & ~3u;
+  SIMCORE_Access       *access  = &SIMCORE_access;
+  const SIMCORE_Region *region  = (host <= 0xFFFFFFFFu) ? SIMCORE_FindRegion(address) : NULL;
+
+  (void)sig;
+
+  if ((region == NULL) || (access->active != FALSE))
+  {
+    /* not a register access, let the next fault terminate the process */
+    fprintf(stderr, "sim: invalid access at %p\n", info->si_addr);
+    signal(SIGSEGV, SIG_DFL);
+    return;
+  }
+
+  access->active = TRUE;
+  SIMCORE_Lock();
+
+  access->range   = SIMCORE_FindRange(address);
+  access->address = address;
+  access->write   = (boolean)((uc->uc_mcontext.gregs[REG_ERR] & SIMCORE_ERR_WRITE) != 0);
+  access->site    = uc->uc_mcontext.gregs[REG_RIP];
+  SIMCOST_Access(address);
+
+  if (access->range != NULL)
+  {
+    if (access->write != FALSE)
+    {
+      access->old = *(volatile uint32 *)SIMCORE_Image(address);
+    }
+    else if (access->range->read != NULL)
+    {
+      access->range->read(address);
+    }
+  }
+  if (access->write == FALSE)
+  {
+    SIMTRACE_Access(address, FALSE, *(volatile uint32 *)SIMCORE_Image(address), (uint64)access->site);
+  }
+
+  if (SIMCORE_Move(uc, region) == FALSE)
+  {
+    /* execute the access in place, the other threads do not trap on the page meanwhile */
+    access->page = (void *)(host & ~(uintptr_t)(SIMCORE_PAGE - 1u));
+    mprotect(access->page, SIMCORE_PAGE, PROT_READ | PROT_WRITE);
+  }
+
+  /* trap after the instruction */
+  uc->uc_mcontext.gregs[REG_EFL] |= SIMCORE_EFLAGS_TF;
+  access->unblock = (boolean)(sigismember(&uc->uc_sigmask, SIMCORE_SIGIRQ) == 0);
+  sigaddset(&uc->uc_sigmask, SIMCORE_SIGIRQ);
+}
+
+/** \brief Single step trap after a trapped register access.
+ *
+ * \param sig SIGTRAP
+ * \param info not used
+ * \param context interrupted context, single stepping is disabled in it
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+static void SIMCORE_Trap(int sig, siginfo_t *info, void *context)
+{
+  ucontext_t     *uc     = (ucontext_t *)context;
+  greg_t         *gregs  = uc->uc_mcontext.gregs;
+  SIMCORE_Access *access = &SIMCORE_access;
+
+  (void)sig;
+  (void)info;
+
+  if (access->active == FALSE)
+  {
+    /* breakpoint of a debugger */
+    return;
+  }
+
+  if (access->page != NULL)
+  {
+    mprotect(access->page, SIMCORE_PAGE, PROT_NONE);
+    access->page = NULL;
+  }
+  else
+  {
+    /* continue after the original instruction, restore the base register unless it was loaded */
+    gregs[REG_RIP] = access->rip + (gregs[REG_RIP] - (greg_t)(uintptr_t)SIMCORE_xol);
+    if ((access->base != SIMCORE_NO_BASE) && (gregs[access->base] == access->moved))
+    {
+      gregs[access->base] = access->original;
+    }
+  }
+  gregs[REG_EFL] &= ~(greg_t)SIMCORE_EFLAGS_TF;
+  if (access->unblock != FALSE)
+  {
+    sigdelset(&uc->uc_sigmask, SIMCORE_SIGIRQ);
+  }
+
+  if (access->write != FALSE)
+  {
+    SIMTRACE_Access(access->address, TRUE, *(volatile uint32 *)SIMCORE_Image(access->address), (uint64)access->site);
+  }
+  if ((access->write != FALSE) && (access->range != NULL) && (access->range->write != NULL))
+  {
+    access->range->write(access->address, access->old);
+  }
+
+  SIMCORE_Unlock();
+  access->active = FALSE;
+
+  if (access->deferred != FALSE)
+  {
+    /* the interrupt has been signalled during the access, the instruction is complete now */
+    access->deferred = FALSE;
+    SIMCORE_Dispatch();
+  }
+}
+
+/** \brief Interrupt request signalled to the thread of a core.
+ * ThreadSanitizer delays asynchronous signals to its next interceptor, which
+ * an idle loop may never call; SIGSYS is delivered at once like a fault. The
+ * interrupt is taken in the code of the executable only, inside the C library
+ * or the sanitizer runtime it waits for the next tick. Inside an access it
+ * follows at the end of the access.
+ *
+ * \param sig SIMCORE_SIGIRQ
+ * \param info not used
+ * \param context interrupted context
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+static void SIMCORE_Interrupt(int sig, siginfo_t *info, void *context)
+{
+  const char *rip = (const char *)((ucontext_t *)context)->uc_mcontext.gregs[REG_RIP];
+
+  (void)sig;
+  (void)info;
+
+  if (SIMCORE_access.active != FALSE)
+  {
+    SIMCORE_access.deferred = TRUE;
+  }
+  else if ((rip >= __executable_start) && (rip < etext))
+  {
+    SIMCORE_Dispatch();
+  }
+}
+
+/** \brief Tick of the time base, advances the models and signals the cores.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+static void SIMCORE_Tick(void)
+{
+  uint64 now = SIMCORE_Now();
+
+  SIMCORE_Lock();
+  for (uint32 i = 0; i < SIMCORE_numSteps; i++)
+  {
+    SIMCORE_steps[i](now);
+  }
+  for (uint32 core = 0; core < SIMCPU_NUM_CORES; core++)
+  {
+    if (SIMIRQ_IsPending(core) != FALSE)
+    {
+      SIMCORE_Kick(core);
+    }
+  }
+  SIMCORE_Unlock();
+}
+
+/** \brief Thread of an emulated core.
+ *
+ * \param arg core index
+ * \return not used
+ *
+ *  \ingroup SimCore
+ */
+static void *SIMCORE_Core(void *arg)
+{
+  uint32 core = (uint32)(uintptr_t)arg;
+
+  IfxCompiler_hostCore = core;
+  (void)SIMCORE_entries[core]();
+  return NULL;
+}
+
+/* global functions */
+
+void SIMCORE_Init(uint32 timeScale)
+{
+  struct sigaction action;
+  int              fd;
+
+  fd = memfd_create("sfr", 0);
+  if ((fd < 0) || (ftruncate(fd, SIMCORE_IMAGE_SIZE) != 0))
+  {
+    perror("sim: register image");
+    exit(1);
+  }
+
+  SIMCORE_image = mmap(NULL, SIMCORE_IMAGE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (SIMCORE_image == MAP_FAILED)
+  {
+    perror("sim: register image");
+    exit(1);
+  }
+
+  for (uint32 i = 0; i < SIMCORE_NUM_REGIONS; i++)
+  {
+    const SIMCORE_Region *region = &SIMCORE_regions[i];
+    void                 *map;
+
+    map = mmap((void *)(uintptr_t)region->base, region->size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_FIXED_NOREPLACE, fd, region->offset);
+    if (map != (void *)(uintptr_t)region->base)
+    {
+      fprintf(stderr, "sim: cannot map the registers at 0x%08X, link with -no-pie\n", region->base);
+      exit(1);
+    }
+  }
+  close(fd);
+
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  sigemptyset(&action.sa_mask);
+  sigaddset(&action.sa_mask, SIMCORE_SIGIRQ);
+  action.sa_sigaction = SIMCORE_Fault;
+  sigaction(SIGSEGV, &action, NULL);
+  action.sa_sigaction = SIMCORE_Trap;
+  sigaction(SIGTRAP, &action, NULL);
+
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO;
+  sigemptyset(&action.sa_mask);
+  action.sa_sigaction = SIMCORE_Interrupt;
+  sigaction(SIMCORE_SIGIRQ, &action, NULL);
+
+  clock_gettime(CLOCK_MONOTONIC, &SIMCORE_start);
+  SIMCORE_timeScale = (timeScale != 0) ? timeScale : 1u;
+}
+
+void SIMCORE_Attach(uint32 base, uint32 size, SIMCORE_ReadHook read, SIMCORE_WriteHook write)
+{
+  uint32 first = base & ~(SIMCORE_PAGE - 1u);
+  uint32 last  = (base + size + SIMCORE_PAGE - 1u) & ~(SIMCORE_PAGE - 1u);
+
+  if ((SIMCORE_numRanges == SIMCORE_MAX_RANGES) || (SIMCORE_FindRegion(base) == NULL))
+  {
+    fprintf(stderr, "sim: cannot attach 0x%08X\n", base);
+    exit(1);
+  }
+
+  SIMCORE_ranges[SIMCORE_numRanges++] = (SIMCORE_Range){base, size, read, write};
+  mprotect((void *)(uintptr_t)first, last - first, PROT_NONE);
+}
+
+void SIMCORE_AddStep(SIMCORE_StepHook step)
+{
+  if (SIMCORE_numSteps < SIMCORE_MAX_STEPS)
+  {
+    SIMCORE_steps[SIMCORE_numSteps++] = step;
+  }
+}
+
+void SIMCORE_StartCore(uint32 core, SIMCORE_CoreMain entry)
+{
+  SIMCORE_Lock();
+  SIMCORE_entries[core] = entry;
+  if (pthread_create(&SIMCORE_threads[core], NULL, SIMCORE_Core, (void *)(uintptr_t)core) != 0)
+  {
+    perror("sim: core thread");
+    exit(1);
+  }
+  SIMCORE_Unlock();
+}
+
+void SIMCORE_Run(uint32 tickUs)
+{
+  struct timespec next;
+  sigset_t        mask;
+
+  /* the interrupts go to the threads of the cores */
+  sigemptyset(&mask);
+  sigaddset(&mask, SIMCORE_SIGIRQ);
+  pthread_sigmask(SIG_BLOCK, &mask, NULL);
+
+  clock_gettime(CLOCK_MONOTONIC, &next);
+  while (1)
+  {
+    struct timespec now;
+
+    next.tv_nsec += (long)tickUs * 1000;
+    if (next.tv_nsec >= 1000000000)
+    {
+      next.tv_nsec -= 1000000000;
+      next.tv_sec++;
+    }
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+
+    /* a host which has fallen behind does not catch up with a burst of ticks */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if ((now.tv_sec > next.tv_sec) || ((now.tv_sec == next.tv_sec) && (now.tv_nsec > next.tv_nsec)))
+    {
+      next = now;
+    }
+
+    SIMCORE_Tick();
+  }
+}
+
+void SIMCORE_Kick(uint32 core)
+{
+  if ((core < SIMCPU_NUM_CORES) && (SIMCORE_entries[core] != NULL))
+  {
+    /* pending until the access or the dispatch in progress on the core has finished */
+    pthread_kill(SIMCORE_threads[core], SIMCORE_SIGIRQ);
+  }
+}
+
+void SIMCORE_Lock(void)
+{
+  /* a spin lock, it is taken in the signal handlers of the accesses */
+  while (atomic_flag_test_and_set_explicit(&SIMCORE_lock, memory_order_acquire))
+  {
+    sched_yield();
+  }
+}
+
+void SIMCORE_Unlock(void)
+{
+  atomic_flag_clear_explicit(&SIMCORE_lock, memory_order_release);
+}
+
+uint64 SIMCORE_Now(void)
+{
+  struct timespec now;
+  uint64          ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ns = ((uint64)(now.tv_sec - SIMCORE_start.tv_sec) * 1000000000u) + (uint64)now.tv_nsec - (uint64)SIMCORE_start.tv_nsec;
+  return ns / SIMCORE_timeScale;
+}
+
+uint64 SIMCORE_GetCpuTime(uint32 core)
+{
+  struct timespec used;
+  clockid_t       clock;
+
+  if ((core >= SIMCPU_NUM_CORES) || (SIMCORE_entries[core] == NULL) ||
+      (pthread_getcpuclockid(SIMCORE_threads[core], &clock) != 0) || (clock_gettime(clock, &used) != 0))
+  {
+    return 0;
+  }
+  return ((uint64)used.tv_sec * 1000000000u) + (uint64)used.tv_nsec;
+}
+
+uint64 SIMCORE_GetTicks(SIMCORE_Clock *clock, uint32 frequency)
+{
+  uint64 now   = SIMCORE_Now();
+  uint64 ticks = clock->ticks + (uint64)(((unsigned __int128)(now - clock->time) * clock->frequency) / 1000000000u);
+
+  if (frequency != clock->frequency)
+  {
+    clock->ticks     = ticks;
+    clock->time      = now;
+    clock->frequency = frequency;
+  }
+
+  return ticks;
+}
+
+volatile void *SIMCORE_Image(uint32 address)
+{
+  const SIMCORE_Region *region = SIMCORE_FindRegion(address);
+
+  return (region != NULL) ? &SIMCORE_image[region->offset + (address - region->base)] : NULL;
+}
+
+boolean SIMCORE_IsRegister(uint32 address)
+{
+  return (boolean)(SIMCORE_FindRegion(address) != NULL);
+}
+
+uint32 SIMCORE_BusRead(uint32 address, uint32 size)
+{
+  volatile uint8 *data = (volatile uint8 *)(uintptr_t)address;
+
+  if (SIMCORE_IsRegister(address) != FALSE)
+  {
+    const SIMCORE_Range *range = SIMCORE_FindRange(address & ~3u);
+
+    if ((range != NULL) && (range->read != NULL))
+    {
+      range->read(address & ~3u);
+    }
+    data = SIMCORE_Image(address);
+  }
+
+  switch (size)
+  {
+  case 1:
+    return *data;
+  case 2:
+    return *(volatile uint16 *)data;
+  default:
+    return *(volatile uint32 *)data;
+  }
+}
+
+void SIMCORE_BusWrite(uint32 address, uint32 value, uint32 size)
+{
+  volatile uint8      *data  = (volatile uint8 *)(uintptr_t)address;
+  const SIMCORE_Range *range = NULL;
+  uint32               old   = 0;
+
+  if (SIMCORE_IsRegister(address) != FALSE)
+  {
+    range = SIMCORE_FindRange(address & ~3u);
+    old   = *(volatile uint32 *)SIMCORE_Image(address & ~3u);
+    data  = SIMCORE_Image(address);
+  }
+
+  switch (size)
+  {
+  case 1:
+    *data = (uint8)value;
+    break;
+  case 2:
+    *(volatile uint16 *)data = (uint16)value;
+    break;
+  default:
+    *(volatile uint32 *)data = value;
+    break;
+  }
+
+  if ((range != NULL) && (range->write != NULL))
+  {
+    range->write(address & ~3u, old);
+  }
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,233 @@
+/*******************************************************************************
+ * \file simcore_public.h
+ * \brief Register space, time base and access traps of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMCORE_PUBLIC_H
+#define SIMCORE_PUBLIC_H
+
+#include <stdint.h>
+
+#include "Ifx_Types.h"
+
+/** \brief Called before the firmware reads a word of an attached range.
+ * The model updates the register image, the read returns the image.
+ */
+typedef void (*SIMCORE_ReadHook)(uint32 address);
+
+/** \brief Called after the firmware has written a word of an attached range.
+ * The new value is in the register image, old is the value before the write.
+ */
+typedef void (*SIMCORE_WriteHook)(uint32 address, uint32 old);
+
+/** \brief Called from the time base, advances a model to now. */
+typedef void (*SIMCORE_StepHook)(uint64 now);
+
+/** \brief Counter driven by a clock of variable frequency */
+typedef struct
+{
+  uint64 ticks;      /**< \brief count at time */
+  uint64 time;       /**< \brief simulated time of the last frequency change in ns */
+  uint32 frequency;  /**< \brief clock frequency since time */
+} SIMCORE_Clock;
+
+/** \brief Map the register space, install the access traps.
+ * Must be called before any register is accessed.
+ *
+ * \param timeScale host time per simulated time, 1 for real time
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Init(uint32 timeScale);
+
+/** \brief Trap the accesses of the firmware to a register range.
+ * The hooks see word aligned addresses, all other words of the trapped pages
+ * behave like memory.
+ *
+ * \param base first address of the range
+ * \param size size of the range in bytes
+ * \param read read hook, may be NULL
+ * \param write write hook, may be NULL
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Attach(uint32 base, uint32 size, SIMCORE_ReadHook read, SIMCORE_WriteHook write);
+
+/** \brief Add a model to the time base.
+ *
+ * \param step called with the simulated time on every tick
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_AddStep(SIMCORE_StepHook step);
+
+/** \brief Entry of an emulated core, e.g. core0_main */
+typedef int (*SIMCORE_CoreMain)(void);
+
+/** \brief Run an emulated core on its own thread.
+ * The thread reads its core index from IfxCompiler_hostCore, so the core
+ * SFRs, the core ID and the interrupts are those of the core.
+ *
+ * \param core core index
+ * \param entry main function of the core
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_StartCore(uint32 core, SIMCORE_CoreMain entry);
+
+/** \brief Run the time base on the calling thread, does not return.
+ * Each tick advances the models and signals the cores with a pending
+ * interrupt.
+ *
+ * \param tickUs host time between two ticks in us
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Run(uint32 tickUs);
+
+/** \brief Request the interrupt dispatch of a core.
+ * Used to take a new interrupt without waiting for the time base.
+ *
+ * \param core core index, cores which are not running are ignored
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Kick(uint32 core);
+
+/** \brief Serialise the models, taken around every hook and tick.
+ * The models and their register images are shared by all threads. Host/ is
+ * built without ThreadSanitizer instrumentation, the lock and the accesses
+ * of the models are hidden from it, it only sees the firmware and its own
+ * synchronisation.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Lock(void);
+
+/** \brief Release the lock taken with SIMCORE_Lock.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_Unlock(void);
+
+/** \brief Simulated time since SIMCORE_Init.
+ *
+ * \param None
+ * \return time in ns
+ *
+ *  \ingroup SimCore
+ */
+extern uint64 SIMCORE_Now(void);
+
+/** \brief Host CPU time used by the thread of a core.
+ * Unlike the simulated time it does not advance while the host does not
+ * run the core.
+ *
+ * \param core core index
+ * \return time in ns, 0 if the core has not been started
+ *
+ *  \ingroup SimCore
+ */
+extern uint64 SIMCORE_GetCpuTime(uint32 core);
+
+/** \brief Count of a clock at the current simulated time.
+ * A new frequency applies from now on.
+ *
+ * \param clock counter state
+ * \param frequency current clock frequency in Hz
+ * \return ticks since the start of the simulation
+ *
+ *  \ingroup SimCore
+ */
+extern uint64 SIMCORE_GetTicks(SIMCORE_Clock *clock, uint32 frequency);
+
+/** \brief Register image of a register, not trapped.
+ *
+ * \param address register address in the TriCore address space
+ * \return pointer into the register image
+ *
+ *  \ingroup SimCore
+ */
+extern volatile void *SIMCORE_Image(uint32 address);
+
+/** \brief Check if an address is inside the simulated register space.
+ *
+ * \param address address in the TriCore address space
+ * \return TRUE for a register address
+ *
+ *  \ingroup SimCore
+ */
+extern boolean SIMCORE_IsRegister(uint32 address);
+
+/** \brief Read like a bus master, calls the read hook.
+ *
+ * \param address register or memory address
+ * \param size access width in bytes, 1, 2 or 4
+ * \return value read
+ *
+ *  \ingroup SimCore
+ */
+extern uint32 SIMCORE_BusRead(uint32 address, uint32 size);
+
+/** \brief Write like a bus master, calls the write hook.
+ *
+ * \param address register or memory address
+ * \param value value to write
+ * \param size access width in bytes, 1, 2 or 4
+ * \return None
+ *
+ *  \ingroup SimCore
+ */
+extern void SIMCORE_BusWrite(uint32 address, uint32 value, uint32 size);
+
+/** \brief Register image of a register block, for the models.
+ * \param module register block, e.g. MODULE_ASCLIN3
+ */
+#define SIMCORE_IMAGE(module) (*(__typeof__(&(module)))SIMCORE_Image((uint32)(uintptr_t)&(module)))
+
+/** \brief Address of a register in the TriCore address space. */
+#define SIMCORE_ADDRESS(reg) ((uint32)(uintptr_t)&(reg))
+
+#endif	/* end of file */
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * \file simcost.c
+ * \brief Cycle-approximate timing model of the ASCLIN and DMA path
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The simulated time follows the host clock, so it says nothing about the
+ * CPU time of the driver. This model counts the work of the transmit and
+ * receive path instead: the register accesses of the firmware to the ASCLIN
+ * module, to its service request nodes and to the DMA channels they request,
+ * the DMA moves of these channels and the interrupts of these nodes. Each is
+ * charged a configurable number of cycles. With the frame time from BRG and
+ * the configuration in the register images (INTLEVEL, CHDW, type of service
+ * of the transmit node) the cycles give the throughput the configuration can
+ * reach and the latency of a block. The cores run on host threads, the
+ * amount of traffic in a run of fixed time depends on the host; run with -q
+ * the traffic is the complete output of the scripted commands, the counts
+ * then depend on the code of the driver, so a regression of the driver shows
+ * up as a change of the estimate.
+ */
+#include "Ifx_Types.h"
+#include "IfxAsclin_reg.h"
+#include "IfxDma_reg.h"
+#include "IfxSrc_reg.h"
+
+#include "simcore_public.h"
+#include "simirq_public.h"
+#include "simscu_public.h"
+#include "simdma_public.h"
+#include "simasclin_public.h"
+#include "simcost_public.h"
+
+#define SIMCOST_NO_CHANNEL 0xFFFFFFFFu
+
+/** \addtogroup SimCost_Variables */
+/* private data */
+static Ifx_ASCLIN * const SIMCOST_modules[SIMASCLIN_NUM_MODULES] =
+{
+  &MODULE_ASCLIN0, &MODULE_ASCLIN1, &MODULE_ASCLIN2, &MODULE_ASCLIN3
+};
+
+static boolean       SIMCOST_active;
+static uint32        SIMCOST_index;
+static SIMCOST_Costs SIMCOST_costs;
+static uint64        SIMCOST_accesses;
+static uint64        SIMCOST_moves;
+static uint64        SIMCOST_txMoves;
+static uint64        SIMCOST_irqs;
+static uint64        SIMCOST_txIrqs;
+
+/* private functions */
+
+/** \brief DMA channel requested by a service request node.
+ *
+ * \param node node of the module
+ * \return channel, SIMCOST_NO_CHANNEL if the node requests a CPU
+ *
+ *  \ingroup SimCost
+ */
+static uint32 SIMCOST_Channel(volatile Ifx_SRC_SRCR *node)
+{
+  Ifx_SRC_SRCR image;
+
+  image.U = SIMCORE_IMAGE(*node).U;
+  return (image.B.TOS == SIMIRQ_TOS_DMA) ? image.B.SRPN : SIMCOST_NO_CHANNEL;
+}
+
+/** \brief Check if an address is in a register block.
+ *
+ * \param address register address
+ * \param block start of the block
+ * \param size size of the block
+ * \return TRUE inside the block
+ *
+ *  \ingroup SimCost
+ */
+static boolean SIMCOST_InBlock(uint32 address, uint32 block, uint32 size)
+{
+  return (boolean)((address - block) < size);
+}
+
+/** \brief Check if an address belongs to a DMA channel of the path.
+ *
+ * \param address register address
+ * \param channel DMA channel, SIMCOST_NO_CHANNEL for none
+ * \return TRUE for the channel registers, its TSR and its node
+ *
+ *  \ingroup SimCost
+ */
+static boolean SIMCOST_IsChannel(uint32 address, uint32 channel)
+{
+  return (boolean)((channel < SIMDMA_NUM_CHANNELS) &&
+                   ((SIMCOST_InBlock(address, SIMCORE_ADDRESS(MODULE_DMA.CH[channel]), sizeof(Ifx_DMA_CH)) != FALSE) ||
+                    (SIMCOST_InBlock(address, SIMCORE_ADDRESS(MODULE_DMA.TSR[channel]), sizeof(Ifx_DMA_TSR)) != FALSE) ||
+                    (SIMCOST_InBlock(address, SIMCORE_ADDRESS(MODULE_SRC.DMA.DMA[0].CH[channel]), sizeof(Ifx_SRC_SRCR)) != FALSE)));
+}
+
+/* global functions */
+
+void SIMCOST_Init(uint32 index, const SIMCOST_Costs *costs)
+{
+  SIMCOST_index  = index;
+  SIMCOST_costs  = *costs;
+  SIMCOST_active = TRUE;
+}
+
+void SIMCOST_Access(uint32 address)
+{
+  Ifx_SRC_ASCLIN *src;
+
+  if (SIMCOST_active == FALSE)
+  {
+    return;
+  }
+
+  src = &MODULE_SRC.ASCLIN.ASCLIN[SIMCOST_index];
+  if ((SIMCOST_InBlock(address, SIMCORE_ADDRESS(*SIMCOST_modules[SIMCOST_index]), sizeof(Ifx_ASCLIN)) != FALSE) ||
+      (SIMCOST_InBlock(address, SIMCORE_ADDRESS(*src), sizeof(Ifx_SRC_ASCLIN)) != FALSE) ||
+      (SIMCOST_IsChannel(address, SIMCOST_Channel(&src->TX)) != FALSE) ||
+      (SIMCOST_IsChannel(address, SIMCOST_Channel(&src->RX)) != FALSE))
+  {
+    SIMCOST_accesses++;
+  }
+}
+
+void SIMCOST_Move(uint32 channel)
+{
+  Ifx_SRC_ASCLIN *src = &MODULE_SRC.ASCLIN.ASCLIN[SIMCOST_index];
+
+  if (SIMCOST_active == FALSE)
+  {
+    return;
+  }
+
+  if (channel == SIMCOST_Channel(&src->TX))
+  {
+    SIMCOST_moves++;
+    SIMCOST_txMoves++;
+  }
+  else if (channel == SIMCOST_Channel(&src->RX))
+  {
+    SIMCOST_moves++;
+  }
+}
+
+void SIMCOST_Interrupt(uint32 node)
+{
+  Ifx_SRC_ASCLIN *src = &MODULE_SRC.ASCLIN.ASCLIN[SIMCOST_index];
+
+  if (SIMCOST_active == FALSE)
+  {
+    return;
+  }
+
+  if (SIMCOST_InBlock(node, SIMCORE_ADDRESS(*src), sizeof(Ifx_SRC_ASCLIN)) != FALSE)
+  {
+    SIMCOST_irqs++;
+    SIMCOST_txIrqs += (node == SIMCORE_ADDRESS(src->TX)) ? 1u : 0u;
+  }
+  else if ((SIMCOST_IsChannel(node, SIMCOST_Channel(&src->TX)) != FALSE) ||
+           (SIMCOST_IsChannel(node, SIMCOST_Channel(&src->RX)) != FALSE))
+  {
+    SIMCOST_irqs++;
+  }
+}
+
+void SIMCOST_GetEstimate(SIMCOST_Estimate *estimate)
+{
+  Ifx_SRC_ASCLIN  *src     = &MODULE_SRC.ASCLIN.ASCLIN[SIMCOST_index];
+  Ifx_ASCLIN      *asclin  = &SIMCORE_IMAGE(*SIMCOST_modules[SIMCOST_index]);
+  uint32           channel = SIMCOST_Channel(&src->TX);
+  double           fCpu    = (double)SIMSCU_GetCpuFrequency(0);
+  double           fSri    = (double)SIMSCU_GetSriFrequency();
+  double           cpu     = ((double)SIMCOST_accesses * SIMCOST_costs.access) + ((double)SIMCOST_irqs * SIMCOST_costs.irq);
+  double           dma     = (double)SIMCOST_moves * SIMCOST_costs.move;
+  double           perRequest;
+  double           rate;
+  double           limit;
+  SIMASCLIN_Stats  uart;
+  SIMDMA_Stats     tx      = {0};
+
+  SIMASCLIN_GetStats(SIMCOST_index, &uart);
+
+  estimate->dmaPath   = (boolean)(channel != SIMCOST_NO_CHANNEL);
+  estimate->intLevel  = asclin->TXFIFOCON.B.INTLEVEL;
+  estimate->frame     = SIMASCLIN_GetFrameTime(SIMCOST_index);
+  estimate->accesses  = SIMCOST_accesses;
+  estimate->moves     = SIMCOST_moves;
+  estimate->irqs      = SIMCOST_irqs;
+  estimate->txBytes   = uart.txBytes;
+  estimate->moveBytes = 0;
+
+  if (estimate->dmaPath != FALSE)
+  {
+    SIMDMA_GetStats(channel, &tx);
+    estimate->moveBytes    = 1u << SIMCORE_IMAGE(MODULE_DMA.CH[channel]).CHCFGR.B.CHDW;
+    estimate->requests     = tx.transfers;
+    estimate->transactions = tx.transactions;
+    /* the moves of one transfer back to back on the SRI */
+    perRequest = (estimate->requests != 0) ? (((double)SIMCOST_txMoves * SIMCOST_costs.move) / estimate->requests / fSri) : 0.0;
+  }
+  else
+  {
+    estimate->requests     = (uint32)SIMCOST_txIrqs;
+    estimate->transactions = 0;
+    /* the entry and an equal share of the accesses in the handler */
+    perRequest = (estimate->requests != 0) ?
+                 ((SIMCOST_costs.irq + (((double)SIMCOST_accesses * SIMCOST_costs.access) / estimate->requests)) / fCpu) : 0.0;
+  }
+
+  estimate->cpuPerByte = (uart.txBytes != 0) ? (cpu / uart.txBytes) : 0.0;
+  estimate->dmaPerByte = (uart.txBytes != 0) ? (dma / uart.txBytes) : 0.0;
+  estimate->service    = (uint64)(perRequest * 1e9);
+  /* a request is raised with INTLEVEL frames in the FIFO and one in the shift register */
+  estimate->slack      = (sint64)((estimate->intLevel + 1u) * estimate->frame) - (sint64)estimate->service;
+
+  /* the slowest stage limits the throughput */
+  rate            = (estimate->frame != 0) ? (1e9 / (double)estimate->frame) : 0.0;
+  estimate->bound = "line";
+  limit           = (estimate->cpuPerByte > 0.0) ? (fCpu / estimate->cpuPerByte) : rate;
+  if (limit < rate)
+  {
+    rate            = limit;
+    estimate->bound = "cpu";
+  }
+  limit = (estimate->dmaPerByte > 0.0) ? (fSri / estimate->dmaPerByte) : rate;
+  if (limit < rate)
+  {
+    rate            = limit;
+    estimate->bound = "dma";
+  }
+  limit = ((perRequest > 0.0) && (estimate->requests != 0)) ? (((double)uart.txBytes / estimate->requests) / perRequest) : rate;
+  if (limit < rate)
+  {
+    rate            = limit;
+    estimate->bound = "service";
+  }
+  estimate->throughput = (uint32)rate;
+
+  /* a block waits for the CPU work of its transaction and its first request */
+  estimate->size    = (estimate->transactions != 0) ? (uart.txBytes / estimate->transactions) : 1u;
+  perRequest       += (estimate->transactions != 0) ? ((cpu / estimate->transactions) / fCpu) : 0.0;
+  estimate->first   = (uint64)((perRequest * 1e9) + (double)estimate->frame);
+  estimate->latency = (rate > 0.0) ? (uint64)((perRequest * 1e9) + ((estimate->size * 1e9) / rate)) : 0u;
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
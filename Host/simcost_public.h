@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * \file simcost_public.h
+ * \brief Cycle-approximate timing model of the ASCLIN and DMA path
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMCOST_PUBLIC_H
+#define SIMCOST_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+/* Rough costs on a TC29x at fCPU = fSRI = 200MHz and fSPB = 100MHz */
+#define SIMCOST_DEFAULT_ACCESS 12u   /**< \brief CPU cycles of a register access over the SPB */
+#define SIMCOST_DEFAULT_MOVE   10u   /**< \brief fSRI cycles of a DMA move, read and write */
+#define SIMCOST_DEFAULT_IRQ    40u   /**< \brief CPU cycles of an interrupt entry and return */
+
+/** \brief Charged costs */
+typedef struct
+{
+  uint32 access;  /**< \brief CPU cycles per register access of the firmware */
+  uint32 move;    /**< \brief fSRI cycles per DMA move */
+  uint32 irq;     /**< \brief CPU cycles per interrupt entry and return */
+} SIMCOST_Costs;
+
+/** \brief Estimate of the transmit path, times in ns */
+typedef struct
+{
+  boolean     dmaPath;      /**< \brief transmit requests go to the DMA, else to an ISR */
+  uint32      intLevel;     /**< \brief TXFIFOCON.INTLEVEL */
+  uint32      moveBytes;    /**< \brief bytes per move of the transmit channel, from CHDW */
+  uint64      frame;        /**< \brief frame time at the programmed baud rate */
+  uint64      accesses;     /**< \brief register accesses of the firmware to the path */
+  uint64      moves;        /**< \brief DMA moves of the path channels */
+  uint64      irqs;         /**< \brief interrupts of the path nodes */
+  uint32      txBytes;      /**< \brief frames sent */
+  uint32      requests;     /**< \brief transmit requests served */
+  uint32      transactions; /**< \brief transmit DMA transactions, blocks sent */
+  double      cpuPerByte;   /**< \brief CPU cycles per byte sent */
+  double      dmaPerByte;   /**< \brief fSRI cycles per byte sent */
+  uint64      service;      /**< \brief time to serve a transmit request */
+  sint64      slack;        /**< \brief time left before the FIFO runs empty after a request */
+  uint32      throughput;   /**< \brief achievable bytes per second */
+  const char *bound;        /**< \brief limit of the throughput: line, cpu, dma or service */
+  uint32      size;         /**< \brief bytes of the average block */
+  uint64      first;        /**< \brief from the start of a block to the end of its first frame */
+  uint64      latency;      /**< \brief from the start of a block to the end of its last frame */
+} SIMCOST_Estimate;
+
+/** \brief Start counting the path of an ASCLIN module.
+ * The path are the module, its service request nodes and the DMA channels
+ * and nodes which its nodes request.
+ *
+ * \param index ASCLIN module index
+ * \param costs charged costs
+ * \return None
+ *
+ *  \ingroup SimCost
+ */
+extern void SIMCOST_Init(uint32 index, const SIMCOST_Costs *costs);
+
+/** \brief Count a register access of the firmware, called by the core model.
+ *
+ * \param address accessed register
+ * \return None
+ *
+ *  \ingroup SimCost
+ */
+extern void SIMCOST_Access(uint32 address);
+
+/** \brief Count a DMA move, called by the DMA model.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup SimCost
+ */
+extern void SIMCOST_Move(uint32 channel);
+
+/** \brief Count an interrupt entry, called by the interrupt model.
+ *
+ * \param node address of the service request node
+ * \return None
+ *
+ *  \ingroup SimCost
+ */
+extern void SIMCOST_Interrupt(uint32 node);
+
+/** \brief Estimate throughput and latency from the counts and the registers.
+ *
+ * \param estimate receives the estimate
+ * \return None
+ *
+ *  \ingroup SimCost
+ */
+extern void SIMCOST_GetEstimate(SIMCOST_Estimate *estimate);
+
+#endif	/* end of file */
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * \file simcpu.c
+ * \brief Core registers of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The interrupt control register and the other core registers behave like
+ * memory. The clock counter follows the simulated time at the frequency of
+ * the core, the instruction counter counts one instruction per cycle.
+ */
+#include "Ifx_Types.h"
+#include "IfxCpu_reg.h"
+
+#include "simcore_public.h"
+#include "simscu_public.h"
+#include "simcpu_public.h"
+
+#define SIMCPU_COUNTER_MASK 0x7FFFFFFFu  /**< \brief 31 bit counters, bit 31 is the sticky overflow */
+
+/** \brief Clock counter of one core */
+typedef struct
+{
+  SIMCORE_Clock clock;
+  uint32        offset;  /**< \brief written counter value minus cycles */
+} SIMCPU_Core;
+
+/** \addtogroup SimCpu_Variables */
+/* private data */
+static SIMCPU_Core SIMCPU_cores[SIMCPU_NUM_CORES];
+
+/* private functions */
+
+/** \brief Update the counter registers of a core.
+ *
+ * \param address accessed register
+ * \return None
+ *
+ *  \ingroup SimCpu
+ */
+static void SIMCPU_Read(uint32 address)
+{
+  uint32 core   = (address - SIMCORE_ADDRESS(CPU0_CCTRL)) / SIMCPU_STRIDE;
+  uint32 cycles;
+
+  if (SIMCPU_IMAGE(CPU0_CCTRL, core).B.CE == 0)
+  {
+    /* counters stopped, the image holds the last values */
+    return;
+  }
+
+  cycles = (uint32)SIMCPU_GetCycles(core) + SIMCPU_cores[core].offset;
+  SIMCPU_IMAGE(CPU0_CCNT, core).U = cycles & SIMCPU_COUNTER_MASK;
+  SIMCPU_IMAGE(CPU0_ICNT, core).U = cycles & SIMCPU_COUNTER_MASK;
+}
+
+/** \brief Counter written or started, the counters continue from the image.
+ *
+ * \param address written register
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimCpu
+ */
+static void SIMCPU_Write(uint32 address, uint32 old)
+{
+  uint32 core = (address - SIMCORE_ADDRESS(CPU0_CCTRL)) / SIMCPU_STRIDE;
+
+  (void)old;
+  SIMCPU_cores[core].offset = SIMCPU_IMAGE(CPU0_CCNT, core).U - (uint32)SIMCPU_GetCycles(core);
+}
+
+/* global functions */
+
+void SIMCPU_Init(void)
+{
+  for (uint32 core = 0; core < SIMCPU_NUM_CORES; core++)
+  {
+    SIMCPU_IMAGE(CPU0_CORE_ID, core).U = core;
+    SIMCPU_IMAGE(CPU0_CCTRL, core).U   = 0;
+    SIMCORE_Attach(SIMCORE_ADDRESS(CPU0_CCTRL) + (core * SIMCPU_STRIDE), 0x18u, SIMCPU_Read, SIMCPU_Write);
+  }
+}
+
+uint64 SIMCPU_GetCycles(uint32 core)
+{
+  return SIMCORE_GetTicks(&SIMCPU_cores[core].clock, SIMSCU_GetCpuFrequency(core));
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
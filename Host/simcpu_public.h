@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * \file simcpu_public.h
+ * \brief Core registers of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMCPU_PUBLIC_H
+#define SIMCPU_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxCpu_reg.h"
+
+#define SIMCPU_NUM_CORES 3u         /**< \brief emulated cores */
+#define SIMCPU_STRIDE    0x20000u   /**< \brief distance of the register blocks of two cores */
+
+/** \brief Register image of a core register.
+ * \param reg register of CPU0, e.g. CPU0_ICR
+ * \param core core index
+ */
+#define SIMCPU_IMAGE(reg, core) \
+  (*(__typeof__(&(reg)))SIMCORE_Image(SIMCORE_ADDRESS(reg) + ((core) * SIMCPU_STRIDE)))
+
+/** \brief Preset the core identification, attach the clock and performance counters.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimCpu
+ */
+extern void SIMCPU_Init(void);
+
+/** \brief Clock cycles of a core since the start of the simulation.
+ *
+ * \param core core index
+ * \return cycles at the current core frequency
+ *
+ *  \ingroup SimCpu
+ */
+extern uint64 SIMCPU_GetCycles(uint32 core);
+
+#endif	/* end of file */
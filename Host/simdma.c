@@ -0,0 +1,362 @@
+/*******************************************************************************
+ * \file simdma.c
+ * \brief DMA model of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* A transfer takes no simulated time: it is executed when the request
+ * arrives, requests raised by its own moves are served when it is done,
+ * highest channel first. Source and destination may be registers, they are
+ * accessed through the models, or memory of the host process.
+ */
+#include <stdio.h>
+
+#include "Ifx_Types.h"
+#include "IfxDma_reg.h"
+#include "IfxSrc_reg.h"
+
+#include "simcore_public.h"
+#include "simirq_public.h"
+#include "simcost_public.h"
+#include "simdma_public.h"
+
+/** \addtogroup SimDma_Variables */
+/* private data */
+static const uint8 SIMDMA_moves[8] = {1, 2, 4, 8, 16, 3, 5, 9};  /* by CHCFGR.BLKM */
+
+static uint32       SIMDMA_requested[SIMDMA_NUM_CHANNELS / 32u];
+static boolean      SIMDMA_busy;
+static SIMDMA_Stats SIMDMA_stats[SIMDMA_NUM_CHANNELS];
+
+/* private functions */
+
+/** \brief Next address of a move.
+ *
+ * \param address current address
+ * \param offset signed address offset
+ * \param circular TRUE for a circular buffer
+ * \param length circular buffer length, log2
+ * \param wrapped set if the circular buffer wraps around
+ * \return updated address
+ *
+ *  \ingroup SimDma
+ */
+static uint32 SIMDMA_Next(uint32 address, sint32 offset, boolean circular, uint32 length, boolean *wrapped)
+{
+  uint32 next = address + (uint32)offset;
+
+  if (circular != FALSE)
+  {
+    uint32 mask = (1u << length) - 1u;
+
+    next = (address & ~mask) | (next & mask);
+    if ((((offset > 0) && ((next & mask) < (address & mask))) || ((offset < 0) && ((next & mask) > (address & mask)))))
+    {
+      *wrapped = TRUE;
+    }
+  }
+
+  return next;
+}
+
+/** \brief Execute one transfer of a channel, the moves of one request.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+static void SIMDMA_Transfer(uint32 channel)
+{
+  Ifx_DMA      *dma    = &SIMCORE_IMAGE(MODULE_DMA);
+  Ifx_DMA_CH   *ch     = &dma->CH[channel];
+  volatile Ifx_DMA_TSR *tsr = &dma->TSR[channel];
+  Ifx_DMA_CH_CHCFGR chcfgr;
+  Ifx_DMA_CH_ADICR  adicr;
+  uint32       width;
+  uint32       words;
+  sint32       srcOffset;
+  sint32       dstOffset;
+  boolean      wrapSrc = FALSE;
+  boolean      wrapDst = FALSE;
+  boolean      trigger;
+
+  chcfgr.U = ch->CHCFGR.U;
+  adicr.U  = ch->ADICR.U;
+
+  if (ch->CHCSR.B.TCOUNT == 0)
+  {
+    /* start of a transaction */
+    ch->CHCSR.B.TCOUNT = (chcfgr.B.TREL != 0) ? chcfgr.B.TREL : 1u;
+  }
+
+  if (chcfgr.B.RROAT == 0)
+  {
+    /* one request per transfer */
+    tsr->B.CH = 0;
+    SIMDMA_requested[channel / 32u] &= ~(1u << (channel % 32u));
+  }
+
+  /* moves wider than 32 bit are split into words */
+  width     = 1u << chcfgr.B.CHDW;
+  words     = (width > 4u) ? (width / 4u) : 1u;
+  width     = (width > 4u) ? 4u : width;
+  srcOffset = (sint32)((width * words) << adicr.B.SMF);
+  dstOffset = (sint32)((width * words) << adicr.B.DMF);
+  srcOffset = (adicr.B.INCS != 0) ? srcOffset : -srcOffset;
+  dstOffset = (adicr.B.INCD != 0) ? dstOffset : -dstOffset;
+
+  for (uint32 move = 0; move < SIMDMA_moves[chcfgr.B.BLKM]; move++)
+  {
+    uint32 sadr = ch->SADR.U;
+    uint32 dadr = ch->DADR.U;
+
+    for (uint32 word = 0; word < words; word++)
+    {
+      uint32 value = SIMCORE_BusRead(sadr + (word * width), width);
+
+      SIMCORE_BusWrite(dadr + (word * width), value, width);
+    }
+
+    ch->SADR.U = SIMDMA_Next(sadr, srcOffset, (boolean)adicr.B.SCBE, adicr.B.CBLS, &wrapSrc);
+    ch->DADR.U = SIMDMA_Next(dadr, dstOffset, (boolean)adicr.B.DCBE, adicr.B.CBLD, &wrapDst);
+    SIMDMA_stats[channel].bytes += width * words;
+    SIMCOST_Move(channel);
+  }
+
+  SIMDMA_stats[channel].transfers++;
+  ch->CHCSR.B.TCOUNT--;
+  ch->CHCSR.B.WRPS |= wrapSrc;
+  ch->CHCSR.B.WRPD |= wrapDst;
+
+  /* INTCT bit 0: on every decrement or at TCOUNT == IRDV, bit 1: raise the service request */
+  trigger = (boolean)(((adicr.B.INTCT & 1u) != 0) || (ch->CHCSR.B.TCOUNT == adicr.B.IRDV));
+
+  if (ch->CHCSR.B.TCOUNT == 0)
+  {
+    /* end of the transaction */
+    SIMDMA_stats[channel].transactions++;
+    tsr->B.CH = 0;
+    SIMDMA_requested[channel / 32u] &= ~(1u << (channel % 32u));
+    if (chcfgr.B.CHMODE == 0)
+    {
+      /* single mode, the software has to enable the next transaction */
+      tsr->B.HTRE = 0;
+    }
+  }
+
+  if ((trigger != FALSE) && ((adicr.B.INTCT & 2u) != 0))
+  {
+    ch->CHCSR.B.ICH = 1;
+    SIMIRQ_Raise(&MODULE_SRC.DMA.DMA[0].CH[channel]);
+  }
+  if (((wrapSrc != FALSE) && (adicr.B.WRPSE != 0)) || ((wrapDst != FALSE) && (adicr.B.WRPDE != 0)))
+  {
+    SIMIRQ_Raise(&MODULE_SRC.DMA.DMA[0].CH[channel]);
+  }
+}
+
+/** \brief Serve the requested channels, highest channel first.
+ * Requests raised by the moves are served in the same loop, not recursively.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+static void SIMDMA_Service(void)
+{
+  boolean more = TRUE;
+
+  if (SIMDMA_busy != FALSE)
+  {
+    return;
+  }
+
+  SIMDMA_busy = TRUE;
+  while (more != FALSE)
+  {
+    more = FALSE;
+    for (uint32 word = SIMDMA_NUM_CHANNELS / 32u; word > 0u; word--)
+    {
+      uint32 bits = SIMDMA_requested[word - 1u];
+
+      if (bits != 0)
+      {
+        SIMDMA_Transfer(((word - 1u) * 32u) + (31u - (uint32)__builtin_clz(bits)));
+        more = TRUE;
+        break;
+      }
+    }
+  }
+  SIMDMA_busy = FALSE;
+}
+
+/** \brief Set the transaction request of a channel.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+static void SIMDMA_SetRequest(uint32 channel)
+{
+  volatile Ifx_DMA_TSR *tsr = &SIMCORE_IMAGE(MODULE_DMA).TSR[channel];
+
+  if (tsr->B.CH != 0)
+  {
+    tsr->B.TRL = 1;
+    SIMDMA_stats[channel].lost++;
+  }
+  else
+  {
+    tsr->B.CH = 1;
+    SIMDMA_requested[channel / 32u] |= 1u << (channel % 32u);
+  }
+  SIMDMA_Service();
+}
+
+/** \brief Execute the write only bits of the state and control registers.
+ *
+ * \param address written register
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+static void SIMDMA_Write(uint32 address, uint32 old)
+{
+  Ifx_DMA *dma    = &SIMCORE_IMAGE(MODULE_DMA);
+  uint32   offset = address - SIMCORE_ADDRESS(MODULE_DMA);
+
+  if ((offset >= offsetof(Ifx_DMA, TSR)) && (offset < offsetof(Ifx_DMA, CH)))
+  {
+    uint32       channel = (offset - offsetof(Ifx_DMA, TSR)) / sizeof(Ifx_DMA_TSR);
+    volatile Ifx_DMA_TSR *tsr = &dma->TSR[channel];
+    Ifx_DMA_TSR  written;
+    Ifx_DMA_TSR  before;
+
+    written.U = tsr->U;
+    before.U  = old;
+    tsr->U    = before.U;
+
+    if (written.B.RST != 0)
+    {
+      tsr->U                    = 0;
+      dma->CH[channel].CHCSR.U  = 0;
+      SIMDMA_requested[channel / 32u] &= ~(1u << (channel % 32u));
+    }
+    if (written.B.CTL != 0)
+    {
+      tsr->B.TRL = 0;
+    }
+    if (written.B.HLTREQ != 0)
+    {
+      tsr->B.HLTREQ = 1;
+      tsr->B.HLTACK = 1;
+    }
+    if (written.B.HLTCLR != 0)
+    {
+      tsr->B.HLTREQ = 0;
+      tsr->B.HLTACK = 0;
+    }
+    if (written.B.DCH != 0)
+    {
+      tsr->B.HTRE = 0;
+    }
+    else if (written.B.ECH != 0)
+    {
+      tsr->B.HTRE = 1;
+      SIMIRQ_DmaReady(channel);
+    }
+  }
+  else if ((offset >= offsetof(Ifx_DMA, CH)) &&
+           (((offset - offsetof(Ifx_DMA, CH)) % sizeof(Ifx_DMA_CH)) == offsetof(Ifx_DMA_CH, CHCSR)))
+  {
+    uint32           channel = (offset - offsetof(Ifx_DMA, CH)) / sizeof(Ifx_DMA_CH);
+    volatile Ifx_DMA_CH_CHCSR *chcsr = &dma->CH[channel].CHCSR;
+    Ifx_DMA_CH_CHCSR written;
+
+    written.U  = chcsr->U;
+    chcsr->U   = old;
+
+    if (written.B.CICH != 0)
+    {
+      chcsr->B.ICH = 0;
+    }
+    if (written.B.CWRP != 0)
+    {
+      chcsr->B.WRPS = 0;
+      chcsr->B.WRPD = 0;
+    }
+    if (written.B.SIT != 0)
+    {
+      chcsr->B.ICH = 1;
+      SIMIRQ_Raise(&MODULE_SRC.DMA.DMA[0].CH[channel]);
+    }
+    if (written.B.SCH != 0)
+    {
+      SIMDMA_SetRequest(channel);
+    }
+  }
+}
+
+/* global functions */
+
+void SIMDMA_Init(void)
+{
+  SIMCORE_Attach(SIMCORE_ADDRESS(MODULE_DMA.TSR[0]), sizeof(MODULE_DMA.TSR) + sizeof(MODULE_DMA.CH), NULL, SIMDMA_Write);
+}
+
+boolean SIMDMA_Request(uint32 channel)
+{
+  if ((channel >= SIMDMA_NUM_CHANNELS) || (SIMCORE_IMAGE(MODULE_DMA).TSR[channel].B.HTRE == 0))
+  {
+    return FALSE;
+  }
+
+  SIMDMA_SetRequest(channel);
+  return TRUE;
+}
+
+void SIMDMA_GetStats(uint32 channel, SIMDMA_Stats *stats)
+{
+  *stats = SIMDMA_stats[channel % SIMDMA_NUM_CHANNELS];
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
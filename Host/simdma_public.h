@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * \file simdma_public.h
+ * \brief DMA model of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMDMA_PUBLIC_H
+#define SIMDMA_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+#define SIMDMA_NUM_CHANNELS 128u
+
+/** \brief Activity of one channel */
+typedef struct
+{
+  uint32 transactions;  /**< \brief completed transactions, TCOUNT reached 0 */
+  uint32 transfers;     /**< \brief transfers, one per TCOUNT decrement */
+  uint32 bytes;         /**< \brief bytes moved */
+  uint32 lost;          /**< \brief requests while the last one was pending */
+} SIMDMA_Stats;
+
+/** \brief Attach the DMA registers.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+extern void SIMDMA_Init(void);
+
+/** \brief Hardware request of the interrupt router.
+ * The transfer is executed before the function returns.
+ *
+ * \param channel DMA channel, the priority of the service request
+ * \return TRUE if the channel has accepted the request
+ *
+ *  \ingroup SimDma
+ */
+extern boolean SIMDMA_Request(uint32 channel);
+
+/** \brief Copy the statistics of a channel.
+ *
+ * \param channel DMA channel
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup SimDma
+ */
+extern void SIMDMA_GetStats(uint32 channel, SIMDMA_Stats *stats);
+
+#endif	/* end of file */
@@ -0,0 +1,356 @@
+/*******************************************************************************
+ * \file simirq.c
+ * \brief Interrupt router of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* A service request node with SRR set is routed by its TOS: to a DMA
+ * channel, which clears SRR when it accepts the request, or to a core. The
+ * requests of a core are served on the time base: the handler registered by
+ * IFX_INTERRUPT in IfxCompiler_hostVectors is called with ICR.IE cleared and
+ * ICR.CCPN raised to the priority of the request, like the entry of an
+ * interrupt on the TriCore. The handler runs on the thread of its core.
+ */
+#include <stdio.h>
+
+#include "Ifx_Types.h"
+#include "IfxSrc_reg.h"
+#include "IfxCpu_reg.h"
+
+#include "simcore_public.h"
+#include "simcpu_public.h"
+#include "simdma_public.h"
+#include "simcost_public.h"
+#include "simirq_public.h"
+
+#define SIMIRQ_NUM_NODES (sizeof(Ifx_SRC) / sizeof(Ifx_SRC_SRCR))
+#define SIMIRQ_VECTAB    0u       /**< \brief all cores share VECTAB0 */
+
+/** \addtogroup SimIrq_Variables */
+/* private data */
+/* nodes which may have a request for a core or a DMA channel, cleaned lazily */
+static uint32 SIMIRQ_cpuPending[SIMIRQ_NUM_NODES / 32u];
+static uint32 SIMIRQ_dmaPending[SIMIRQ_NUM_NODES / 32u];
+
+/* simulated time of the last request of each node */
+static uint64 SIMIRQ_raised[SIMIRQ_NUM_NODES];
+
+static SIMIRQ_Stats SIMIRQ_stats[SIMCPU_NUM_CORES][256];
+
+/* private functions */
+
+/** \brief Node index of a service request node.
+ *
+ * \param address node address
+ * \return index in Ifx_SRC
+ *
+ *  \ingroup SimIrq
+ */
+static uint32 SIMIRQ_Index(uint32 address)
+{
+  return (address - SIMCORE_ADDRESS(MODULE_SRC)) / sizeof(Ifx_SRC_SRCR);
+}
+
+/** \brief Register image of a node.
+ *
+ * \param index node index
+ * \return node
+ *
+ *  \ingroup SimIrq
+ */
+static volatile Ifx_SRC_SRCR *SIMIRQ_Node(uint32 index)
+{
+  return SIMCORE_Image(SIMCORE_ADDRESS(MODULE_SRC) + (index * sizeof(Ifx_SRC_SRCR)));
+}
+
+/** \brief Route a request to its DMA channel or core.
+ *
+ * \param index node with SRR and SRE set
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+static void SIMIRQ_Route(uint32 index)
+{
+  volatile Ifx_SRC_SRCR *node = SIMIRQ_Node(index);
+
+  if (node->B.TOS == SIMIRQ_TOS_DMA)
+  {
+    /* the DMA acknowledges before it moves, a move may raise the node again */
+    node->B.SRR = 0;
+    if (SIMDMA_Request(node->B.SRPN) == FALSE)
+    {
+      /* channel disabled, the request waits */
+      node->B.SRR = 1;
+      SIMIRQ_dmaPending[index / 32u] |= 1u << (index % 32u);
+    }
+  }
+  else
+  {
+    SIMIRQ_cpuPending[index / 32u] |= 1u << (index % 32u);
+    SIMCORE_Kick(node->B.TOS);
+  }
+}
+
+/** \brief Set SRR of a node, route the request if the node is enabled.
+ *
+ * \param index node index
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+static void SIMIRQ_Set(uint32 index)
+{
+  volatile Ifx_SRC_SRCR *node = SIMIRQ_Node(index);
+
+  if (node->B.SRR != 0)
+  {
+    node->B.IOV = 1;
+    if (node->B.TOS < SIMCPU_NUM_CORES)
+    {
+      SIMIRQ_stats[node->B.TOS][node->B.SRPN].lost++;
+    }
+    return;
+  }
+
+  node->B.SRR          = 1;
+  SIMIRQ_raised[index] = SIMCORE_Now();
+  if (node->B.SRE != 0)
+  {
+    SIMIRQ_Route(index);
+  }
+}
+
+/** \brief Software access of a node, executes the write only bits.
+ *
+ * \param address written node
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+static void SIMIRQ_Write(uint32 address, uint32 old)
+{
+  uint32                 index = SIMIRQ_Index(address);
+  volatile Ifx_SRC_SRCR *node  = SIMIRQ_Node(index);
+  Ifx_SRC_SRCR           written;
+  Ifx_SRC_SRCR           before;
+
+  written.U = node->U;
+  before.U  = old;
+
+  /* the status bits are read only, the request bits read as 0 */
+  node->U      = before.U;
+  node->B.SRPN = written.B.SRPN;
+  node->B.SRE  = written.B.SRE;
+  node->B.TOS  = written.B.TOS;
+  node->B.ECC  = written.B.ECC;
+
+  if (written.B.IOVCLR != 0)
+  {
+    node->B.IOV = 0;
+  }
+  if (written.B.SWSCLR != 0)
+  {
+    node->B.SWS = 0;
+  }
+
+  if ((written.B.SETR != 0) && (written.B.CLRR == 0))
+  {
+    node->B.SWS = 1;
+    SIMIRQ_Set(index);
+  }
+  else if ((written.B.CLRR != 0) && (written.B.SETR == 0))
+  {
+    node->B.SRR = 0;
+  }
+  else if ((node->B.SRR != 0) && (node->B.SRE != 0) &&
+           ((before.B.SRE == 0) || (before.B.TOS != node->B.TOS) || (before.B.SRPN != node->B.SRPN)))
+  {
+    /* a pending request has been enabled or moved */
+    SIMIRQ_Route(index);
+  }
+}
+
+/** \brief Find the pending request of a core with the highest priority.
+ *
+ * \param core core index
+ * \param ccpn current CPU priority, only requests above are taken
+ * \return node index, SIMIRQ_NUM_NODES if there is none
+ *
+ *  \ingroup SimIrq
+ */
+static uint32 SIMIRQ_Arbitrate(uint32 core, uint32 ccpn)
+{
+  uint32 best     = SIMIRQ_NUM_NODES;
+  uint32 bestSrpn = ccpn;
+
+  for (uint32 word = 0; word < (SIMIRQ_NUM_NODES / 32u); word++)
+  {
+    uint32 bits = SIMIRQ_cpuPending[word];
+
+    while (bits != 0)
+    {
+      uint32                 bit   = (uint32)__builtin_ctz(bits);
+      uint32                 index = (word * 32u) + bit;
+      volatile Ifx_SRC_SRCR *node  = SIMIRQ_Node(index);
+
+      bits &= bits - 1u;
+      if ((node->B.SRR == 0) || (node->B.SRE == 0) || (node->B.TOS == SIMIRQ_TOS_DMA))
+      {
+        /* cleared by software, disabled or moved to the DMA */
+        SIMIRQ_cpuPending[word] &= ~(1u << bit);
+      }
+      else if ((node->B.TOS == core) && (node->B.SRPN > bestSrpn))
+      {
+        best     = index;
+        bestSrpn = node->B.SRPN;
+      }
+    }
+  }
+
+  return best;
+}
+
+/* global functions */
+
+void SIMIRQ_Init(void)
+{
+  SIMCORE_Attach(SIMCORE_ADDRESS(MODULE_SRC), sizeof(Ifx_SRC), NULL, SIMIRQ_Write);
+}
+
+void SIMIRQ_Raise(volatile Ifx_SRC_SRCR *src)
+{
+  SIMIRQ_Set(SIMIRQ_Index(SIMCORE_ADDRESS(*src)));
+}
+
+void SIMIRQ_Dispatch(void)
+{
+  uint32               core = IfxCompiler_hostCore;
+  volatile Ifx_CPU_ICR *icr = &SIMCPU_IMAGE(CPU0_ICR, core);
+
+  SIMCORE_Lock();
+  while (icr->B.IE != 0)
+  {
+    uint32                 index = SIMIRQ_Arbitrate(core, icr->B.CCPN);
+    volatile Ifx_SRC_SRCR *node;
+    uint32                 srpn;
+    uint64                 latency;
+    Ifx_CPU_ICR            saved;
+    void                 (*isr)(void);
+
+    if (index == SIMIRQ_NUM_NODES)
+    {
+      break;
+    }
+
+    /* acknowledge */
+    node        = SIMIRQ_Node(index);
+    srpn        = node->B.SRPN;
+    node->B.SRR = 0;
+    SIMIRQ_cpuPending[index / 32u] &= ~(1u << (index % 32u));
+
+    latency = SIMCORE_Now() - SIMIRQ_raised[index];
+    SIMIRQ_stats[core][srpn].count++;
+    SIMCOST_Interrupt(SIMCORE_ADDRESS(MODULE_SRC) + (index * sizeof(Ifx_SRC_SRCR)));
+    SIMIRQ_stats[core][srpn].latencySum += latency;
+    if (latency > SIMIRQ_stats[core][srpn].latencyMax)
+    {
+      SIMIRQ_stats[core][srpn].latencyMax = latency;
+    }
+
+    isr = IfxCompiler_hostVectors[SIMIRQ_VECTAB][srpn];
+    if (isr == NULL)
+    {
+      fprintf(stderr, "sim: no handler for priority %u of core %u\n", srpn, core);
+      continue;
+    }
+
+    saved.U      = icr->U;
+    icr->B.IE    = 0;
+    icr->B.CCPN  = srpn;
+
+    /* the handler accesses the registers like the firmware */
+    SIMCORE_Unlock();
+    isr();
+    SIMCORE_Lock();
+
+    icr->U       = saved.U;
+  }
+  SIMCORE_Unlock();
+}
+
+boolean SIMIRQ_IsPending(uint32 core)
+{
+  volatile Ifx_CPU_ICR *icr = &SIMCPU_IMAGE(CPU0_ICR, core);
+
+  return (boolean)((icr->B.IE != 0) && (SIMIRQ_Arbitrate(core, icr->B.CCPN) != SIMIRQ_NUM_NODES));
+}
+
+void SIMIRQ_DmaReady(uint32 channel)
+{
+  for (uint32 word = 0; word < (SIMIRQ_NUM_NODES / 32u); word++)
+  {
+    uint32 bits = SIMIRQ_dmaPending[word];
+
+    while (bits != 0)
+    {
+      uint32                 bit   = (uint32)__builtin_ctz(bits);
+      uint32                 index = (word * 32u) + bit;
+      volatile Ifx_SRC_SRCR *node  = SIMIRQ_Node(index);
+
+      bits &= bits - 1u;
+      if ((node->B.SRR == 0) || (node->B.SRE == 0) || (node->B.TOS != SIMIRQ_TOS_DMA))
+      {
+        SIMIRQ_dmaPending[word] &= ~(1u << bit);
+      }
+      else if ((node->B.SRPN == channel) && (SIMDMA_Request(channel) != FALSE))
+      {
+        node->B.SRR = 0;
+        SIMIRQ_dmaPending[word] &= ~(1u << bit);
+      }
+    }
+  }
+}
+
+void SIMIRQ_GetStats(uint32 core, uint32 srpn, SIMIRQ_Stats *stats)
+{
+  *stats = SIMIRQ_stats[core][srpn & 0xFFu];
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * \file simirq_public.h
+ * \brief Interrupt router of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMIRQ_PUBLIC_H
+#define SIMIRQ_PUBLIC_H
+
+#include "Ifx_Types.h"
+#include "IfxSrc_reg.h"
+
+#define SIMIRQ_TOS_DMA 3u   /**< \brief SRCR.TOS of the DMA */
+
+/** \brief Interrupt statistics of one priority, times in ns of simulated time */
+typedef struct
+{
+  uint32 count;       /**< \brief handler calls */
+  uint32 lost;        /**< \brief requests while the last one was pending */
+  uint64 latencySum;  /**< \brief sum of the times from the request to the handler */
+  uint64 latencyMax;  /**< \brief longest time from the request to the handler */
+} SIMIRQ_Stats;
+
+/** \brief Attach the service request nodes.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+extern void SIMIRQ_Init(void);
+
+/** \brief Hardware request of a peripheral, sets SRR and routes it.
+ *
+ * \param src service request node
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+extern void SIMIRQ_Raise(volatile Ifx_SRC_SRCR *src);
+
+/** \brief Call the handlers of the pending requests of the calling core.
+ * Runs on the thread of the core, a handler is entered when interrupts are
+ * enabled and its priority is above the current CPU priority, handlers do
+ * not nest. Takes the model lock, the caller must not hold it.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+extern void SIMIRQ_Dispatch(void);
+
+/** \brief Check if a core would take an interrupt, called with the model lock.
+ *
+ * \param core core index
+ * \return TRUE if a request can be dispatched on the core
+ *
+ *  \ingroup SimIrq
+ */
+extern boolean SIMIRQ_IsPending(uint32 core);
+
+/** \brief Route the pending requests of a DMA channel again.
+ * Called when the channel accepts hardware requests.
+ *
+ * \param channel DMA channel
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+extern void SIMIRQ_DmaReady(uint32 channel);
+
+/** \brief Copy the statistics of a priority.
+ *
+ * \param core core index
+ * \param srpn service request priority
+ * \param stats receives the statistics
+ * \return None
+ *
+ *  \ingroup SimIrq
+ */
+extern void SIMIRQ_GetStats(uint32 core, uint32 srpn, SIMIRQ_Stats *stats);
+
+#endif	/* end of file */
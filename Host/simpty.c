@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * \file simpty.c
+ * \brief Pseudo-terminal bridge of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The master side of the pseudo-terminal is the other end of the ASCLIN
+ * lines: SIMASCLIN writes the sent frames into it, the step hook reads what
+ * the host tool wrote and puts it on the receive line, where it arrives at
+ * the baud rate unless the pacing is off. Bytes which do not fit on the line
+ * stay in the pseudo-terminal, the tool sees the flow control of a full
+ * kernel buffer like on a USB serial adapter.
+ */
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Ifx_Types.h"
+
+#include "simcore_public.h"
+#include "simasclin_public.h"
+#include "simpty_public.h"
+
+#define SIMPTY_CHUNK 256u   /**< \brief bytes read from the master per step */
+
+/** \brief One bridged module */
+typedef struct
+{
+  int    master;
+  int    slave;                  /**< \brief kept open, the master would report EIO without a tool */
+  uint32 index;                  /**< \brief ASCLIN module */
+  uint8  pending[SIMPTY_CHUNK];  /**< \brief read but not yet on the receive line */
+  uint32 pendingPos;
+  uint32 pendingLen;
+} SIMPTY_Bridge;
+
+/** \addtogroup SimPty_Variables */
+/* private data */
+static SIMPTY_Bridge SIMPTY_bridge = {-1, -1, 0, {0}, 0, 0};
+
+/* private functions */
+
+/** \brief Move the bytes written by the host tool onto the receive line.
+ *
+ * \param now simulated time
+ * \return None
+ *
+ *  \ingroup SimPty
+ */
+static void SIMPTY_Step(uint64 now)
+{
+  SIMPTY_Bridge *bridge = &SIMPTY_bridge;
+
+  (void)now;
+
+  if (bridge->pendingPos == bridge->pendingLen)
+  {
+    ssize_t len = read(bridge->master, bridge->pending, sizeof(bridge->pending));
+
+    /* EAGAIN, nothing written */
+    bridge->pendingPos = 0;
+    bridge->pendingLen = (len > 0) ? (uint32)len : 0u;
+  }
+
+  if (bridge->pendingPos != bridge->pendingLen)
+  {
+    bridge->pendingPos += SIMASCLIN_Receive(bridge->index, &bridge->pending[bridge->pendingPos],
+                                            bridge->pendingLen - bridge->pendingPos);
+  }
+}
+
+/* global functions */
+
+const char *SIMPTY_Open(uint32 index)
+{
+  SIMPTY_Bridge  *bridge = &SIMPTY_bridge;
+  struct termios  raw;
+  const char     *name;
+
+  bridge->master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if ((bridge->master < 0) || (grantpt(bridge->master) != 0) || (unlockpt(bridge->master) != 0) ||
+      ((name = ptsname(bridge->master)) == NULL))
+  {
+    return NULL;
+  }
+
+  /* no echo, no line editing, no CR/LF translation, the tool may change it */
+  bridge->slave = open(name, O_RDWR | O_NOCTTY);
+  if ((bridge->slave < 0) || (tcgetattr(bridge->slave, &raw) != 0))
+  {
+    return NULL;
+  }
+  cfmakeraw(&raw);
+  (void)cfsetspeed(&raw, B115200);
+  (void)tcsetattr(bridge->slave, TCSANOW, &raw);
+
+  bridge->index = index;
+  SIMASCLIN_Init(index, bridge->master);
+  SIMCORE_AddStep(SIMPTY_Step);
+
+  return name;
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
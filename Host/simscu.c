@@ -0,0 +1,215 @@
+/*******************************************************************************
+ * \file simscu.c
+ * \brief Clock tree of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The SCU behaves like memory, the PLL locks instantly and the dividers are
+ * ready at once. The frequencies follow the register image with the formulas
+ * of IfxScuCcu, so clock changes of the firmware take effect immediately.
+ */
+#include "Ifx_Types.h"
+#include "Ifx_Cfg.h"
+#include "IfxScu_reg.h"
+
+#include "simcore_public.h"
+#include "simscu_public.h"
+
+#define SIMSCU_BACKUP_FREQUENCY 100000000u  /**< \brief fBACK */
+
+/** \addtogroup SimScu_Variables */
+/* private data */
+static boolean SIMSCU_finDis;
+
+/* private functions */
+
+/** \brief Update the PLL status before it is read.
+ *
+ * \param address accessed register
+ * \return None
+ *
+ *  \ingroup SimScu
+ */
+static void SIMSCU_Read(uint32 address)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  if (address == SIMCORE_ADDRESS(SCU_PLLSTAT))
+  {
+    scu->PLLSTAT.B.VCOBYST = scu->PLLCON0.B.VCOBYP;
+    scu->PLLSTAT.B.FINDIS  = SIMSCU_finDis;
+    scu->PLLSTAT.B.VCOLOCK = (SIMSCU_finDis == FALSE) ? 1u : 0u;
+    scu->PLLSTAT.B.K1RDY   = 1;
+    scu->PLLSTAT.B.K2RDY   = 1;
+  }
+}
+
+/** \brief Execute the request bits of the clock control registers.
+ *
+ * \param address written register
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimScu
+ */
+static void SIMSCU_Write(uint32 address, uint32 old)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  (void)old;
+
+  if (address == SIMCORE_ADDRESS(SCU_PLLCON0))
+  {
+    if (scu->PLLCON0.B.SETFINDIS != 0)
+    {
+      SIMSCU_finDis = TRUE;
+    }
+    if (scu->PLLCON0.B.CLRFINDIS != 0)
+    {
+      SIMSCU_finDis = FALSE;
+    }
+    scu->PLLCON0.B.SETFINDIS = 0;
+    scu->PLLCON0.B.CLRFINDIS = 0;
+    scu->PLLCON0.B.RESLD     = 0;
+  }
+  else if (address == SIMCORE_ADDRESS(SCU_CCUCON0))
+  {
+    /* the update is done at once */
+    scu->CCUCON0.B.UP  = 0;
+    scu->CCUCON0.B.LCK = 0;
+  }
+  else if (address == SIMCORE_ADDRESS(SCU_CCUCON1))
+  {
+    scu->CCUCON1.B.UP  = 0;
+    scu->CCUCON1.B.LCK = 0;
+  }
+}
+
+/** \brief fPLL, see IfxScuCcu_getPllFrequency.
+ *
+ * \param None
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+static uint32 SIMSCU_GetPllFrequency(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+  uint64   osc = IFX_CFG_SCU_XTAL_FREQUENCY;
+
+  if (scu->PLLCON0.B.VCOBYP != 0)
+  {
+    return (uint32)(osc / (scu->PLLCON1.B.K1DIV + 1u));
+  }
+
+  return (uint32)((osc * (scu->PLLCON0.B.NDIV + 1u)) / ((scu->PLLCON1.B.K2DIV + 1u) * (scu->PLLCON0.B.PDIV + 1u)));
+}
+
+/* global functions */
+
+void SIMSCU_Init(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  /* 20MHz crystal, VCO 600MHz, fPLL 200MHz, the end of IfxScuCcu_init */
+  scu->PLLCON0.B.PDIV     = 1;
+  scu->PLLCON0.B.NDIV     = 59;
+  scu->PLLCON1.B.K1DIV    = 0;
+  scu->PLLCON1.B.K2DIV    = 2;
+  scu->CCUCON0.B.CLKSEL   = 1;
+  scu->CCUCON0.B.SRIDIV   = 1;
+  scu->CCUCON0.B.SPBDIV   = 2;
+  scu->CCUCON0.B.BAUD1DIV = 1;
+  scu->CCUCON0.B.BAUD2DIV = 1;
+  scu->CCUCON0.B.FSIDIV   = 2;
+  scu->CCUCON0.B.FSI2DIV  = 1;
+  scu->CCUCON1.B.INSEL    = 1;
+  scu->CCUCON1.B.STMDIV   = 2;
+  scu->CCUCON1.B.ASCLINFDIV = 1;
+  scu->CCUCON1.B.ASCLINSDIV = 2;
+
+  SIMCORE_Attach(SIMCORE_ADDRESS(SCU_CCUCON0), sizeof(uint32), NULL, SIMSCU_Write);
+  SIMCORE_Attach(SIMCORE_ADDRESS(SCU_CCUCON1), sizeof(uint32), NULL, SIMSCU_Write);
+  SIMCORE_Attach(SIMCORE_ADDRESS(SCU_PLLCON0), sizeof(uint32), NULL, SIMSCU_Write);
+  SIMCORE_Attach(SIMCORE_ADDRESS(SCU_PLLSTAT), sizeof(uint32), SIMSCU_Read, NULL);
+}
+
+uint32 SIMSCU_GetSourceFrequency(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  return (scu->CCUCON0.B.CLKSEL == 1) ? SIMSCU_GetPllFrequency() : SIMSCU_BACKUP_FREQUENCY;
+}
+
+uint32 SIMSCU_GetSriFrequency(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  return (scu->CCUCON0.B.SRIDIV != 0) ? (SIMSCU_GetSourceFrequency() / scu->CCUCON0.B.SRIDIV) : 0u;
+}
+
+uint32 SIMSCU_GetCpuFrequency(uint32 core)
+{
+  Ifx_SCU *scu       = &SIMCORE_IMAGE(MODULE_SCU);
+  uint32   frequency = SIMSCU_GetSriFrequency();
+  uint32   cpuDiv;
+
+  cpuDiv = (core == 0) ? scu->CCUCON6.U : ((core == 1) ? scu->CCUCON7.U : scu->CCUCON8.U);
+  if (cpuDiv != 0)
+  {
+    frequency = (uint32)(((uint64)frequency * cpuDiv) / 64u);
+  }
+
+  return frequency;
+}
+
+uint32 SIMSCU_GetStmFrequency(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  return (scu->CCUCON1.B.STMDIV != 0) ? (SIMSCU_GetSourceFrequency() / scu->CCUCON1.B.STMDIV) : 0u;
+}
+
+uint32 SIMSCU_GetAsclinFrequency(void)
+{
+  Ifx_SCU *scu = &SIMCORE_IMAGE(MODULE_SCU);
+
+  return (scu->CCUCON1.B.ASCLINFDIV > 1) ? (SIMSCU_GetSourceFrequency() / scu->CCUCON1.B.ASCLINFDIV) : SIMSCU_GetSourceFrequency();
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
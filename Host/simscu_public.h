@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * \file simscu_public.h
+ * \brief Clock tree of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMSCU_PUBLIC_H
+#define SIMSCU_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+/** \brief Preset the clock tree to 200MHz from the PLL, attach the SCU.
+ *
+ * \param None
+ * \return None
+ *
+ *  \ingroup SimScu
+ */
+extern void SIMSCU_Init(void);
+
+/** \brief Current fSOURCE, from the PLL or the back-up clock.
+ *
+ * \param None
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+extern uint32 SIMSCU_GetSourceFrequency(void);
+
+/** \brief Current fSRI, the clock of the DMA.
+ *
+ * \param None
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+extern uint32 SIMSCU_GetSriFrequency(void);
+
+/** \brief Current frequency of a core.
+ *
+ * \param core core index
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+extern uint32 SIMSCU_GetCpuFrequency(uint32 core);
+
+/** \brief Current fSTM.
+ *
+ * \param None
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+extern uint32 SIMSCU_GetStmFrequency(void);
+
+/** \brief Current fASCLINF.
+ *
+ * \param None
+ * \return frequency in Hz
+ *
+ *  \ingroup SimScu
+ */
+extern uint32 SIMSCU_GetAsclinFrequency(void);
+
+#endif	/* end of file */
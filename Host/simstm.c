@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * \file simstm.c
+ * \brief System timers of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* The timers count the simulated time at fSTM. Compare matches are found
+ * on the ticks of the time base, a match between two ticks raises the
+ * interrupt on the second one.
+ */
+#include "Ifx_Types.h"
+#include "IfxStm_reg.h"
+#include "IfxSrc_reg.h"
+
+#include "simcore_public.h"
+#include "simirq_public.h"
+#include "simscu_public.h"
+#include "simstm_public.h"
+
+#define SIMSTM_NUM_MODULES 3u
+#define SIMSTM_NUM_CMP     2u
+
+/** \addtogroup SimStm_Variables */
+/* private data */
+static Ifx_STM * const SIMSTM_modules[SIMSTM_NUM_MODULES] = {&MODULE_STM0, &MODULE_STM1, &MODULE_STM2};
+
+static SIMCORE_Clock SIMSTM_clock;
+
+/* timer value up to which the compare registers have been checked */
+static uint64 SIMSTM_checked[SIMSTM_NUM_MODULES][SIMSTM_NUM_CMP];
+
+/* private functions */
+
+/** \brief Find the STM of a register address.
+ *
+ * \param address register address
+ * \return module index
+ *
+ *  \ingroup SimStm
+ */
+static uint32 SIMSTM_Index(uint32 address)
+{
+  return (address - SIMCORE_ADDRESS(MODULE_STM0)) / sizeof(Ifx_STM);
+}
+
+/** \brief Set the interrupt flag of a compare register, raise its service request.
+ *
+ * \param index module index
+ * \param cmp compare register index
+ * \return None
+ *
+ *  \ingroup SimStm
+ */
+static void SIMSTM_Match(uint32 index, uint32 cmp)
+{
+  Ifx_STM        *stm = &SIMCORE_IMAGE(*SIMSTM_modules[index]);
+  Ifx_SRC_STM    *src = &MODULE_SRC.STM.STM[index];
+  Ifx_STM_ICR     icr;
+  boolean         enabled;
+  boolean         sr1;
+
+  icr.U = stm->ICR.U;
+  if (cmp == 0)
+  {
+    icr.B.CMP0IR = 1;
+    enabled      = (boolean)icr.B.CMP0EN;
+    sr1          = (boolean)icr.B.CMP0OS;
+  }
+  else
+  {
+    icr.B.CMP1IR = 1;
+    enabled      = (boolean)icr.B.CMP1EN;
+    sr1          = (boolean)icr.B.CMP1OS;
+  }
+  stm->ICR.U = icr.U;
+
+  if (enabled != FALSE)
+  {
+    SIMIRQ_Raise((sr1 != FALSE) ? &src->SR1 : &src->SR0);
+  }
+}
+
+/** \brief Check a compare register for a match since the last check.
+ *
+ * \param index module index
+ * \param cmp compare register index
+ * \param ticks current timer value
+ * \return None
+ *
+ *  \ingroup SimStm
+ */
+static void SIMSTM_Compare(uint32 index, uint32 cmp, uint64 ticks)
+{
+  Ifx_STM *stm   = &SIMCORE_IMAGE(*SIMSTM_modules[index]);
+  uint32   start = (cmp == 0) ? stm->CMCON.B.MSTART0 : stm->CMCON.B.MSTART1;
+  uint32   size  = ((cmp == 0) ? stm->CMCON.B.MSIZE0 : stm->CMCON.B.MSIZE1) + 1u;
+  uint64   mask  = (size >= 32u) ? 0xFFFFFFFFu : ((1ull << size) - 1u);
+  uint64   from  = SIMSTM_checked[index][cmp] >> start;
+  uint64   to    = ticks >> start;
+  uint64   next  = (stm->CMP[cmp].U - from) & mask;
+
+  SIMSTM_checked[index][cmp] = ticks;
+
+  /* the field passes CMP in (from, to] */
+  if ((to > from) && (((to - from) > mask) || ((next != 0) && (next <= (to - from)))))
+  {
+    SIMSTM_Match(index, cmp);
+  }
+}
+
+/** \brief Update the timer registers before they are read.
+ * Reading TIM0 to TIM5 captures the upper bits in CAP.
+ *
+ * \param address accessed register
+ * \return None
+ *
+ *  \ingroup SimStm
+ */
+static void SIMSTM_Read(uint32 address)
+{
+  uint32   index  = SIMSTM_Index(address);
+  uint32   offset = address - SIMCORE_ADDRESS(*SIMSTM_modules[index]);
+  Ifx_STM *stm    = &SIMCORE_IMAGE(*SIMSTM_modules[index]);
+  uint64   ticks  = SIMSTM_GetTicks();
+
+  stm->TIM0.U   = (uint32)ticks;
+  stm->TIM1.U   = (uint32)(ticks >> 4);
+  stm->TIM2.U   = (uint32)(ticks >> 8);
+  stm->TIM3.U   = (uint32)(ticks >> 12);
+  stm->TIM4.U   = (uint32)(ticks >> 16);
+  stm->TIM5.U   = (uint32)(ticks >> 20);
+  stm->TIM6.U   = (uint32)(ticks >> 32);
+  stm->TIM0SV.U = (uint32)ticks;
+
+  if ((offset >= offsetof(Ifx_STM, TIM0)) && (offset <= offsetof(Ifx_STM, TIM5)))
+  {
+    stm->CAP.U = (uint32)(ticks >> 32);
+  }
+  else if (offset == offsetof(Ifx_STM, TIM0SV))
+  {
+    stm->CAPSV.U = (uint32)(ticks >> 32);
+  }
+}
+
+/** \brief Handle the interrupt set and clear bits, restart the compare after a change.
+ *
+ * \param address written register
+ * \param old value before the write
+ * \return None
+ *
+ *  \ingroup SimStm
+ */
+static void SIMSTM_Write(uint32 address, uint32 old)
+{
+  uint32   index  = SIMSTM_Index(address);
+  uint32   offset = address - SIMCORE_ADDRESS(*SIMSTM_modules[index]);
+  Ifx_STM *stm    = &SIMCORE_IMAGE(*SIMSTM_modules[index]);
+  uint64   ticks  = SIMSTM_GetTicks();
+
+  (void)old;
+
+  if (offset == offsetof(Ifx_STM, ISCR))
+  {
+    Ifx_STM_ISCR iscr;
+
+    iscr.U       = stm->ISCR.U;
+    stm->ISCR.U  = 0;
+    if (iscr.B.CMP0IRR != 0)
+    {
+      stm->ICR.B.CMP0IR = 0;
+    }
+    if (iscr.B.CMP1IRR != 0)
+    {
+      stm->ICR.B.CMP1IR = 0;
+    }
+    if (iscr.B.CMP0IRS != 0)
+    {
+      SIMSTM_Match(index, 0);
+    }
+    if (iscr.B.CMP1IRS != 0)
+    {
+      SIMSTM_Match(index, 1);
+    }
+  }
+  else if ((offset == offsetof(Ifx_STM, CMP[0])) || (offset == offsetof(Ifx_STM, CMCON)))
+  {
+    SIMSTM_checked[index][0] = ticks;
+  }
+
+  if ((offset == offsetof(Ifx_STM, CMP[1])) || (offset == offsetof(Ifx_STM, CMCON)))
+  {
+    SIMSTM_checked[index][1] = ticks;
+  }
+}
+
+/** \brief Check the compare registers of all timers.
+ *
+ * \param now simulated time, not used, the timers read the time base
+ * \return None
+ *
+ *  \ingroup SimStm
+ */
+static void SIMSTM_Step(uint64 now)
+{
+  uint64 ticks = SIMSTM_GetTicks();
+
+  (void)now;
+
+  for (uint32 index = 0; index < SIMSTM_NUM_MODULES; index++)
+  {
+    for (uint32 cmp = 0; cmp < SIMSTM_NUM_CMP; cmp++)
+    {
+      SIMSTM_Compare(index, cmp, ticks);
+    }
+  }
+}
+
+/* global functions */
+
+void SIMSTM_Init(void)
+{
+  for (uint32 index = 0; index < SIMSTM_NUM_MODULES; index++)
+  {
+    SIMCORE_Attach(SIMCORE_ADDRESS(*SIMSTM_modules[index]), sizeof(Ifx_STM), SIMSTM_Read, SIMSTM_Write);
+  }
+
+  SIMCORE_AddStep(SIMSTM_Step);
+}
+
+uint64 SIMSTM_GetTicks(void)
+{
+  return SIMCORE_GetTicks(&SIMSTM_clock, SIMSCU_GetStmFrequency());
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
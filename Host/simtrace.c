@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * \file simtrace.c
+ * \brief Register access trace of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+/* Every register access of the firmware faults into the core model, which
+ * reports it here with the address of the accessing instruction. A write
+ * whose core read the same register with its access before is marked as
+ * the write of a read-modify-write, as produced by a bit field assignment
+ * or a |= on a register union. On a write only or set/clear register that
+ * read is wasted on the slow peripheral bus or, worse, writes back bits
+ * which trigger an action again.
+ */
+#include <stdio.h>
+
+#include "Ifx_Types.h"
+
+#include "simcore_public.h"
+#include "simcpu_public.h"
+#include "simtrace_public.h"
+
+#define SIMTRACE_BUFFER_SIZE 0x100000u   /**< \brief stdio buffer of the trace file */
+
+/** \brief Last access of a core */
+typedef struct
+{
+  uint32  address;
+  boolean valid;
+  boolean write;
+} SIMTRACE_Last;
+
+/** \addtogroup SimTrace_Variables */
+/* private data */
+static FILE           *SIMTRACE_file;
+static SIMTRACE_Last   SIMTRACE_last[SIMCPU_NUM_CORES];
+static SIMTRACE_Stats  SIMTRACE_stats[SIMCPU_NUM_CORES];
+
+/* global functions */
+
+boolean SIMTRACE_Open(const char *path)
+{
+  SIMTRACE_file = fopen(path, "w");
+  if (SIMTRACE_file == NULL)
+  {
+    return FALSE;
+  }
+
+  (void)setvbuf(SIMTRACE_file, NULL, _IOFBF, SIMTRACE_BUFFER_SIZE);
+  fprintf(SIMTRACE_file, "# time core site access address value\n");
+  return TRUE;
+}
+
+void SIMTRACE_Access(uint32 address, boolean write, uint32 value, uint64 site)
+{
+  uint32         core = IfxCompiler_hostCore;
+  SIMTRACE_Last *last = &SIMTRACE_last[core];
+  char           kind = 'R';
+
+  if ((SIMTRACE_file == NULL) || (core >= SIMCPU_NUM_CORES))
+  {
+    return;
+  }
+
+  if (write == FALSE)
+  {
+    SIMTRACE_stats[core].reads++;
+  }
+  else if ((last->valid != FALSE) && (last->write == FALSE) && (last->address == address))
+  {
+    SIMTRACE_stats[core].writes++;
+    SIMTRACE_stats[core].rmw++;
+    kind = 'M';
+  }
+  else
+  {
+    SIMTRACE_stats[core].writes++;
+    kind = 'W';
+  }
+
+  last->address = address;
+  last->write   = write;
+  last->valid   = TRUE;
+
+  fprintf(SIMTRACE_file, "%llu %u 0x%llx %c 0x%08X 0x%08X\n", (unsigned long long)SIMCORE_Now(), core,
+          (unsigned long long)site, kind, address, value);
+}
+
+boolean SIMTRACE_GetStats(uint32 core, SIMTRACE_Stats *stats)
+{
+  *stats = SIMTRACE_stats[core];
+  return (boolean)(SIMTRACE_file != NULL);
+}
+
+
+/*************************************************************************
+ Development history of the file
+
+
+
+*************************************************************************/
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * \file simtrace_public.h
+ * \brief Register access trace of the host simulator
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or
+ * the company in which ordinary course of business you are acting and (ii)
+ * Infineon Technologies AG or its licensees. If and as long as no such terms
+ * of use are agreed, use of this file is subject to following:
+ *
+ * Boost Software License - Version 1.0 - August 17th, 2003
+ *
+ * Permission is hereby granted, free of charge, to any person or organization
+ * obtaining a copy of the software and accompanying documentation covered by
+ * this license (the "Software") to use, reproduce, display, distribute,
+ * execute, and transmit the Software, and to prepare derivative works of the
+ * Software, and to permit third-parties to whom the Software is furnished to
+ * do so, all subject to the following:
+ *
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ******************************************************************************/
+
+#ifndef SIMTRACE_PUBLIC_H
+#define SIMTRACE_PUBLIC_H
+
+#include "Ifx_Types.h"
+
+/** \brief Register accesses of one core */
+typedef struct
+{
+  uint64 reads;
+  uint64 writes;
+  uint64 rmw;     /**< \brief writes directly after a read of the same register */
+} SIMTRACE_Stats;
+
+/** \brief Start tracing the register accesses of the firmware.
+ * Every access is written as one line "time core site R|W|M address value",
+ * time in ns, site the address of the accessing instruction in the
+ * simulator, M a write which completes a read-modify-write. Tools/sfr_report.py
+ * resolves the sites and registers.
+ *
+ * \param path trace file
+ * \return TRUE if the file could be created
+ *
+ *  \ingroup SimTrace
+ */
+extern boolean SIMTRACE_Open(const char *path);
+
+/** \brief Record an access, called by the core model with the lock held.
+ *
+ * \param address word address of the register
+ * \param write TRUE for a write
+ * \param value register word after a read, written word after a write
+ * \param site address of the accessing instruction
+ * \return None
+ *
+ *  \ingroup SimTrace
+ */
+extern void SIMTRACE_Access(uint32 address, boolean write, uint32 value, uint64 site);
+
+/** \brief Copy the access counts of a core.
+ *
+ * \param core core index
+ * \param stats receives the counts
+ * \return FALSE if tracing is off
+ *
+ *  \ingroup SimTrace
+ */
+extern boolean SIMTRACE_GetStats(uint32 core, SIMTRACE_Stats *stats);
+
+#endif	/* end of file */
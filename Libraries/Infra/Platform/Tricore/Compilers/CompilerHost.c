@@ -0,0 +1,102 @@
+/**
+ * \file CompilerHost.c
+ *
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or 
+ * the company in which ordinary course of business you are acting and (ii) 
+ * Infineon Technologies AG or its licensees. If and as long as no such 
+ * terms of use are agreed, use of this file is subject to following:
+
+
+ * Boost Software License - Version 1.0 - August 17th, 2003
+
+ * Permission is hereby granted, free of charge, to any person or 
+ * organization obtaining a copy of the software and accompanying 
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the 
+ * Software is furnished to do so, all subject to the following:
+
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE 
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+
+ *
+ */
+
+#include "Cpu/Std/Ifx_Types.h"
+#include "Compilers.h"
+
+#if defined(__HOST__)
+
+void (*IfxCompiler_hostVectors[IFXCOMPILER_HOST_VECTABS][256])(void);
+
+_Thread_local unsigned int IfxCompiler_hostCore;
+
+_Thread_local unsigned int IfxCompiler_hostDataReg[16];
+
+_Thread_local void *IfxCompiler_hostAddrReg[16];
+
+#ifndef IFX_CFG_USE_COMPILER_DEFAULT_LINKER
+
+/* Sizes of the memory which the linker script reserves on the target */
+#define IFXCOMPILER_HOST_STACK_SIZE 0x1000
+#define IFXCOMPILER_HOST_CSA_SIZE   0x4000 /* 256 contexts */
+#define IFXCOMPILER_HOST_TABLE_SIZE 0x2000
+
+#define IFXCOMPILER_HOST_STR_(x) #x
+#define IFXCOMPILER_HOST_STR(x)  IFXCOMPILER_HOST_STR_(x)
+
+/* C has no symbol arithmetic, the begin and end symbols of a region are set
+ * with the assembler like the linker script does on the target. */
+#define IFXCOMPILER_HOST_REGION(mem, begin, end, size)                                  \
+    unsigned int mem[(size) / sizeof(unsigned int)] IFX_ALIGN(64);                      \
+    __asm__ (".globl " #begin "\n\t.set " #begin ", " #mem "\n\t"                       \
+             ".globl " #end "\n\t.set " #end ", " #mem " + " IFXCOMPILER_HOST_STR(size))
+
+#define IFXCOMPILER_HOST_CORE_SYMBOLS(cpu)                                                   \
+    IFXCOMPILER_HOST_REGION(IfxCompiler_hostUstack##cpu, __USTACK##cpu##_BEGIN, __USTACK##cpu, \
+                            IFXCOMPILER_HOST_STACK_SIZE);                                    \
+    IFXCOMPILER_HOST_REGION(IfxCompiler_hostIstack##cpu, __ISTACK##cpu##_BEGIN, __ISTACK##cpu, \
+                            IFXCOMPILER_HOST_STACK_SIZE);                                    \
+    IFXCOMPILER_HOST_REGION(IfxCompiler_hostCsa##cpu, __CSA##cpu, __CSA##cpu##_END,           \
+                            IFXCOMPILER_HOST_CSA_SIZE);                                      \
+    unsigned int __INTTAB_CPU##cpu[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)] IFX_ALIGN(256); \
+    unsigned int __TRAPTAB_CPU##cpu[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)] IFX_ALIGN(256)
+
+IFXCOMPILER_HOST_CORE_SYMBOLS(0);
+IFXCOMPILER_HOST_CORE_SYMBOLS(1);
+IFXCOMPILER_HOST_CORE_SYMBOLS(2);
+
+/* the small data areas addressed relative to A0, A1, A8 and A9 */
+unsigned int __A0_MEM[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)];
+unsigned int __A1_MEM[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)];
+unsigned int __A8_MEM[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)];
+unsigned int __A9_MEM[IFXCOMPILER_HOST_TABLE_SIZE / sizeof(unsigned int)];
+
+#endif /*IFX_CFG_USE_COMPILER_DEFAULT_LINKER*/
+
+/*!
+ * \brief The C runtime of the host has initialised the data sections before main().
+ */
+void Ifx_C_Init(void)
+{}
+
+
+#endif
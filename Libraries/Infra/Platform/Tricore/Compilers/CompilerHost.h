@@ -0,0 +1,184 @@
+/**
+ * \file CompilerHost.h
+ *
+ * \version iLLD_New
+ * \copyright Copyright (c) 2013 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or 
+ * the company in which ordinary course of business you are acting and (ii) 
+ * Infineon Technologies AG or its licensees. If and as long as no such 
+ * terms of use are agreed, use of this file is subject to following:
+
+
+ * Boost Software License - Version 1.0 - August 17th, 2003
+
+ * Permission is hereby granted, free of charge, to any person or 
+ * organization obtaining a copy of the software and accompanying 
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the 
+ * Software is furnished to do so, all subject to the following:
+
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE 
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+
+ *
+ */
+
+#ifndef COMPILERHOST_H
+#define COMPILERHOST_H 1
+
+/******************************************************************************/
+
+/* Host build: the sources are compiled with the native gcc or clang of a Linux
+ * workstation and run against the peripheral models in Host/. Selected with
+ * __HOST__, the 32 bit integer types are mapped onto int in Platform_Types.h.
+ */
+
+#include <stddef.h>
+
+/******************************************************************************/
+#ifndef IFX_INLINE
+#define IFX_INLINE         static inline __attribute__ ((always_inline))            /*Makes the function always inlined */
+#endif
+
+#define IFX_PACKED         __attribute__ ((packed))
+
+#define COMPILER_NAME      "HOST"
+#define COMPILER_VERSION   __VERSION__
+
+#define COMPILER_REVISION  0
+
+#define IFX_INTERRUPT_FAST IFX_INTERRUPT
+
+/* TriCore assembly statements like __asm("rfe") have no meaning on the host,
+ * the instructions used through the intrinsics are emulated in IfxCpu_IntrinsicsHost.h */
+#define __asm(...) ((void)0)
+
+/** \brief Number of interrupt vector tables of the host build */
+#define IFXCOMPILER_HOST_VECTABS 6
+
+/** \brief Interrupt vector tables of the host build, indexed by vectabNum and priority */
+IFX_EXTERN void (*IfxCompiler_hostVectors[IFXCOMPILER_HOST_VECTABS][256])(void);
+
+/** \brief Index of the emulated core which runs the calling thread */
+IFX_EXTERN _Thread_local unsigned int IfxCompiler_hostCore;
+
+/** \brief Emulated data registers D0..D15 of the calling thread, see Ifx__moveToDataParam0() */
+IFX_EXTERN _Thread_local unsigned int IfxCompiler_hostDataReg[16];
+
+/** \brief Emulated address registers A0..A15 of the calling thread, see Ifx__setareg() */
+IFX_EXTERN _Thread_local void *IfxCompiler_hostAddrReg[16];
+
+/*Linker definitions which are specific to the host */
+/* IFX_CFG_USE_COMPILER_DEFAULT_LINKER shall be defined in Ifx_Cfg.h
+ * to use the default compiler linker varaibles and startup */
+#ifndef IFX_CFG_USE_COMPILER_DEFAULT_LINKER
+
+/*Start: Common definitions ********************************************** */
+/* The symbols are defined in CompilerHost.c, they are plain memory of the
+ * host process: the stacks and context save areas are only written by the
+ * start-up code, the threads run on the stacks of the host. */
+#define IFXCOMPILER_COMMON_LINKER_SYMBOLS()                                   \
+    extern unsigned int __A0_MEM[];     /**< center of A0 addressable area */ \
+    extern unsigned int __A1_MEM[];     /**< center of A1 addressable area */ \
+    extern unsigned int __A8_MEM[];     /**< center of A8 addressable area */ \
+    extern unsigned int __A9_MEM[];     /**< center of A9 addressable area */
+
+/*End: Common definitions ************************************************ */
+
+/*Start: Core 0 definitions ********************************************** */
+
+/*C extern defintions */
+#define IFXCOMPILER_CORE_LINKER_SYMBOLS(cpu)                                    \
+    extern unsigned int __USTACK##cpu[];      /**< user stack end */            \
+    extern unsigned int __ISTACK##cpu[];      /**< interrupt stack end */       \
+    extern unsigned int __INTTAB_CPU##cpu[];  /**< Interrupt vector table */    \
+    extern unsigned int __TRAPTAB_CPU##cpu[]; /**< trap table */                \
+    extern unsigned int __CSA##cpu[];         /**< context save area 1 begin */ \
+    extern unsigned int __CSA##cpu##_END[];   /**< context save area 1 begin */
+
+#define __USTACK(cpu)      __USTACK##cpu
+#define __ISTACK(cpu)      __ISTACK##cpu
+#define __INTTAB_CPU(cpu)  __INTTAB_CPU##cpu
+#define __TRAPTAB_CPU(cpu) __TRAPTAB_CPU##cpu
+#define __CSA(cpu)         __CSA##cpu
+#define __CSA_END(cpu)     __CSA##cpu##_END
+#define __INTTAB(cpu)      __INTTAB_CPU##cpu
+#define __TRAPTAB(cpu)     __TRAPTAB_CPU##cpu
+
+#define __SDATA1(cpu)      __A0_MEM
+#define __SDATA2(cpu)      __A1_MEM
+#define __SDATA3(cpu)      __A8_MEM
+#define __SDATA4(cpu)      __A9_MEM
+
+#endif /*IFX_CFG_USE_COMPILER_DEFAULT_LINKER*/
+
+/* *INDENT-OFF* */
+#ifndef IFX_INTERRUPT
+#define IFX_INTERRUPT(isr, vectabNum, prio) IFX_INTERRUPT_INTERNAL(isr, vectabNum, prio)
+#endif
+
+/* There is no vector table to link, a constructor enters the handler into
+ * IfxCompiler_hostVectors before main(). The interrupt router of the host
+ * models calls it with the priority of the service request. */
+#ifndef IFX_INTERRUPT_INTERNAL
+#define IFX_INTERRUPT_INTERNAL(isr, vectabNum, prio)                         \
+IFX_EXTERN void isr(void);                                                   \
+static void __attribute__ ((constructor)) isr##_hostVector(void)            \
+{                                                                            \
+    IfxCompiler_hostVectors[(vectabNum)][(prio)] = isr;                      \
+}                                                                            \
+void isr (void)
+#endif /* IFX_INTERRUPT_INTERNAL */
+
+/* *INDENT-ON* */
+
+/******************************************************************************/
+
+#define IFX_ALIGN(n) __attribute__ ((aligned(n)))
+
+/******************************************************************************/
+/*Memory qualifiers*/
+#ifndef IFX_FAR_ABS
+#define IFX_FAR_ABS
+#endif
+
+#ifndef IFX_NEAR_ABS
+#define IFX_NEAR_ABS
+#endif
+
+#ifndef IFX_REL_A0
+#define IFX_REL_A0
+#endif
+
+#ifndef IFX_REL_A1
+#define IFX_REL_A1
+#endif
+
+#ifndef IFX_REL_A8
+#define IFX_REL_A8
+#endif
+
+#ifndef IFX_REL_A9
+#define IFX_REL_A9
+#endif
+/******************************************************************************/
+
+#endif /* COMPILERHOST_H */
@@ -93,6 +93,9 @@
 #elif defined(__MSVC__)
 #include "CompilerMsvc.h"
 
+#elif defined(__HOST__)
+#include "CompilerHost.h"
+
 #else
 
 /** \addtogroup IfxLld_Cpu_Std_Interrupt
@@ -131,6 +134,10 @@
 #define BEGIN_DATA_SECTION(sec) DATA_SECTION(section #sec WX)
 #define DATA_SECTION(sec) _Pragma(#sec)
 #define END_DATA_SECTION DATA_SECTION(section DATA X)
+#elif defined(__HOST__)
+#define BEGIN_DATA_SECTION(sec)
+#define DATA_SECTION(sec)
+#define END_DATA_SECTION
 #else
 #error "Please specify compiler."
 #endif
@@ -63,6 +63,10 @@
 #define Ifx_Strict_16Bit volatile unsigned short
 #define Ifx_Strict_32Bit volatile unsigned int
 #endif
+#if defined(__HOST__)
+#define Ifx_Strict_16Bit volatile unsigned short
+#define Ifx_Strict_32Bit volatile unsigned int
+#endif
 
 /*Backward Compatibility Macros for VADC registers*/
 #define Ifx_VADC_RES	Ifx_VADC_G_RES
@@ -64,6 +64,9 @@
 #include "Cpu/Std/Ifx_Types.h"
 #include "Tricore/Compilers/Compilers.h"
 #include "Cpu/Std/IfxCpu_Intrinsics.h"
+#ifdef IFX_CFG_EXTEND_CSTART_HOOKS
+#include "Ifx_Cfg_CStart.h"
+#endif
 
 /******************************************************************************/
 /*                           Macros                                           */
@@ -109,6 +109,14 @@
 /*------------------------------Type Definitions------------------------------*/
 /******************************************************************************/
 
+#if defined(__HOST__)
+/* The cores are threads on the host, the plain stores which release a lock
+ * have to be atomic like the swap which takes it.
+ */
+typedef _Atomic unsigned int IfxCpu_spinLock;
+typedef _Atomic unsigned int IfxCpu_mutexLock;
+typedef _Atomic unsigned int IfxCpu_syncEvent;
+#else
 /** \brief Lock type Spin lock
  */
 typedef unsigned int IfxCpu_spinLock;
@@ -120,6 +128,7 @@ typedef unsigned int IfxCpu_mutexLock;
 /** \brief Event used for synchronisation.
  */
 typedef unsigned int IfxCpu_syncEvent;
+#endif
 
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
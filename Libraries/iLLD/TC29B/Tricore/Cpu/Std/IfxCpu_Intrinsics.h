@@ -61,6 +61,9 @@
 #elif defined(__ghs__)
 #include "IfxCpu_IntrinsicsGhs.h"
 
+#elif defined(__HOST__)
+#include "IfxCpu_IntrinsicsHost.h"
+
 #else
 #error Compiler unsupported
 #endif
@@ -0,0 +1,2076 @@
+/**
+ * \file IfxCpu_IntrinsicsHost.h
+ *
+ * \version iLLD_New
+ * \copyright Copyright (c) 2019 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or 
+ * the company in which ordinary course of business you are acting and (ii) 
+ * Infineon Technologies AG or its licensees. If and as long as no such 
+ * terms of use are agreed, use of this file is subject to following:
+
+
+ * Boost Software License - Version 1.0 - August 17th, 2003
+
+ * Permission is hereby granted, free of charge, to any person or 
+ * organization obtaining a copy of the software and accompanying 
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the 
+ * Software is furnished to do so, all subject to the following:
+
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE 
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+
+ *
+ * \defgroup IfxLld_Cpu_Intrinsics_Host Intrinsics for the host build
+ * \ingroup IfxLld_Cpu_Intrinsics
+ *
+ * The TriCore instructions are emulated in portable C: C11 atomics for the
+ * read-modify-write instructions and fences for DSYNC/ISYNC. The core SFRs
+ * are read and written at their memory mapped address, see Host/.
+ *
+ */
+
+#ifndef IFXCPU_INTRINSICSHOST_H
+#define IFXCPU_INTRINSICSHOST_H
+
+/******************************************************************************/
+#include "Ifx_Types.h"
+#include <math.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+/******************************************************************************/
+/* *INDENT-OFF* */
+#define STRINGIFY(x)    #x
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_call Calls and register parameters
+ * The data and address registers of the TriCore calling convention are
+ * emulated per thread in IfxCompiler_hostDataReg and IfxCompiler_hostAddrReg.
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Function call without return
+ */
+#define Ifx__non_return_call(fun) do { ((void (*)(void))(fun))(); __builtin_unreachable(); } while (0)
+
+/** Jump and link
+ */
+IFX_INLINE void Ifx__jump_and_link(void (*fun)(void))
+{
+    fun();
+}
+
+IFX_INLINE void Ifx__moveToDataParam0(unsigned int var)
+{
+    IfxCompiler_hostDataReg[4] = var;
+}
+
+IFX_INLINE void Ifx__moveToDataParamRet(unsigned int var)
+{
+    IfxCompiler_hostDataReg[2] = var;
+}
+
+IFX_INLINE unsigned int Ifx__getDataParamRet(void)
+{
+    return IfxCompiler_hostDataReg[2];
+}
+
+IFX_INLINE void Ifx__moveToAddrParam0(const void *var)
+{
+    IfxCompiler_hostAddrReg[4] = (void *)var;
+}
+
+IFX_INLINE void Ifx__jumpToFunction(const void *fun)
+{
+    Ifx__non_return_call(fun);
+}
+
+IFX_INLINE void Ifx__jumpToFunctionWithLink(const void *fun)
+{
+    Ifx__jump_and_link((void (*)(void))fun);
+}
+
+/** There is no return address register on the host, the caller returns by itself
+ */
+IFX_INLINE void Ifx__jumpBackToLink(void)
+{}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_any_type Cross type arithmetic operation
+ *
+ * Macro compatible with float, fix point, signed integer and unsigned integer
+ *
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+#define Ifx__minX(X,Y)                     ( ((X) < (Y)) ? (X) : (Y) )
+#define Ifx__maxX(X,Y)                     ( ((X) > (Y)) ? (X) : (Y) )
+#define Ifx__saturateX(X,Min,Max)          ( Ifx__minX(Ifx__maxX(X, Min), Max) )
+#define Ifx__checkrangeX(X,Min,Max)        (((X) >= (Min)) && ((X) <= (Max)))
+/** \} */
+
+#define Ifx__saturate(X,Min,Max)           ( Ifx__min(Ifx__max(X, Min), Max) )
+#define Ifx__saturateu(X,Min,Max)          ( Ifx__minu(Ifx__maxu(X, Min), Max) )
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostmin_max Minimum and Maximum of (sint16) Integers
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Return maximum of two integers
+ */
+IFX_INLINE sint32 Ifx__max(sint32 a, sint32 b)
+{
+    return (a > b) ? a : b;
+}
+
+/** Return maximum of two sint16
+ */
+IFX_INLINE sint32 Ifx__maxs(sint16 a, sint16 b)
+{
+    return (a > b) ? a : b;
+}
+
+/** Return maximum of two unsigned integers
+ */
+IFX_INLINE uint32 Ifx__maxu(uint32 a, uint32 b)
+{
+    return (a > b) ? a : b;
+}
+
+/** Return minimum of two integers
+ */
+IFX_INLINE sint32 Ifx__min(sint32 a, sint32 b)
+{
+    return (a < b) ? a : b;
+}
+
+/** Return minimum of two sint16
+ */
+IFX_INLINE sint16 Ifx__mins(sint16 a, sint16 b)
+{
+    return (a < b) ? a : b;
+}
+
+/** Return minimum of two unsigned integers
+ */
+IFX_INLINE uint32 Ifx__minu(uint32 a, uint32 b)
+{
+    return (a < b) ? a : b;
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_floating_point Floating point operation
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+#define Ifx__sqrf(X)                       ((X) * (X))
+#define Ifx__sqrtf(X)                      sqrtf(X)
+#define Ifx__checkrange(X,Min,Max)         (((X) >= (Min)) && ((X) <= (Max)))
+
+#define Ifx__roundf(X)                     ((((X) - (sint32)(X)) > 0.5) ? (1 + (sint32)(X)) : ((sint32)(X)))
+#define Ifx__absf(X)                       ( ((X) < 0.0) ? -(X) : (X) )
+#define Ifx__minf(X,Y)                     ( ((X) < (Y)) ? (X) : (Y) )
+#define Ifx__maxf(X,Y)                     ( ((X) > (Y)) ? (X) : (Y) )
+#define Ifx__saturatef(X,Min,Max)          ( Ifx__minf(Ifx__maxf(X, Min), Max) )
+#define Ifx__checkrangef(X,Min,Max)        (((X) >= (Min)) && ((X) <= (Max)))
+
+#define Ifx__abs_stdreal(X)                ( ((X) > 0.0) ? (X) : -(X) )
+#define Ifx__min_stdreal(X,Y)              ( ((X) < (Y)) ? (X) : (Y) )
+#define Ifx__max_stdreal(X,Y)              ( ((X) > (Y)) ? (X) : (Y) )
+#define Ifx__saturate_stdreal(X,Min,Max)   ( Ifx__min_stdreal(Ifx__max_stdreal(X, Min), Max) )
+
+#define Ifx__neqf(X,Y)                     ( ((X) > (Y)) ||  ((X) < (Y)) )     /**< X != Y */
+#define Ifx__leqf(X,Y)                     ( !((X) > (Y)) )     /**< X <= Y */
+#define Ifx__geqf(X,Y)                     ( !((X) < (Y)) )     /**< X >= Y */
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_fractional Fractional Arithmetic Support
+ * fract is Q31, sfract Q15 and laccum Q17.46 like on the TriCore, the results
+ * saturate where the instructions saturate.
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Saturate a 64 bit intermediate result to 32 bit
+ */
+IFX_INLINE sint32 Ifx__sat32(sint64 a)
+{
+    return (a > INT32_MAX) ? INT32_MAX : ((a < INT32_MIN) ? INT32_MIN : (sint32)a);
+}
+
+/** Count the consecutive number of bits that have the same value as bit 15 of an sfract
+ */
+IFX_INLINE sint16 Ifx__clssf(sfract a)
+{
+    sint32 v = (sint32)((uint32)(uint16)a << 16);
+
+    return (sint16)(((v < 0) ? ((~v == 0) ? 32 : __builtin_clz((uint32)~v)) : ((v == 0) ? 32 : __builtin_clz((uint32)v))) - 1);
+}
+
+/** Convert fract to float
+ */
+IFX_INLINE float Ifx__fract_to_float(fract a)
+{
+    return ldexpf((float)a, -31);
+}
+
+/** Convert float to fract
+ */
+IFX_INLINE fract Ifx__float_to_fract(float a)
+{
+    float v = ldexpf(a, 31);
+
+    return (v >= 2147483647.0f) ? INT32_MAX : ((v <= -2147483648.0f) ? INT32_MIN : (fract)v);
+}
+
+/** Convert fract to sfract
+ */
+IFX_INLINE sfract Ifx__fract_to_sfract(fract a)
+{
+    return (sfract)(Ifx__sat32((sint64)a + 0x8000) >> 16);
+}
+
+/** Convert float to sfract
+ */
+IFX_INLINE sfract Ifx__float_to_sfract(float a)
+{
+    fract tmp = Ifx__float_to_fract(a);
+    return Ifx__fract_to_sfract(tmp);
+}
+
+/** Convert laccum to fract
+ */
+IFX_INLINE fract Ifx__getfract(laccum a)
+{
+    return (fract)(uint32)((uint64)a >> 15);
+}
+
+/** Multiply-add with rounding. Returns the rounded result of ( a + b * c )
+ */
+IFX_INLINE sfract Ifx__mac_r_sf(sfract a, sfract b, sfract c)
+{
+    return (sfract)(Ifx__sat32(((sint64)a * 65536) + (((sint64)b * c) * 2) + 0x8000) >> 16);
+}
+
+/** Multiply-add sfract. Returns ( a + b * c )
+ */
+IFX_INLINE sfract Ifx__mac_sf(sfract a, sfract b, sfract c)
+{
+    return (sfract)(Ifx__sat32(((sint64)a * 65536) + (((sint64)b * c) * 2)) >> 16);
+}
+
+/** Integer part of the multiplication of a fract and a fract
+ */
+IFX_INLINE long Ifx__mulfractfract(fract a, fract b)
+{
+    return (long)Ifx__sat32(((sint64)a * b) >> 31);
+}
+
+/** Integer part of the multiplication of a fract and a long
+ */
+IFX_INLINE long Ifx__mulfractlong(fract a, long b)
+{
+    return (long)Ifx__sat32(((sint64)a * (sint32)b) >> 31);
+}
+
+/** Convert fract to sfract
+ */
+IFX_INLINE sfract Ifx__round16(fract a)
+{
+    return Ifx__fract_to_sfract(a);
+}
+
+/** Convert signed sint16 to sfract
+ */
+IFX_INLINE sfract Ifx__s16_to_sfract(sint16 a)
+{
+    return (sfract)a;
+}
+
+/** Convert sfract to sint16
+ */
+IFX_INLINE sint16 Ifx__sfract_to_s16(sfract a)
+{
+    return (sint16)a;
+}
+
+/** Convert sfract to uint16
+ */
+IFX_INLINE uint16 Ifx__sfract_to_u16(sfract a)
+{
+    return (uint16)a;
+}
+
+/** Left/right shift of an laccum
+ */
+IFX_INLINE laccum Ifx__shaaccum(laccum a, sint32 b)
+{
+    return (b >= 0) ? (laccum)((uint64)a << b) : (a >> -b);
+}
+
+/** Left/right shift of an fract
+ */
+IFX_INLINE fract Ifx__shafracts(fract a, sint32 b)
+{
+    return (b >= 0) ? Ifx__sat32((sint64)a << b) : (a >> -b);
+}
+
+/** Left/right shift of an sfract
+ */
+IFX_INLINE sfract Ifx__shasfracts(sfract a, sint32 b)
+{
+    sint32 v = (b >= 0) ? Ifx__sat32((sint64)a << b) : (a >> -b);
+
+    return (sfract)((v > INT16_MAX) ? INT16_MAX : ((v < INT16_MIN) ? INT16_MIN : v));
+}
+
+/** Convert uint16 to sfract
+ */
+IFX_INLINE sfract Ifx__u16_to_sfract(uint16 a)
+{
+    return (sfract)a;
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostinsert Insert / Extract Bit-fields and Bits
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Extract a bit-field (bit pos to bit pos+width) from value
+ */
+IFX_INLINE sint32 Ifx__extr(sint32 a, uint32 p, uint32 w)
+{
+    if (w == 0)
+    {
+        return 0;
+    }
+    return (sint32)((uint32)a << (32u - p - w)) >> (32u - w);
+}
+
+/** Same as __extr() but return bit-field as unsigned integer
+ */
+IFX_INLINE uint32 Ifx__extru(uint32 a, uint32 p, uint32 w)
+{
+    return (w == 0) ? 0u : ((a << (32u - p - w)) >> (32u - w));
+}
+
+/** Load a single bit.
+ */
+#define Ifx__getbit(address, bitoffset) ((*(address) & (1U << (bitoffset))) != 0)
+
+/** Insert LDMST instruction, atomic load-modify-store of the bits set in mask.
+ */
+IFX_INLINE void Ifx__ldmst(volatile void* address, uint32 mask, uint32 value)
+{
+    volatile _Atomic uint32 *word = (volatile _Atomic uint32 *)address;
+    uint32 old = atomic_load(word);
+
+    while (!atomic_compare_exchange_weak(word, &old, (old & ~mask) | (value & mask)))
+    {}
+}
+
+/** Atomic load-modify-store.
+ */
+#define Ifx__imaskldmst(address, value, bitoffset, bits) \
+    Ifx__ldmst((address), ((1u << (bits)) - 1u) << (bitoffset), (uint32)(value) << (bitoffset))
+
+/** Return trg but replace trgbit by srcbit in src.
+ */
+IFX_INLINE sint32 Ifx__ins(sint32 trg, const sint32 trgbit, sint32 src, const sint32 srcbit)
+{
+    uint32 bit = ((uint32)src >> srcbit) & 1u;
+    return (sint32)(((uint32)trg & ~(1u << trgbit)) | (bit << trgbit));
+}
+
+/** Extract bit-field (width bits starting at bit 0) from src and insert it in trg at pos.
+ */
+IFX_INLINE sint32 Ifx__insert(sint32 a, sint32 b, sint32 p, const sint32 w)
+{
+    uint32 mask = ((w >= 32) ? 0xFFFFFFFFu : ((1u << w) - 1u)) << p;
+    return (sint32)(((uint32)a & ~mask) | (((uint32)b << p) & mask));
+}
+
+/** Return trg but replace trgbit by inverse of srcbit in src.
+ */
+IFX_INLINE sint32 Ifx__insn(sint32 trg, const sint32 trgbit, sint32 src, const sint32 srcbit)
+{
+    return Ifx__ins(trg, trgbit, ~src, srcbit);
+}
+
+/** Store a single bit.
+ */
+#define Ifx__putbit(value,address,bitoffset ) Ifx__imaskldmst(address, value, bitoffset,1)
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostcore_sfr Core SFR access
+ * The core SFRs of core n are mapped at 0xF8810000 + n * 0x20000 like on the
+ * device, the emulated core of the calling thread is IfxCompiler_hostCore.
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Address of a core SFR of the calling core
+ */
+#define IFXCPU_HOST_CSFR(regaddr) \
+    ((volatile uint32 *)(uintptr_t)(0xF8810000u + (IfxCompiler_hostCore * 0x20000u) + (uint32)(regaddr)))
+
+/** Interrupt enable bit of ICR
+ */
+#define IFXCPU_HOST_ICR_IE (1u << 15)
+
+/** Offset of CORE_ID
+ */
+#define IFXCPU_HOST_CORE_ID 0xFE1Cu
+
+/**  Move contents of the addressed core SFR into a data register. CORE_ID is
+ * the core of the thread, it is read without trapping into the simulator.
+ */
+#define Ifx__mfcr(regaddr)                                    \
+    (((uint32)(regaddr) == IFXCPU_HOST_CORE_ID) ? (sint32)IfxCompiler_hostCore \
+     : (sint32)*IFXCPU_HOST_CSFR(regaddr))
+
+/**  Move contents of a data register (second int) to the addressed core SFR (first int)
+ */
+#define Ifx__mtcr(regaddr,val) (*IFXCPU_HOST_CSFR(regaddr) = (uint32)(val))
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostinterrupt_handling Interrupt Handling
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Set CPU priority number and enable interrupts
+ */
+#define Ifx__bisr(intlvl) \
+    (*IFXCPU_HOST_CSFR(0xFE2C) = (*IFXCPU_HOST_CSFR(0xFE2C) & ~0xFFu) | ((uint32)(intlvl) & 0xFFu) | IFXCPU_HOST_ICR_IE)
+
+/** Disable interrupts
+ */
+#define Ifx__disable() (*IFXCPU_HOST_CSFR(0xFE2C) &= ~IFXCPU_HOST_ICR_IE)
+
+/** Disable interrupts and return previous interrupt state (enabled or disabled)
+ */
+IFX_INLINE sint32 Ifx__disable_and_save(void)
+{
+    uint32 icr = *IFXCPU_HOST_CSFR(0xFE2C);
+
+    *IFXCPU_HOST_CSFR(0xFE2C) = icr & ~IFXCPU_HOST_ICR_IE;
+    return (sint32)((icr & IFXCPU_HOST_ICR_IE) != 0);
+}
+
+/** Enable interrupts
+ */
+#define Ifx__enable() (*IFXCPU_HOST_CSFR(0xFE2C) |= IFXCPU_HOST_ICR_IE)
+
+/** Restore interrupt state
+ */
+IFX_INLINE void Ifx__restore(sint32 ie)
+{
+    uint32 icr = *IFXCPU_HOST_CSFR(0xFE2C);
+
+    *IFXCPU_HOST_CSFR(0xFE2C) = (ie != 0) ? (icr | IFXCPU_HOST_ICR_IE) : (icr & ~IFXCPU_HOST_ICR_IE);
+}
+
+/** Call a system call function number, there is no trap table on the host
+ */
+#define Ifx__syscall(svcno)      ((void)(svcno))
+#define Ifx__tric_syscall(svcno) ((void)(svcno))
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostmiscellaneous Miscellaneous Intrinsic Functions
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** Count leading zeros in int
+ */
+IFX_INLINE sint32 Ifx__clz(sint32 a)
+{
+    return (a == 0) ? 32 : __builtin_clz((uint32)a);
+}
+
+/** Count leading ones in int
+ */
+IFX_INLINE sint32 Ifx__clo(sint32 a)
+{
+    return Ifx__clz(~a);
+}
+
+/** Count number of redundant sign bits (all consecutive bits with the same value as bit 31)
+ */
+IFX_INLINE sint32 Ifx__cls(sint32 a)
+{
+    return ((a < 0) ? Ifx__clo(a) : Ifx__clz(a)) - 1;
+}
+
+/** Count the bits set
+ */
+IFX_INLINE sint32 Ifx__popcnt(sint32 a)
+{
+    return __builtin_popcount((uint32)a);
+}
+
+/**  Write back and invalidate cache address "p", the host has no cache to maintain
+ */
+IFX_INLINE void Ifx__cacheawi(uint8* p)
+{
+    (void)p;
+}
+
+/**  Write back and invalidate cache index "p"
+ */
+IFX_INLINE void Ifx__cacheiwi(uint8* p)
+{
+    (void)p;
+}
+
+/**  Write back and invalidate cache address \"p\" and return post incremented
+ * value of \"p\".
+ */
+IFX_INLINE uint8* Ifx__cacheawi_bo_post_inc(uint8* p)
+{
+    return p;
+}
+
+/**  Invalidate cache address "p"
+ */
+IFX_INLINE void Ifx__cacheai(uint8* p)
+{
+    (void)p;
+}
+
+/** Multiply two 32-bit numbers to an intermediate 64-bit result, and scale
+ * back the result to 32 bits. To scale back the result, 32 bits are extracted
+ * from the intermediate 64-bit result: bit 63-offset to bit 31-offset.
+ */
+IFX_INLINE sint32 Ifx__mulsc(sint32 a, sint32 b, sint32 offset)
+{
+    return (sint32)(uint32)(((uint64)((sint64)a * b) << (offset & 31)) >> 32);
+}
+
+/**  Rotate operand left count times. The bits that are shifted out are inserted at the right side (bit 31 is shifted to bit 0).
+ */
+IFX_INLINE uint32 Ifx__rol(uint32 operand, uint32 count)
+{
+    count &= 31u;
+    return (count == 0) ? operand : ((operand << count) | (operand >> (32u - count)));
+}
+
+/**  Rotate operand right count times. The bits that are shifted out are inserted at the left side (bit 0 is shifted to bit 31).
+ */
+IFX_INLINE uint32 Ifx__ror(uint32 operand, uint32 count)
+{
+    return Ifx__rol(operand, 32u - (count & 31u));
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_packed Packed Data Type Support
+ * Byte n of a __packb is bits 8*(n-1) to 8*n-1, halfword n of a __packhw bits 16*(n-1) to 16*n-1.
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/**  Absolute value of __packb
+ */
+IFX_INLINE __packb Ifx__absb(__packb a)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 8u)
+    {
+        sint8 v = (sint8)((uint32)a >> i);
+        res |= (uint32)(uint8)((v < 0) ? -v : v) << i;
+    }
+    return (__packb)res;
+}
+
+/**  Absolute value of __packhw
+ */
+IFX_INLINE __packhw Ifx__absh(__packhw a)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 16u)
+    {
+        sint16 v = (sint16)((uint32)a >> i);
+        res |= (uint32)(uint16)((v < 0) ? -v : v) << i;
+    }
+    return (__packhw)res;
+}
+
+/**  Absolute value of __packhw using saturation
+ */
+IFX_INLINE __packhw Ifx__abssh(__packhw a)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 16u)
+    {
+        sint32 v = (sint16)((uint32)a >> i);
+        v = (v < 0) ? -v : v;
+        res |= (uint32)(uint16)((v > INT16_MAX) ? INT16_MAX : v) << i;
+    }
+    return (__packhw)res;
+}
+
+/** Extract first byte from a __packb
+ */
+IFX_INLINE sint8 Ifx__extractbyte1(__packb a)
+{
+    return (sint8)((uint32)a >> 0);
+}
+
+/** Extract second byte from a __packb
+ */
+IFX_INLINE sint8 Ifx__extractbyte2(__packb a)
+{
+    return (sint8)((uint32)a >> 8);
+}
+
+/** Extract third byte from a __packb
+ */
+IFX_INLINE sint8 Ifx__extractbyte3(__packb a)
+{
+    return (sint8)((uint32)a >> 16);
+}
+
+/** Extract fourth byte from a __packb
+ */
+IFX_INLINE sint8 Ifx__extractbyte4(__packb a)
+{
+    return (sint8)((uint32)a >> 24);
+}
+
+/** Extract first halfword from a __packhw
+ */
+IFX_INLINE sint16 Ifx__extracthw1(__packhw a)
+{
+    return (sint16)((uint32)a >> 0);
+}
+
+/** Extract second halfword from a __packhw
+ */
+IFX_INLINE sint16 Ifx__extracthw2(__packhw a)
+{
+    return (sint16)((uint32)a >> 16);
+}
+
+/** Extract first byte from a __upackb
+ */
+IFX_INLINE uint8 Ifx__extractubyte1(__upackb a)
+{
+    return (uint8)((uint32)a >> 0);
+}
+
+/** Extract second byte from a __upackb
+ */
+IFX_INLINE uint8 Ifx__extractubyte2(__upackb a)
+{
+    return (uint8)((uint32)a >> 8);
+}
+
+/** Extract third byte from a __upackb
+ */
+IFX_INLINE uint8 Ifx__extractubyte3(__upackb a)
+{
+    return (uint8)((uint32)a >> 16);
+}
+
+/** Extract fourth byte from a __upackb
+ */
+IFX_INLINE uint8 Ifx__extractubyte4(__upackb a)
+{
+    return (uint8)((uint32)a >> 24);
+}
+
+/** Extract first halfword from a __upackhw
+ */
+IFX_INLINE uint16 Ifx__extractuhw1(__upackhw a)
+{
+    return (uint16)((uint32)a >> 0);
+}
+
+/** Extract second halfword from a __upackhw
+ */
+IFX_INLINE uint16 Ifx__extractuhw2(__upackhw a)
+{
+    return (uint16)((uint32)a >> 16);
+}
+
+/**  Extract first byte from a __packb in memory
+ */
+IFX_INLINE sint8 Ifx__getbyte1(__packb* a)
+{
+    return Ifx__extractbyte1(*a);
+}
+
+/**  Extract second byte from a __packb in memory
+ */
+IFX_INLINE sint8 Ifx__getbyte2(__packb* a)
+{
+    return Ifx__extractbyte2(*a);
+}
+
+/**  Extract third byte from a __packb in memory
+ */
+IFX_INLINE sint8 Ifx__getbyte3(__packb* a)
+{
+    return Ifx__extractbyte3(*a);
+}
+
+/**  Extract fourth byte from a __packb in memory
+ */
+IFX_INLINE sint8 Ifx__getbyte4(__packb* a)
+{
+    return Ifx__extractbyte4(*a);
+}
+
+/**  Extract first halfword from a __packhw in memory
+ */
+IFX_INLINE sint16 Ifx__gethw1(__packhw* a)
+{
+    return Ifx__extracthw1(*a);
+}
+
+/**  Extract second halfword from a __packhw in memory
+ */
+IFX_INLINE sint16 Ifx__gethw2(__packhw* a)
+{
+    return Ifx__extracthw2(*a);
+}
+
+/**  Extract first byte from a __upackb in memory
+ */
+IFX_INLINE uint8 Ifx__getubyte1(__upackb* a)
+{
+    return Ifx__extractubyte1(*a);
+}
+
+/**  Extract second byte from a __upackb in memory
+ */
+IFX_INLINE uint8 Ifx__getubyte2(__upackb* a)
+{
+    return Ifx__extractubyte2(*a);
+}
+
+/**  Extract third byte from a __upackb in memory
+ */
+IFX_INLINE uint8 Ifx__getubyte3(__upackb* a)
+{
+    return Ifx__extractubyte3(*a);
+}
+
+/**  Extract fourth byte from a __upackb in memory
+ */
+IFX_INLINE uint8 Ifx__getubyte4(__upackb* a)
+{
+    return Ifx__extractubyte4(*a);
+}
+
+/**  Extract first halfword from a __upackhw in memory
+ */
+IFX_INLINE uint16 Ifx__getuhw1(__upackhw* a)
+{
+    return Ifx__extractuhw1(*a);
+}
+
+/**  Extract second halfword from a __upackhw in memory
+ */
+IFX_INLINE uint16 Ifx__getuhw2(__upackhw* a)
+{
+    return Ifx__extractuhw2(*a);
+}
+
+/**  Initialize  __packb with four integers
+ */
+IFX_INLINE __packb Ifx__initpackb(sint32 a, sint32 b, sint32 c, sint32 d)
+{
+    return (__packb)((uint32)(uint8)a | ((uint32)(uint8)b << 8) | ((uint32)(uint8)c << 16) | ((uint32)(uint8)d << 24));
+}
+
+/** Initialize  __packb with a long integer
+ */
+IFX_INLINE __packb Ifx__initpackbl(long a)
+{
+    return (__packb) a;
+}
+
+/** Initialize  __packhw with two integers
+ */
+IFX_INLINE __packhw Ifx__initpackhw(sint16 a, sint16 b)
+{
+    return (__packhw)((uint32)(uint16)a | ((uint32)(uint16)b << 16));
+}
+
+/**  Initialize  __packhw with a long integer
+ */
+IFX_INLINE __packhw Ifx__initpackhwl(long a)
+{
+    return (__packhw) a;
+}
+
+/** Initialize  __packb with four unsigned integers
+ */
+IFX_INLINE __upackb    Ifx__initupackb( uint32 a, uint32 b, uint32 c, uint32 d)
+{
+    return (__upackb)((a & 0xFFu) | ((b & 0xFFu) << 8) | ((c & 0xFFu) << 16) | ((d & 0xFFu) << 24));
+}
+
+/**  Initialize  __packhw with two unsigned integers
+ */
+IFX_INLINE __upackhw    Ifx__initupackhw( uint16 a, uint16 b)
+{
+    return (__upackhw)((uint32)a | ((uint32)b << 16));
+}
+
+/** Insert sint8 into first byte of a __packb
+ */
+IFX_INLINE __packb Ifx__insertbyte1(__packb a, sint8 b)
+{
+    return (__packb)(((uint32)a & ~(0xFFu << 0)) | ((uint32)(uint8)b << 0));
+}
+
+/** Insert sint8 into second byte of a __packb
+ */
+IFX_INLINE __packb Ifx__insertbyte2(__packb a, sint8 b)
+{
+    return (__packb)(((uint32)a & ~(0xFFu << 8)) | ((uint32)(uint8)b << 8));
+}
+
+/** Insert sint8 into third byte of a __packb
+ */
+IFX_INLINE __packb Ifx__insertbyte3(__packb a, sint8 b)
+{
+    return (__packb)(((uint32)a & ~(0xFFu << 16)) | ((uint32)(uint8)b << 16));
+}
+
+/** Insert sint8 into fourth byte of a __packb
+ */
+IFX_INLINE __packb Ifx__insertbyte4(__packb a, sint8 b)
+{
+    return (__packb)(((uint32)a & ~(0xFFu << 24)) | ((uint32)(uint8)b << 24));
+}
+
+/** Insert uint8 into first byte of a __upackb
+ */
+IFX_INLINE __upackb Ifx__insertubyte1(__upackb a, uint8 b)
+{
+    return (__upackb)(((uint32)a & ~(0xFFu << 0)) | ((uint32)(uint8)b << 0));
+}
+
+/** Insert uint8 into second byte of a __upackb
+ */
+IFX_INLINE __upackb Ifx__insertubyte2(__upackb a, uint8 b)
+{
+    return (__upackb)(((uint32)a & ~(0xFFu << 8)) | ((uint32)(uint8)b << 8));
+}
+
+/** Insert uint8 into third byte of a __upackb
+ */
+IFX_INLINE __upackb Ifx__insertubyte3(__upackb a, uint8 b)
+{
+    return (__upackb)(((uint32)a & ~(0xFFu << 16)) | ((uint32)(uint8)b << 16));
+}
+
+/** Insert uint8 into fourth byte of a __upackb
+ */
+IFX_INLINE __upackb Ifx__insertubyte4(__upackb a, uint8 b)
+{
+    return (__upackb)(((uint32)a & ~(0xFFu << 24)) | ((uint32)(uint8)b << 24));
+}
+
+/** Insert sint16 into first halfword of a __packhw
+ */
+IFX_INLINE __packhw Ifx__inserthw1(__packhw a, sint16 b)
+{
+    return (__packhw)(((uint32)a & ~(0xFFFFu << 0)) | ((uint32)(uint16)b << 0));
+}
+
+/** Insert sint16 into second halfword of a __packhw
+ */
+IFX_INLINE __packhw Ifx__inserthw2(__packhw a, sint16 b)
+{
+    return (__packhw)(((uint32)a & ~(0xFFFFu << 16)) | ((uint32)(uint16)b << 16));
+}
+
+/** Insert uint16 into first halfword of a __upackhw
+ */
+IFX_INLINE __upackhw Ifx__insertuhw1(__upackhw a, uint16 b)
+{
+    return (__upackhw)(((uint32)a & ~(0xFFFFu << 0)) | ((uint32)(uint16)b << 0));
+}
+
+/** Insert uint16 into second halfword of a __upackhw
+ */
+IFX_INLINE __upackhw Ifx__insertuhw2(__upackhw a, uint16 b)
+{
+    return (__upackhw)(((uint32)a & ~(0xFFFFu << 16)) | ((uint32)(uint16)b << 16));
+}
+
+/**  Minimum of two  __packb values
+ */
+IFX_INLINE __packb Ifx__minb(__packb a, __packb b)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 8u)
+    {
+        sint8 x = (sint8)((uint32)a >> i);
+        sint8 y = (sint8)((uint32)b >> i);
+        res |= (uint32)(uint8)((x < y) ? x : y) << i;
+    }
+    return (__packb)res;
+}
+
+/**  Minimum of two __upackb  values
+ */
+IFX_INLINE __upackb     Ifx__minbu( __upackb  a, __upackb  b)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 8u)
+    {
+        uint8 x = (uint8)((uint32)a >> i);
+        uint8 y = (uint8)((uint32)b >> i);
+        res |= (uint32)((x < y) ? x : y) << i;
+    }
+    return (__upackb)res;
+}
+
+/**  Minimum of two  __packhw values
+ */
+IFX_INLINE __packhw Ifx__minh(__packhw a, __packhw b)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 16u)
+    {
+        sint16 x = (sint16)((uint32)a >> i);
+        sint16 y = (sint16)((uint32)b >> i);
+        res |= (uint32)(uint16)((x < y) ? x : y) << i;
+    }
+    return (__packhw)res;
+}
+
+/**  Minimum of two __upackhw values
+ */
+IFX_INLINE __upackhw    Ifx__minhu( __upackhw a, __upackhw b)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 16u)
+    {
+        uint16 x = (uint16)((uint32)a >> i);
+        uint16 y = (uint16)((uint32)b >> i);
+        res |= (uint32)((x < y) ? x : y) << i;
+    }
+    return (__upackhw)res;
+}
+
+/**  Insert sint8 into first byte of a __packb in memory
+ */
+IFX_INLINE void Ifx__setbyte1(__packb* a, sint8 b)
+{
+    *a = Ifx__insertbyte1(*a, b);
+}
+
+/**  Insert sint8 into second byte of a __packb in memory
+ */
+IFX_INLINE void Ifx__setbyte2(__packb* a, sint8 b)
+{
+    *a = Ifx__insertbyte2(*a, b);
+}
+
+/**  Insert sint8 into third byte of a __packb in memory
+ */
+IFX_INLINE void Ifx__setbyte3(__packb* a, sint8 b)
+{
+    *a = Ifx__insertbyte3(*a, b);
+}
+
+/**  Insert sint8 into fourth byte of a __packb in memory
+ */
+IFX_INLINE void Ifx__setbyte4(__packb* a, sint8 b)
+{
+    *a = Ifx__insertbyte4(*a, b);
+}
+
+/**  Insert sint16 into first halfword of a __packhw in memory
+ */
+IFX_INLINE void Ifx__sethw1(__packhw* a, sint16 b)
+{
+    *a = Ifx__inserthw1(*a, b);
+}
+
+/**  Insert sint16 into second halfword of a __packhw in memory
+ */
+IFX_INLINE void Ifx__sethw2(__packhw* a, sint16 b)
+{
+    *a = Ifx__inserthw2(*a, b);
+}
+
+/**  Insert uint8 into first byte of a __upackb in memory
+ */
+IFX_INLINE void Ifx__setubyte1(__upackb* a, uint8 b)
+{
+    *a = Ifx__insertubyte1(*a, b);
+}
+
+/**  Insert uint8 into second byte of a __upackb in memory
+ */
+IFX_INLINE void Ifx__setubyte2(__upackb* a, uint8 b)
+{
+    *a = Ifx__insertubyte2(*a, b);
+}
+
+/**  Insert uint8 into third byte of a __upackb in memory
+ */
+IFX_INLINE void Ifx__setubyte3(__upackb* a, uint8 b)
+{
+    *a = Ifx__insertubyte3(*a, b);
+}
+
+/**  Insert uint8 into fourth byte of a __upackb in memory
+ */
+IFX_INLINE void Ifx__setubyte4(__upackb* a, uint8 b)
+{
+    *a = Ifx__insertubyte4(*a, b);
+}
+
+/**  Insert uint16 into first halfword of a __upackhw in memory
+ */
+IFX_INLINE void Ifx__setuhw1(__upackhw* a, uint16 b)
+{
+    *a = Ifx__insertuhw1(*a, b);
+}
+
+/**  Insert uint16 into second halfword of a __upackhw in memory
+ */
+IFX_INLINE void Ifx__setuhw2(__upackhw* a, uint16 b)
+{
+    *a = Ifx__insertuhw2(*a, b);
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_register Register Handling
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/**  Return absolute value
+ */
+#define Ifx__abs(a) __builtin_abs(a)
+
+/** Return absolue difference of two integers
+ */
+IFX_INLINE sint32 Ifx__absdif(sint32 a, sint32 b)
+{
+    return (sint32)((a > b) ? ((uint32)a - (uint32)b) : ((uint32)b - (uint32)a));
+}
+
+/**  Return absolute value with saturation
+ */
+IFX_INLINE sint32 Ifx__abss(sint32 a)
+{
+    return (a == INT32_MIN) ? INT32_MAX : ((a < 0) ? -a : a);
+}
+
+/**  Return absolute double precision floating-point value
+ */
+IFX_INLINE double Ifx__fabs(double d)
+{
+    return fabs(d);
+}
+
+/**  Return absolute floating-point value
+ */
+IFX_INLINE float Ifx__fabsf(float f)
+{
+    return fabsf(f);
+}
+
+/**  Return parity, the parity of byte n of a is in bit 8*n of the result
+ */
+IFX_INLINE sint32 Ifx__parity(sint32 a)
+{
+    uint32 res = 0;
+
+    for (uint32 i = 0; i < 32u; i += 8u)
+    {
+        res |= (uint32)__builtin_parity(((uint32)a >> i) & 0xFFu) << i;
+    }
+    return (sint32)res;
+}
+
+/**  Return saturated byte
+ */
+IFX_INLINE sint8 Ifx__satb(sint32 a)
+{
+    return (sint8)((a > INT8_MAX) ? INT8_MAX : ((a < INT8_MIN) ? INT8_MIN : a));
+}
+
+/**  Return saturated uint8
+ */
+IFX_INLINE uint8 Ifx__satbu(sint32 a)
+{
+    return (uint8)(((uint32)a > UINT8_MAX) ? UINT8_MAX : (uint32)a);
+}
+
+/**  Return saturated halfword
+ */
+IFX_INLINE sint16 Ifx__sath(sint32 a)
+{
+    return (sint16)((a > INT16_MAX) ? INT16_MAX : ((a < INT16_MIN) ? INT16_MIN : a));
+}
+
+/**  Return saturated unsigned halfword
+ */
+IFX_INLINE uint16 Ifx__sathu(sint32 a)
+{
+    return (uint16)(((uint32)a > UINT16_MAX) ? UINT16_MAX : (uint32)a);
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Host_saturation Saturation Arithmetic Support
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** add signed with saturation
+ */
+IFX_INLINE sint32 Ifx__adds(sint32 a, sint32 b)
+{
+    return Ifx__sat32((sint64)a + b);
+}
+
+/** add unsigned with saturation
+ */
+IFX_INLINE uint32 Ifx__addsu(uint32 a, uint32 b)
+{
+    uint32 res = a + b;
+
+    return (res < a) ? UINT32_MAX : res;
+}
+
+/** substract signed with saturation
+ */
+IFX_INLINE sint32 Ifx__subs(sint32 a, sint32 b)
+{
+    return Ifx__sat32((sint64)a - b);
+}
+
+/** substract unsigned with saturation
+ */
+IFX_INLINE uint32 Ifx__subsu(uint32 a, uint32 b)
+{
+    return (a > b) ? (a - b) : 0u;
+}
+
+/** \} */
+
+/** \defgroup IfxLld_Cpu_Intrinsics_Hostsingle_assembly Insert Single Assembly Instruction
+ * \ingroup IfxLld_Cpu_Intrinsics_Host
+ * \{
+ */
+
+/** DEBUG instruction, there is no debugger to halt
+ */
+IFX_INLINE void Ifx__debug(void)
+{}
+
+/** Insert a memory barrier
+ */
+#define Ifx__mem_barrier atomic_signal_fence(memory_order_seq_cst);
+
+/** DSYNC instruction, all data accesses complete before the next one.
+ * A full barrier, the builtin is also supported by ThreadSanitizer.
+ */
+IFX_INLINE void Ifx__dsync(void)
+{
+    __sync_synchronize();
+}
+
+/** ISYNC instruction
+ */
+IFX_INLINE void Ifx__isync(void)
+{
+    __sync_synchronize();
+}
+
+/** NOP instruction
+ */
+IFX_INLINE void Ifx__nop(void)
+{
+    atomic_signal_fence(memory_order_seq_cst);
+}
+
+/** Loop over cnt NOP instructions
+ */
+IFX_INLINE void Ifx__nops(void* cnt)
+{
+    for (uintptr_t i = (uintptr_t)cnt; i > 0; i--)
+    {
+        Ifx__nop();
+    }
+}
+
+/** RSLCX / SVLCX instructions, the host keeps the contexts on its stack
+ */
+IFX_INLINE void Ifx__rslcx(void)
+{}
+
+IFX_INLINE void Ifx__svlcx(void)
+{}
+
+/** SWAP instruction, atomic exchange
+ */
+IFX_INLINE uint32 Ifx__swap(void* place, uint32 value)
+{
+    return atomic_exchange((volatile _Atomic uint32 *)place, value);
+}
+
+/** Insert n NOP instructions
+ */
+#define Ifx__NOP(n) Ifx__nops((void *)(uintptr_t)(n))
+
+/** \} */
+
+/** Index of the emulated address registers used with Ifx__setareg
+ */
+#define IFXCPU_HOST_AREG_a0  0
+#define IFXCPU_HOST_AREG_a1  1
+#define IFXCPU_HOST_AREG_a8  8
+#define IFXCPU_HOST_AREG_a9  9
+#define IFXCPU_HOST_AREG_sp  10
+#define IFXCPU_HOST_AREG_a10 10
+#define IFXCPU_HOST_AREG_a11 11
+
+/** Load an address register, the host stores it in the emulated register of the thread
+ */
+#define Ifx__setareg(areg,val) \
+    { IfxCompiler_hostAddrReg[IFXCPU_HOST_AREG_##areg] = (void *)(uintptr_t)(val); }
+
+/** Stop the performance counters, __mtcr (CPU_CCTRL, 0)
+ */
+IFX_INLINE void Ifx__stopPerfCounters(void)
+{
+    Ifx__mtcr(0xFC00, 0);
+}
+
+/** \brief This function is a implementation of a binary semaphore using compare and swap instruction
+ * \param address address of resource.
+ * \param value This variable is updated with status of address
+ * \param condition if the value of address matches with the value of condition, then swap of value & address occurs.
+ * \return the previous value of address
+ */
+IFX_INLINE unsigned int Ifx__cmpAndSwap (unsigned int volatile *address,
+           unsigned int value, unsigned int condition)
+{
+    unsigned int expected = condition;
+
+    (void)atomic_compare_exchange_strong((volatile _Atomic unsigned int *)address, &expected, value);
+    return expected;
+}
+
+/** Pseudo random value, (a * x) mod m
+ */
+IFX_INLINE uint32 IfxCpu_getRandomVal(uint32 a, uint32 x, uint32 m)
+{
+    return (uint32)(((uint64)a * x) % m);
+}
+
+/** Return address register A11 of the caller
+ */
+IFX_INLINE void* Ifx__getA11(void)
+{
+    return __builtin_return_address(0);
+}
+
+/** The host thread keeps its own stack, the new stack pointer is only recorded in A10
+ */
+IFX_INLINE void Ifx__setStackPointer(void *stackAddr)
+{
+    IfxCompiler_hostAddrReg[10] = stackAddr;
+}
+
+/** \brief Convert a fixpoint value to float32
+ *
+ * \param value value to be converted.
+ * \param shift position of the fix point. Range = [-256, 255] => (Qx.y format where x = shift+1).
+ *
+ * \return Returns the converted value in the float32 format.
+ */
+IFX_INLINE float32 Ifx__fixpoint_to_float32(fract value, sint32 shift)
+{
+    return ldexpf((float32)value, shift - 31);
+}
+
+/** CRC32 instruction: CRC-32 (IEEE 802.3, reflected) of the word a, seed b
+ */
+IFX_INLINE uint32 Ifx__crc32(uint32 b, uint32 a)
+{
+    uint32 crc = ~b;
+
+    for (uint32 bit = 0; bit < 32u; bit++)
+    {
+        crc = ((crc ^ (a >> bit)) & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+    }
+    return ~crc;
+}
+
+IFX_INLINE uint32 IfxCpu_calculateCrc32(uint32 *startaddress, uint8 length)
+{
+    uint32 returnvalue = 0; /* set seed value to 0 */
+    for (;length > 0; length--)
+    {
+        /* calculate the CRC over all data */
+        returnvalue = Ifx__crc32(returnvalue, *startaddress);
+        startaddress++;
+    }
+    return returnvalue;
+}
+
+/* Macros for backward compatibility of the intrinsics*/
+/******************************************************************************/
+#ifndef IFX_CFG_DISABLE_DEFAULT_INTRINSICS
+#ifndef __non_return_call
+#define __non_return_call Ifx__non_return_call
+#endif
+
+#ifndef __jump_and_link
+#define __jump_and_link Ifx__jump_and_link
+#endif
+
+#ifndef __moveToDataParam0
+#define __moveToDataParam0 Ifx__moveToDataParam0
+#endif
+
+#ifndef __moveToDataParamRet
+#define __moveToDataParamRet Ifx__moveToDataParamRet
+#endif
+
+#ifndef __getDataParamRet
+#define __getDataParamRet Ifx__getDataParamRet
+#endif
+
+#ifndef __moveToAddrParam0
+#define __moveToAddrParam0 Ifx__moveToAddrParam0
+#endif
+
+#ifndef __jumpToFunction
+#define __jumpToFunction Ifx__jumpToFunction
+#endif
+
+#ifndef __jumpToFunctionWithLink
+#define __jumpToFunctionWithLink Ifx__jumpToFunctionWithLink
+#endif
+
+#ifndef __jumpBackToLink
+#define __jumpBackToLink Ifx__jumpBackToLink
+#endif
+
+#ifndef __minX
+#define __minX Ifx__minX
+#endif
+
+#ifndef __maxX
+#define __maxX Ifx__maxX
+#endif
+
+#ifndef __saturateX
+#define __saturateX Ifx__saturateX
+#endif
+
+#ifndef __checkrangeX
+#define __checkrangeX Ifx__checkrangeX
+#endif
+
+#ifndef __saturate
+#define __saturate Ifx__saturate
+#endif
+
+#ifndef __saturateu
+#define __saturateu Ifx__saturateu
+#endif
+
+#ifndef __max
+#define __max Ifx__max
+#endif
+
+#ifndef __maxs
+#define __maxs Ifx__maxs
+#endif
+
+#ifndef __maxu
+#define __maxu Ifx__maxu
+#endif
+
+#ifndef __min
+#define __min Ifx__min
+#endif
+
+#ifndef __mins
+#define __mins Ifx__mins
+#endif
+
+#ifndef __minu
+#define __minu Ifx__minu
+#endif
+
+#ifndef __sqrtf
+#define __sqrtf Ifx__sqrtf
+#endif
+
+#ifndef __sqrf
+#define __sqrf Ifx__sqrf
+#endif
+
+#ifndef __checkrange
+#define __checkrange Ifx__checkrange
+#endif
+
+#ifndef __roundf
+#define __roundf Ifx__roundf
+#endif
+
+#ifndef __absf
+#define __absf Ifx__absf
+#endif
+
+#ifndef __saturatef
+#define __saturatef Ifx__saturatef
+#endif
+
+#ifndef __minf
+#define __minf Ifx__minf
+#endif
+
+#ifndef __maxf
+#define __maxf Ifx__maxf
+#endif
+
+#ifndef __checkrangef
+#define __checkrangef Ifx__checkrangef
+#endif
+
+#ifndef __abs_stdreal
+#define __abs_stdreal Ifx__abs_stdreal
+#endif
+
+#ifndef __saturate_stdreal
+#define __saturate_stdreal Ifx__saturate_stdreal
+#endif
+
+#ifndef __min_stdreal
+#define __min_stdreal Ifx__min_stdreal
+#endif
+
+#ifndef __max_stdreal
+#define __max_stdreal Ifx__max_stdreal
+#endif
+
+#ifndef __neqf
+#define __neqf Ifx__neqf
+#endif
+
+#ifndef __leqf
+#define __leqf Ifx__leqf
+#endif
+
+#ifndef __geqf
+#define __geqf Ifx__geqf
+#endif
+
+#ifndef __clssf
+#define __clssf Ifx__clssf
+#endif
+
+#ifndef __fract_to_float
+#define __fract_to_float Ifx__fract_to_float
+#endif
+
+#ifndef __fract_to_sfract
+#define __fract_to_sfract Ifx__fract_to_sfract
+#endif
+
+#ifndef __float_to_sfract
+#define __float_to_sfract Ifx__float_to_sfract
+#endif
+
+#ifndef __float_to_fract
+#define __float_to_fract Ifx__float_to_fract
+#endif
+
+#ifndef __getfract
+#define __getfract Ifx__getfract
+#endif
+
+#ifndef __mac_r_sf
+#define __mac_r_sf Ifx__mac_r_sf
+#endif
+
+#ifndef __mac_sf
+#define __mac_sf Ifx__mac_sf
+#endif
+
+#ifndef __mulfractfract
+#define __mulfractfract Ifx__mulfractfract
+#endif
+
+#ifndef __mulfractlong
+#define __mulfractlong Ifx__mulfractlong
+#endif
+
+#ifndef __round16
+#define __round16 Ifx__round16
+#endif
+
+#ifndef __s16_to_sfract
+#define __s16_to_sfract Ifx__s16_to_sfract
+#endif
+
+#ifndef __sfract_to_s16
+#define __sfract_to_s16 Ifx__sfract_to_s16
+#endif
+
+#ifndef __sfract_to_u16
+#define __sfract_to_u16 Ifx__sfract_to_u16
+#endif
+
+#ifndef __shaaccum
+#define __shaaccum Ifx__shaaccum
+#endif
+
+#ifndef __shafracts
+#define __shafracts Ifx__shafracts
+#endif
+
+#ifndef __shasfracts
+#define __shasfracts Ifx__shasfracts
+#endif
+
+#ifndef __u16_to_sfract
+#define __u16_to_sfract Ifx__u16_to_sfract
+#endif
+
+#ifndef __extr
+#define __extr Ifx__extr
+#endif
+
+#ifndef __extru
+#define __extru Ifx__extru
+#endif
+
+#ifndef __getbit
+#define __getbit Ifx__getbit
+#endif
+
+#ifndef __ins
+#define __ins Ifx__ins
+#endif
+
+#ifndef __insert
+#define __insert Ifx__insert
+#endif
+
+#ifndef __insn
+#define __insn Ifx__insn
+#endif
+
+#ifndef __putbit
+#define __putbit Ifx__putbit
+#endif
+
+#ifndef __imaskldmst
+#define __imaskldmst Ifx__imaskldmst
+#endif
+
+#ifndef __bisr
+#define __bisr Ifx__bisr
+#endif
+
+#ifndef __disable
+#define __disable Ifx__disable
+#endif
+
+#ifndef __disable_and_save
+#define __disable_and_save Ifx__disable_and_save
+#endif
+
+#ifndef __enable
+#define __enable Ifx__enable
+#endif
+
+#ifndef __restore
+#define __restore Ifx__restore
+#endif
+
+#ifndef __syscall
+#define __syscall Ifx__syscall
+#endif
+
+#ifndef __tric_syscall
+#define __tric_syscall Ifx__tric_syscall
+#endif
+
+#ifndef __cacheawi
+#define __cacheawi Ifx__cacheawi
+#endif
+
+#ifndef __cacheiwi
+#define __cacheiwi Ifx__cacheiwi
+#endif
+
+#ifndef __cacheawi_bo_post_inc
+#define __cacheawi_bo_post_inc Ifx__cacheawi_bo_post_inc
+#endif
+
+#ifndef __mulsc
+#define __mulsc Ifx__mulsc
+#endif
+
+#ifndef __rol
+#define __rol Ifx__rol
+#endif
+
+#ifndef __ror
+#define __ror Ifx__ror
+#endif
+
+#ifndef __extractbyte1
+#define __extractbyte1 Ifx__extractbyte1
+#endif
+
+#ifndef __extractbyte2
+#define __extractbyte2 Ifx__extractbyte2
+#endif
+
+#ifndef __extractbyte3
+#define __extractbyte3 Ifx__extractbyte3
+#endif
+
+#ifndef __extractbyte4
+#define __extractbyte4 Ifx__extractbyte4
+#endif
+
+#ifndef __extracthw1
+#define __extracthw1 Ifx__extracthw1
+#endif
+
+#ifndef __extracthw2
+#define __extracthw2 Ifx__extracthw2
+#endif
+
+#ifndef __extractubyte1
+#define __extractubyte1 Ifx__extractubyte1
+#endif
+
+#ifndef __extractubyte2
+#define __extractubyte2 Ifx__extractubyte2
+#endif
+
+#ifndef __extractubyte3
+#define __extractubyte3 Ifx__extractubyte3
+#endif
+
+#ifndef __extractubyte4
+#define __extractubyte4 Ifx__extractubyte4
+#endif
+
+#ifndef __extractuhw1
+#define __extractuhw1 Ifx__extractuhw1
+#endif
+
+#ifndef __extractuhw2
+#define __extractuhw2 Ifx__extractuhw2
+#endif
+
+#ifndef __getbyte1
+#define __getbyte1 Ifx__getbyte1
+#endif
+
+#ifndef __getbyte2
+#define __getbyte2 Ifx__getbyte2
+#endif
+
+#ifndef __getbyte3
+#define __getbyte3 Ifx__getbyte3
+#endif
+
+#ifndef __getbyte4
+#define __getbyte4 Ifx__getbyte4
+#endif
+
+#ifndef __gethw1
+#define __gethw1 Ifx__gethw1
+#endif
+
+#ifndef __gethw2
+#define __gethw2 Ifx__gethw2
+#endif
+
+#ifndef __getubyte1
+#define __getubyte1 Ifx__getubyte1
+#endif
+
+#ifndef __getubyte2
+#define __getubyte2 Ifx__getubyte2
+#endif
+
+#ifndef __getubyte3
+#define __getubyte3 Ifx__getubyte3
+#endif
+
+#ifndef __getubyte4
+#define __getubyte4 Ifx__getubyte4
+#endif
+
+#ifndef __getuhw1
+#define __getuhw1 Ifx__getuhw1
+#endif
+
+#ifndef __getuhw2
+#define __getuhw2 Ifx__getuhw2
+#endif
+
+#ifndef __setbyte1
+#define __setbyte1 Ifx__setbyte1
+#endif
+
+#ifndef __setbyte2
+#define __setbyte2 Ifx__setbyte2
+#endif
+
+#ifndef __setbyte3
+#define __setbyte3 Ifx__setbyte3
+#endif
+
+#ifndef __setbyte4
+#define __setbyte4 Ifx__setbyte4
+#endif
+
+#ifndef __sethw1
+#define __sethw1 Ifx__sethw1
+#endif
+
+#ifndef __sethw2
+#define __sethw2 Ifx__sethw2
+#endif
+
+#ifndef __setubyte1
+#define __setubyte1 Ifx__setubyte1
+#endif
+
+#ifndef __setubyte2
+#define __setubyte2 Ifx__setubyte2
+#endif
+
+#ifndef __setubyte3
+#define __setubyte3 Ifx__setubyte3
+#endif
+
+#ifndef __setubyte4
+#define __setubyte4 Ifx__setubyte4
+#endif
+
+#ifndef __setuhw1
+#define __setuhw1 Ifx__setuhw1
+#endif
+
+#ifndef __setuhw2
+#define __setuhw2 Ifx__setuhw2
+#endif
+
+#ifndef __minhu
+#define __minhu Ifx__minhu
+#endif
+
+#ifndef __minh
+#define __minh Ifx__minh
+#endif
+
+#ifndef __minbu
+#define __minbu Ifx__minbu
+#endif
+
+#ifndef __minb
+#define __minb Ifx__minb
+#endif
+
+#ifndef __insertuhw2
+#define __insertuhw2 Ifx__insertuhw2
+#endif
+
+#ifndef __insertuhw1
+#define __insertuhw1 Ifx__insertuhw1
+#endif
+
+#ifndef __inserthw2
+#define __inserthw2 Ifx__inserthw2
+#endif
+
+#ifndef __inserthw1
+#define __inserthw1 Ifx__inserthw1
+#endif
+
+#ifndef __insertubyte4
+#define __insertubyte4 Ifx__insertubyte4
+#endif
+
+#ifndef __insertubyte3
+#define __insertubyte3 Ifx__insertubyte3
+#endif
+
+#ifndef __insertubyte2
+#define __insertubyte2 Ifx__insertubyte2
+#endif
+
+#ifndef __insertubyte1
+#define __insertubyte1 Ifx__insertubyte1
+#endif
+
+#ifndef __insertbyte4
+#define __insertbyte4 Ifx__insertbyte4
+#endif
+
+#ifndef __insertbyte3
+#define __insertbyte3 Ifx__insertbyte3
+#endif
+
+#ifndef __insertbyte2
+#define __insertbyte2 Ifx__insertbyte2
+#endif
+
+#ifndef __insertbyte1
+#define __insertbyte1 Ifx__insertbyte1
+#endif
+
+#ifndef __initupackhw
+#define __initupackhw Ifx__initupackhw
+#endif
+
+#ifndef __initupackb
+#define __initupackb Ifx__initupackb
+#endif
+
+#ifndef __initpackhwl
+#define __initpackhwl Ifx__initpackhwl
+#endif
+
+#ifndef __initpackhw
+#define __initpackhw Ifx__initpackhw
+#endif
+
+#ifndef __initpackbl
+#define __initpackbl Ifx__initpackbl
+#endif
+
+#ifndef __initpackb
+#define __initpackb Ifx__initpackb
+#endif
+
+#ifndef __absb
+#define __absb Ifx__absb
+#endif
+
+#ifndef __absh
+#define __absh Ifx__absh
+#endif
+
+#ifndef __abssh
+#define __abssh Ifx__abssh
+#endif
+
+
+#ifndef __abs
+#define __abs Ifx__abs
+#endif
+
+#ifndef __absdif
+#define __absdif Ifx__absdif
+#endif
+
+#ifndef __abss
+#define __abss Ifx__abss
+#endif
+
+#ifndef __clo
+#define __clo Ifx__clo
+#endif
+
+#ifndef __cls
+#define __cls Ifx__cls
+#endif
+
+#ifndef __clz
+#define __clz Ifx__clz
+#endif
+
+#ifndef __fabs
+#define __fabs Ifx__fabs
+#endif
+
+#ifndef __fabsf
+#define __fabsf Ifx__fabsf
+#endif
+
+#ifndef __mfcr
+#define __mfcr Ifx__mfcr
+#endif
+
+#ifndef __mtcr
+#define __mtcr Ifx__mtcr
+#endif
+
+#ifndef __parity
+#define __parity Ifx__parity
+#endif
+
+#ifndef __satb
+#define __satb Ifx__satb
+#endif
+
+#ifndef __satbu
+#define __satbu Ifx__satbu
+#endif
+
+#ifndef __sath
+#define __sath Ifx__sath
+#endif
+
+#ifndef __sathu
+#define __sathu Ifx__sathu
+#endif
+
+#ifndef __adds
+#define __adds Ifx__adds
+#endif
+
+#ifndef __addsu
+#define __addsu Ifx__addsu
+#endif
+
+#ifndef __subs
+#define __subs Ifx__subs
+#endif
+
+#ifndef __subsu
+#define __subsu Ifx__subsu
+#endif
+
+#ifndef __debug
+#define __debug Ifx__debug
+#endif
+
+#ifndef __mem_barrier
+#define __mem_barrier Ifx__mem_barrier
+#endif
+
+#ifndef __dsync
+#define __dsync Ifx__dsync
+#endif
+
+#ifndef __isync
+#define __isync Ifx__isync
+#endif
+
+#ifndef __ldmst
+#define __ldmst Ifx__ldmst
+#endif
+
+#ifndef __nop
+#define __nop Ifx__nop
+#endif
+
+#ifndef __nops
+#define __nops Ifx__nops
+#endif
+
+#ifndef __rslcx
+#define __rslcx Ifx__rslcx
+#endif
+
+#ifndef __svlcx
+#define __svlcx Ifx__svlcx
+#endif
+
+#ifndef __swap
+#define __swap Ifx__swap
+#endif
+
+#if ((!defined(NOP)) && (!defined(IFX_CFG_DISABLE_DEFAULT_INTRINSICS)))
+#define NOP Ifx__NOP
+#endif
+
+#ifndef __setareg
+#define __setareg Ifx__setareg
+#endif
+
+#ifndef __stopPerfCounters
+#define __stopPerfCounters Ifx__stopPerfCounters
+#endif
+
+#ifndef __cmpAndSwap
+#define __cmpAndSwap Ifx__cmpAndSwap
+#endif
+
+#ifndef __fixpoint_to_float32
+#define __fixpoint_to_float32 Ifx__fixpoint_to_float32
+#endif
+
+#ifndef __getA11
+#define __getA11 Ifx__getA11
+#endif
+
+#ifndef __setStackPointer
+#define __setStackPointer Ifx__setStackPointer
+#endif
+
+#if ((!defined(__crc32)) && (!defined(IFX_CFG_DISABLE_DEFAULT_INTRINSICS)))
+#define __crc32 Ifx__crc32
+#endif
+
+#ifndef __popcnt
+#define __popcnt Ifx__popcnt
+#endif
+
+#ifndef __cacheai
+#define __cacheai Ifx__cacheai
+#endif
+
+#endif
+/******************************************************************************/
+/* *INDENT-ON* */
+/******************************************************************************/
+#endif /* IFXCPU_INTRINSICSHOST_H */
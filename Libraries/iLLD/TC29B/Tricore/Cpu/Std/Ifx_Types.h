@@ -200,6 +200,9 @@ typedef enum
 
 #elif defined(__MSVC__)
 #include "Ifx_TypesMsvc.h"
+
+#elif defined(__HOST__)
+#include "Ifx_TypesHost.h"
 #else
 #error Unsupported compiler.
 #endif
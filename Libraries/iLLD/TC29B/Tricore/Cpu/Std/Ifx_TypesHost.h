@@ -0,0 +1,59 @@
+/**
+ * \file Ifx_TypesHost.h
+ * \version iLLD_1_0_1_11_0
+ * \copyright Copyright (c) 2012 Infineon Technologies AG. All rights reserved.
+ *
+ *
+ *                                 IMPORTANT NOTICE
+ *
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or 
+ * the company in which ordinary course of business you are acting and (ii) 
+ * Infineon Technologies AG or its licensees. If and as long as no such 
+ * terms of use are agreed, use of this file is subject to following:
+
+
+ * Boost Software License - Version 1.0 - August 17th, 2003
+
+ * Permission is hereby granted, free of charge, to any person or 
+ * organization obtaining a copy of the software and accompanying 
+ * documentation covered by this license (the "Software") to use, reproduce,
+ * display, distribute, execute, and transmit the Software, and to prepare
+ * derivative works of the Software, and to permit third-parties to whom the 
+ * Software is furnished to do so, all subject to the following:
+
+ * The copyright notices in the Software and this entire statement, including
+ * the above license grant, this restriction and the following disclaimer, must
+ * be included in all copies of the Software, in whole or in part, and all
+ * derivative works of the Software, unless such copies or derivative works are
+ * solely in the form of machine-executable object code generated by a source
+ * language processor.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT
+ * SHALL THE COPYRIGHT HOLDERS OR ANYONE DISTRIBUTING THE SOFTWARE BE LIABLE 
+ * FOR ANY DAMAGES OR OTHER LIABILITY, WHETHER IN CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+
+ *
+ */
+#ifndef IFX_TYPESHOST_H_
+#define IFX_TYPESHOST_H_
+/******************************************************************************/
+#define FRACT_MAX 0x7fffffff
+
+#define __interrupt(intno)
+
+/* the fixed point and packed types keep their TriCore width on LP64 hosts */
+typedef int           fract;
+typedef short         sfract;
+typedef long long     laccum;
+typedef int           __packb;
+typedef unsigned int  __upackb;
+typedef int           __packhw;
+typedef unsigned int  __upackhw;
+/******************************************************************************/
+
+#endif /* IFX_TYPESHOST_H_ */
@@ -110,7 +110,12 @@ typedef unsigned short      uint16;
 
 /* 32bit unsigned:  0..4294967295 [0x00000000..0xFFFFFFFF]*/
 /* [cover parentID={DA33B7A0-7CD3-45e7-9C9A-6D63FB8BA3DC}] uint32 [/cover] */
+#if defined(__HOST__)
+/* long has 64 bit on LP64 hosts */
+typedef unsigned int        uint32;
+#else
 typedef unsigned long       uint32;
+#endif
 
 /* 64bit unsigned
 *          0..18446744073709551615   [0x0000000000000000..0xFFFFFFFFFFFFFFFF]*/
@@ -128,7 +133,11 @@ typedef short               sint16;
 /* 32bit signed, 31 bit + 1 bit sign
  -2147483648..+2147483647 [0x80000000..0x7FFFFFFF]*/
 /* [cover parentID={B027B471-A1A2-456c-A015-35F4A34A88EF}] sint32 [/cover]*/
+#if defined(__HOST__)
+typedef int                 sint32;
+#else
 typedef long                sint32;
+#endif
 /*
 * 64bit signed, 63 bit + 1 bit sign
 * -9223372036854775808..9223372036854775807
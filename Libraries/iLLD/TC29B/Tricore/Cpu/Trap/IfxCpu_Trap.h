@@ -244,6 +244,12 @@ typedef struct
         __asm("svlcx\n\tmov\td4,d15\n\tji\t%0\n" : : "a" (serviceRoutine) : "d4", "d15"); \
     }
 #define __ALIGN_TRAP_TAB__ __asm(" .align 32");
+#elif defined(__HOST__)
+/* The host has no trap vector table, the service routines are called directly */
+#define IfxCpu_Tsr_CallTSR(serviceRoutine) \
+    {                                      \
+        (void)(serviceRoutine);            \
+    }
 #endif
 
 /** \} */
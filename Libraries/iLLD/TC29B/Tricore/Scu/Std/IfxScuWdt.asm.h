@@ -117,6 +117,12 @@ IFX_INLINE uint16 IfxScuWdt_calculateLfsr(uint16 pwd)
     return IfxScuWdt_calculateLfsr_asm(pwd);
 }
 #endif
+#if defined(__HOST__)
+IFX_INLINE uint16 IfxScuWdt_calculateLfsr(uint16 pwd)
+{
+    return (uint16)IFXSCUWDT_CALCULATELFSR(pwd);
+}
+#endif
 #if defined(__ghs__)
 IFX_INLINE uint16 IfxScuWdt_calculateLfsr(uint16 pwd)
 {
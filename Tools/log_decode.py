@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Rebuild the deferred log messages from a UART capture and the ELF file.
+
+LOG() on the target only sends the address of its format string and the raw
+argument words (Application/log.c). This tool reads the format strings from
+the ELF file, formats the messages and prints them together with the text
+lines of the capture, in the order they were received.
+
+    python3 Tools/log_decode.py Debug/ADS_TC29x_ASCLIN.elf uart.bin
+    python3 Tools/log_decode.py --stm-hz 100000000 firmware.elf - < uart.bin
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SYNC = b"\xA5\x5B"
+MESSAGE = struct.Struct("<IIIBBH4I")
+MAX_MESSAGES = 6
+TRACE_SYNC = b"\xA5\x5A"   # event trace frames, skipped
+TRACE_RECORD_SIZE = 16
+TRACE_MAX_EVENTS = 12
+SHF_ALLOC = 2
+SHT_NOBITS = 8
+
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z)?([diuxXcpfFeEgGs%])")
+
+
+class Elf:
+    """Read only access to the initialised memory of an ELF32 file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            sys.exit("%s: not an ELF32 file" % path)
+        endian = "<" if self.data[5] == 1 else ">"
+        shoff, = struct.unpack_from(endian + "I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + "HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(endian + "IIIIII", self.data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size:
+                self.sections.append((addr, size, offset))
+
+    def string(self, address):
+        """Zero terminated string at a target address, None if not in the file."""
+        for addr, size, offset in self.sections:
+            if addr <= address < addr + size:
+                start = offset + address - addr
+                end = self.data.find(b"\0", start, offset + size)
+                return self.data[start:end if end >= 0 else offset + size].decode("latin-1")
+        return None
+
+
+def format_message(elf, fmt_address, args):
+    """Apply the arguments to the format string like printf does."""
+    fmt = elf.string(fmt_address)
+    if fmt is None:
+        return "<unknown format 0x%08X> %s" % (fmt_address, " ".join("0x%08X" % a for a in args))
+    words = iter(args)
+
+    def convert(match):
+        flags, kind = match.groups()
+        if kind == "%":
+            return "%"
+        word = next(words, 0)
+        if kind in "di":
+            return ("%" + flags + "d") % (word - (1 << 32) if word & 0x80000000 else word)
+        if kind == "p":
+            return "0x%08X" % word
+        if kind == "c":
+            return chr(word & 0xFF)
+        if kind in "fFeEgG":
+            return ("%" + flags + kind) % struct.unpack("<f", struct.pack("<I", word))[0]
+        if kind == "s":
+            text = elf.string(word)
+            return ("%" + flags + "s") % (text if text is not None else "<0x%08X>" % word)
+        return ("%" + flags + kind) % word
+
+    return CONVERSION.sub(convert, fmt.rstrip("\r\n"))
+
+
+def frame_end(data, pos, record_size, max_records):
+    """End of a valid frame at pos, None if there is none."""
+    if pos + 3 > len(data):
+        return None
+    count = data[pos + 2]
+    end = pos + 3 + count * record_size
+    if 0 < count <= max_records and end < len(data) and sum(data[pos + 3:end]) & 0xFF == data[end]:
+        return end
+    return None
+
+
+def decode(elf, data, stm_hz, out):
+    """Print text lines and log messages in the order of the capture."""
+    pos = 0
+    text = bytearray()
+    while pos < len(data):
+        if data.startswith(TRACE_SYNC, pos):
+            end = frame_end(data, pos, TRACE_RECORD_SIZE, TRACE_MAX_EVENTS)
+            if end is not None:
+                pos = end + 1
+                continue
+        if data.startswith(SYNC, pos):
+            end = frame_end(data, pos, MESSAGE.size, MAX_MESSAGES)
+            if end is not None:
+                for off in range(pos + 3, end, MESSAGE.size):
+                    low, high, fmt, cpu, num_args, seq, *args = MESSAGE.unpack_from(data, off)
+                    stamp = ((high << 32) | low) / stm_hz
+                    if fmt == 0:
+                        line = "%d messages lost" % args[0]
+                    else:
+                        line = format_message(elf, fmt, args[:num_args])
+                    out.write("[%12.6f] CPU%d #%05d %s\n" % (stamp, cpu, seq, line))
+                pos = end + 1
+                continue
+        byte = data[pos]
+        pos += 1
+        if byte == 0x0A:
+            out.write(text.decode("latin-1").rstrip("\r") + "\n")
+            text.clear()
+        elif byte == 0x0D or 0x20 <= byte < 0x7F or byte == 0x09:
+            text.append(byte)
+    if text:
+        out.write(text.decode("latin-1") + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="firmware ELF file with the format strings")
+    parser.add_argument("capture", help="raw UART capture, '-' for stdin")
+    parser.add_argument("--stm-hz", type=float, default=100e6, help="STM frequency (default 100 MHz)")
+    args = parser.parse_args()
+
+    if args.capture == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+
+    decode(Elf(args.elf), data, args.stm_hz, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
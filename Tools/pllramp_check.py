@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Host model of the PLL ramp profile (Configurations/PllRampDef.h).
+
+Reads the crystal and PLL frequency from Configurations/Ifx_Cfg.h, the
+initial PLL step from the iLLD (IfxScu_cfg.h) and the K2 divider steps from
+Configurations/PllRampDef.h, then checks the sequence the same way as
+PLLRAMP_CheckProfile() does on the target, plus the VCO range, the size of
+each frequency jump and the ASCLIN3 baud rate error at each step.
+
+    python3 Tools/pllramp_check.py
+    python3 Tools/pllramp_check.py --k2 5,4,3 --max-jump 1.34
+
+Exit status 0 if the profile is valid, 1 otherwise.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+IFX_CFG = os.path.join(ROOT, "Configurations", "Ifx_Cfg.h")
+PLLRAMP_DEF = os.path.join(ROOT, "Configurations", "PllRampDef.h")
+SCU_CFG = os.path.join(ROOT, "Libraries", "iLLD", "TC29B", "Tricore", "_Impl", "IfxScu_cfg.h")
+
+K2DIV_MAX = 128             # PLLCON1.K2DIV is 7 bit wide, divider = value + 1
+VCO_RANGE = (400e6, 800e6)  # TC29x VCO range
+BRG_MAX = 4095              # ASCLIN BRG.NUMERATOR / DENOMINATOR
+OVERSAMPLING = 16
+
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+
+def define(text, name):
+    m = re.search(r"#define\s+%s\s+\(?\s*([0-9.]+)[uUfF]?\s*\)?" % name, text)
+    if m is None:
+        sys.exit("%s not found" % name)
+    return float(m.group(1))
+
+
+def initial_step(xtal, pll):
+    """P, N and K2 dividers of the initial step, as used by IfxScuCcu_init."""
+    name = "IFXSCU_CFG_PLL_INITIAL_STEP_%dMHZ_%dMHZ" % (xtal // 1000000, pll // 1000000)
+    m = re.search(r"#define\s+%s\s*\\\s*\n.*\n\s*\{\s*\((\d+)\s*-\s*1\),\s*\((\d+)\s*-\s*1\),\s*\((\d+)\s*-\s*1\)"
+                  % name, read(SCU_CFG))
+    if m is None:
+        sys.exit("%s not found in %s" % (name, SCU_CFG))
+    return int(m.group(1)), int(m.group(2)), int(m.group(3))
+
+
+def ramp_steps():
+    """K2 dividers and wait times of PLLRAMP_PROFILE."""
+    text = read(PLLRAMP_DEF)
+    steps = [(int(k2), float(wait)) for k2, wait in
+             re.findall(r"PLLRAMP_STEP\(\s*(\d+)\s*,\s*([0-9.eE+-]+)[fF]?\s*\)", text)]
+    early = int(define(text, "PLLRAMP_EARLY_STEPS"))
+    return steps, early
+
+
+def baud_error(f_asclin, baud):
+    """Relative baud rate error of the ASCLIN3_WriteBrg() calculation."""
+    f_bit = baud * OVERSAMPLING
+    num = min(max(int(BRG_MAX * f_bit / f_asclin), 1), BRG_MAX)
+    den = min(int(num * f_asclin / f_bit + 0.5), BRG_MAX)
+    return (f_asclin * num / den / OVERSAMPLING - baud) / baud
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--k2", help="comma separated K2 dividers, overrides PllRampDef.h")
+    parser.add_argument("--max-jump", type=float, default=1.34,
+                        help="largest allowed frequency ratio between two steps (default 1.34)")
+    parser.add_argument("--baud", type=int, default=115200, help="UART baud rate (default 115200)")
+    parser.add_argument("--max-baud-error", type=float, default=0.02,
+                        help="largest allowed UART baud rate error (default 0.02)")
+    args = parser.parse_args()
+
+    cfg = read(IFX_CFG)
+    xtal = int(define(cfg, "IFX_CFG_SCU_XTAL_FREQUENCY"))
+    target = int(define(cfg, "IFX_CFG_SCU_PLL_FREQUENCY"))
+    p, n, k2_initial = initial_step(xtal, target)
+    steps, early = ramp_steps()
+    if args.k2:
+        steps = [(int(k2), 0.0) for k2 in args.k2.split(",")]
+        early = 0
+
+    errors = []
+    f_vco = xtal * n / p
+    if not VCO_RANGE[0] <= f_vco <= VCO_RANGE[1]:
+        errors.append("fVCO %.1f MHz out of range" % (f_vco / 1e6))
+    if not steps:
+        errors.append("no steps")
+    if early > len(steps):
+        errors.append("PLLRAMP_EARLY_STEPS > number of steps")
+
+    print("xtal %d MHz  P=%d N=%d  fVCO %.1f MHz  target %d MHz"
+          % (xtal // 1000000, p, n, f_vco / 1e6, target // 1000000))
+    print("%-8s %4s %10s %7s %10s %9s" % ("step", "K2", "fPLL MHz", "jump", "wait us", "baud err"))
+
+    k2_prev = k2_initial
+    f_prev = f_vco / k2_initial
+    print("%-8s %4d %10.2f %7s %10s %8.2f%%"
+          % ("initial", k2_initial, f_prev / 1e6, "", "", 100 * baud_error(f_prev, args.baud)))
+    for i, (k2, wait) in enumerate(steps):
+        f_pll = f_vco / k2
+        jump = f_pll / f_prev
+        err = baud_error(f_pll, args.baud)
+        print("%-8s %4d %10.2f %7.3f %10.1f %8.2f%%%s"
+              % (i, k2, f_pll / 1e6, jump, wait * 1e6, 100 * err, "  early" if i < early else ""))
+        if not 1 <= k2 <= K2DIV_MAX:
+            errors.append("step %d: K2 %d out of range" % (i, k2))
+        if k2 >= k2_prev:
+            errors.append("step %d: K2 %d does not decrease (previous %d)" % (i, k2, k2_prev))
+        if jump > args.max_jump:
+            errors.append("step %d: frequency jump %.3f > %.3f" % (i, jump, args.max_jump))
+        if abs(err) > args.max_baud_error:
+            errors.append("step %d: baud rate error %.2f%%" % (i, 100 * err))
+        k2_prev, f_prev = k2, f_pll
+
+    if steps and abs(f_prev - target) > target * 0.01:
+        errors.append("last step gives %.2f MHz, expected %d MHz" % (f_prev / 1e6, target // 1000000))
+
+    for e in errors:
+        print("ERROR: " + e)
+    print("profile %s" % ("invalid" if errors else "ok"))
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Resolve the sampling profiler histograms against the ELF file.
+
+Reads the "PROF" lines sent by PROFILER_Report() from a UART log and prints
+a flat profile per core: samples and share per function, most expensive
+first.
+
+    python3 Tools/profiler_resolve.py Debug/ADS_TC29x_ASCLIN.elf uart.log
+    python3 Tools/profiler_resolve.py --pcs 10 firmware.elf < uart.log
+
+Only the Python standard library is used, the symbol table is read directly
+from the ELF file.
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import struct
+import sys
+
+STT_FUNC = 2
+SHT_SYMTAB = 2
+
+LINE = re.compile(r"PROF (\d+) 0x([0-9A-Fa-f]{8}) (\d+)")
+HEADER = re.compile(r"PROF cpu=(\d+) samples=(\d+) lost=(\d+)")
+
+
+def read_functions(path):
+    """Sorted list of (start, end, name) of the function symbols."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 1:
+        sys.exit("%s: not an ELF32 file" % path)
+    endian = "<" if data[5] == 1 else ">"
+    shoff, = struct.unpack_from(endian + "I", data, 0x20)
+    shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+
+    sections = [struct.unpack_from(endian + "IIIIIIIIII", data, shoff + i * shentsize) for i in range(shnum)]
+    functions = {}
+    for sh in sections:
+        if sh[1] != SHT_SYMTAB:
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], 16):
+            name_off, value, size, info, _, _ = struct.unpack_from(endian + "IIIBBH", data, off)
+            if info & 0xF != STT_FUNC or value == 0:
+                continue
+            start = strtab[4] + name_off
+            name = data[start:data.index(b"\0", start)].decode("ascii", "replace")
+            functions[value] = (size, name)
+
+    starts = sorted(functions)
+    result = []
+    for i, start in enumerate(starts):
+        size, name = functions[start]
+        end = start + size if size else (starts[i + 1] if i + 1 < len(starts) else start + 4)
+        result.append((start, end, name))
+    return result
+
+
+def resolve(functions, starts, pc):
+    i = bisect.bisect_right(starts, pc) - 1
+    if i >= 0 and functions[i][0] <= pc < functions[i][1]:
+        return functions[i][2]
+    return "?0x%08X" % pc
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf", help="firmware ELF file with symbols")
+    parser.add_argument("log", nargs="?", help="UART log, stdin if omitted")
+    parser.add_argument("--top", type=int, default=20, help="functions shown per core (default 20)")
+    parser.add_argument("--pcs", type=int, default=0, help="also show the N hottest addresses per core")
+    args = parser.parse_args()
+
+    functions = read_functions(args.elf)
+    starts = [f[0] for f in functions]
+
+    pcs = collections.defaultdict(collections.Counter)
+    headers = {}
+    log = open(args.log) if args.log else sys.stdin
+    for line in log:
+        m = HEADER.search(line)
+        if m:
+            headers[int(m.group(1))] = (int(m.group(2)), int(m.group(3)))
+            continue
+        m = LINE.search(line)
+        if m:
+            pcs[int(m.group(1))][int(m.group(2), 16)] += int(m.group(3))
+
+    for cpu in sorted(set(pcs) | set(headers)):
+        samples, lost = headers.get(cpu, (sum(pcs[cpu].values()), 0))
+        print("CPU%d: %d samples, %d lost" % (cpu, samples, lost))
+        per_function = collections.Counter()
+        for pc, count in pcs[cpu].items():
+            per_function[resolve(functions, starts, pc)] += count
+        for name, count in per_function.most_common(args.top):
+            print("  %6.2f%% %8d  %s" % (100.0 * count / max(samples, 1), count, name))
+        if args.pcs:
+            print("  hottest addresses:")
+            for pc, count in pcs[cpu].most_common(args.pcs):
+                print("  0x%08X %8d  %s" % (pc, count, resolve(functions, starts, pc)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Measure the UART round trip and throughput of the firmware over a serial device.
+
+Sends the log mask command "LOG 0 hh\\r\\n" (Application/log.c) and waits for
+the "log masks" message the scheduler answers with, its first argument is the
+new mask. The device is normally the pseudo-terminal of the host simulator,
+started by the tool with --sim, but any serial adapter connected to a board
+works the same way.
+
+    python3 Tools/pty_bench.py --sim Host/build/tc29x_sim
+    python3 Tools/pty_bench.py --sim Host/build/tc29x_sim --sim-arg=-u
+    python3 Tools/pty_bench.py /dev/ttyUSB0
+
+Round trip: one command at a time, the time from the command being written to
+the end of the answer. Burst: the commands --gap ms apart without waiting, the
+answers per second and the commands without answer. The receive DMA of the
+firmware takes one command and waits for the scheduler to restart it, with
+a short gap the next command overflows the 16 byte receive FIFO. Throughput counts every byte received during
+the run, log frames and text, and compares it with the line rate.
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import os
+import select
+import struct
+import subprocess
+import sys
+import termios
+import time
+import tty
+
+SYNC = b"\xA5\x5B"
+MESSAGE = struct.Struct("<IIIBBH4I")
+MAX_MESSAGES = 6
+MASK_ARGS = 3             # "log masks %02X %02X %02X"
+MODULE = 0                # asclin, the scheduler module keeps its mask
+DEFAULT_MASK = 0x07
+BITS_PER_FRAME = 10       # 8N1
+
+
+class Port:
+    """Raw serial device with a receive buffer and answer matching."""
+
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIFLUSH)
+        self.data = bytearray()
+        self.pos = 0
+        self.received = 0
+        self.start = time.monotonic()
+        self.answers = []         # (time, mask)
+
+    def poll(self, timeout):
+        """Read what arrives within timeout seconds and collect the answers."""
+        ready, _, _ = select.select([self.fd], [], [], max(timeout, 0))
+        if not ready:
+            return
+        try:
+            chunk = os.read(self.fd, 4096)
+        except OSError:
+            return
+        now = time.monotonic()
+        self.received += len(chunk)
+        self.data += chunk
+        self.scan(now)
+
+    def scan(self, now):
+        """Take the log mask answers out of the complete frames."""
+        while True:
+            pos = self.data.find(SYNC, self.pos)
+            if pos < 0:
+                # keep a last byte which may be the first of a sync
+                self.pos = max(self.pos, len(self.data) - 1)
+                break
+            if pos + 3 > len(self.data):
+                self.pos = pos
+                break
+            count = self.data[pos + 2]
+            end = pos + 3 + count * MESSAGE.size
+            if not 0 < count <= MAX_MESSAGES:
+                self.pos = pos + 1
+                continue
+            if end >= len(self.data):
+                self.pos = pos
+                break
+            if sum(self.data[pos + 3:end]) & 0xFF != self.data[end]:
+                self.pos = pos + 1
+                continue
+            for off in range(pos + 3, end, MESSAGE.size):
+                _, _, fmt, cpu, num_args, _, *args = MESSAGE.unpack_from(self.data, off)
+                if fmt != 0 and cpu == 0 and num_args == MASK_ARGS:
+                    self.answers.append((now, args[MODULE]))
+            self.pos = end + 1
+        if self.pos > 65536:
+            del self.data[:self.pos]
+            self.pos = 0
+
+    def command(self, mask):
+        """Send a mask command, returns the time it left the host."""
+        os.write(self.fd, b"LOG %d %02X\r\n" % (MODULE, mask))
+        termios.tcdrain(self.fd)
+        return time.monotonic()
+
+    def wait(self, mask, since, timeout):
+        """Time of the answer with mask after since, None on timeout."""
+        deadline = time.monotonic() + timeout
+        while True:
+            for stamp, value in self.answers:
+                if value == mask and stamp >= since:
+                    return stamp
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            self.poll(left)
+
+
+def masks(count):
+    """Distinct consecutive masks, never the default one."""
+    values = [v for v in range(1, 256) if v != DEFAULT_MASK]
+    return [values[i % len(values)] for i in range(count)]
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def round_trip(port, count, timeout):
+    times = []
+    lost = 0
+    for mask in masks(count):
+        port.answers.clear()
+        sent = port.command(mask)
+        stamp = port.wait(mask, sent, timeout)
+        if stamp is None:
+            lost += 1
+        else:
+            times.append((stamp - sent) * 1000.0)
+    return times, lost
+
+
+def burst(port, count, gap, timeout):
+    port.answers.clear()
+    start = time.monotonic()
+    for mask in masks(count):
+        port.command(mask)
+        end = time.monotonic() + gap
+        while True:
+            port.poll(max(end - time.monotonic(), 0))
+            if time.monotonic() >= end:
+                break
+    deadline = time.monotonic() + timeout
+    seen = set()
+    last = start
+    while len(seen) < count and time.monotonic() < deadline:
+        port.poll(deadline - time.monotonic())
+        for stamp, value in port.answers:
+            if value not in seen:
+                seen.add(value)
+                last = max(last, stamp)
+    return len(seen), last - start
+
+
+def start_sim(args):
+    """Start the simulator on a pseudo-terminal, returns the process and the device."""
+    cmd = [args.sim, "-p", "-t", str(args.sim_ms)] + args.sim_arg
+    sim = subprocess.Popen(cmd, stdout=subprocess.PIPE, text=True)
+    line = sim.stdout.readline()
+    if not line.startswith("SIM pty "):
+        sim.kill()
+        sys.exit("%s did not report a pseudo-terminal: %r" % (args.sim, line))
+    return sim, line.split()[2]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("device", nargs="?", help="serial device, not needed with --sim")
+    parser.add_argument("--sim", help="start this host simulator with -p and use its pseudo-terminal")
+    parser.add_argument("--sim-ms", type=int, default=10000, help="simulated run time (default 10000)")
+    parser.add_argument("--sim-arg", action="append", default=[], help="extra simulator argument, repeatable")
+    parser.add_argument("--count", type=int, default=50, help="commands per phase (default 50)")
+    parser.add_argument("--timeout", type=float, default=1.0, help="seconds to wait for an answer (default 1)")
+    parser.add_argument("--gap", type=float, default=50.0, help="ms between the burst commands (default 50)")
+    parser.add_argument("--warmup", type=float, default=0.5, help="seconds before the first command (default 0.5)")
+    parser.add_argument("--baud", type=int, default=115200, help="line rate for the utilisation (default 115200)")
+    args = parser.parse_args()
+
+    sim = None
+    if args.sim:
+        sim, args.device = start_sim(args)
+    elif not args.device:
+        parser.error("a device or --sim is required")
+
+    port = Port(args.device)
+    end = time.monotonic() + args.warmup
+    while time.monotonic() < end:
+        port.poll(end - time.monotonic())
+
+    times, lost = round_trip(port, args.count, args.timeout)
+    answered, span = burst(port, args.count, args.gap / 1000.0, args.timeout * 4)
+    port.command(DEFAULT_MASK)
+    port.poll(0.1)
+    elapsed = time.monotonic() - port.start
+
+    line_rate = args.baud / BITS_PER_FRAME
+    print("device %s" % args.device)
+    if times:
+        print("round trip n=%d lost=%d min=%.2fms avg=%.2fms p95=%.2fms max=%.2fms" %
+              (len(times), lost, min(times), sum(times) / len(times), percentile(times, 0.95), max(times)))
+    else:
+        print("round trip n=0 lost=%d" % lost)
+    print("burst sent=%d gap=%.1fms answered=%d lost=%d rate=%.1f/s" %
+          (args.count, args.gap, answered, args.count - answered, answered / span if span > 0 else 0.0))
+    print("throughput rx=%dB in %.2fs %.0fB/s, %.1f%% of %.0fB/s" %
+          (port.received, elapsed, port.received / elapsed, 100.0 * port.received / elapsed / line_rate, line_rate))
+
+    if sim is not None:
+        # the summary of the simulator follows at the end of its run
+        sys.stdout.flush()
+        for line in sim.stdout:
+            sys.stdout.write(line)
+        sim.wait()
+    return 0 if times and lost == 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,179 @@
+#!/usr/bin/env python3
+"""Count the register accesses per function from a trace of the host simulator.
+
+Reads the trace written with "tc29x_sim -a file" (Host/simtrace.c), resolves
+the accessing instructions with the symbol table of the simulator and the
+addresses with the register definitions of Libraries/Infra/Sfr, and prints
+the reads, writes and read-modify-writes of every function, most accesses
+first, followed by the accesses worth a second look:
+
+  RMW       read-modify-write of a write only or set/clear register, a bit
+            field assignment or |= where a plain write would do
+  READ      read of a write only register, it always returns 0
+  READBACK  read of a register the same function has just written, e.g.
+            (void)ASCLIN3_CLC.U; needed before ENDINIT is set again, a
+            wasted bus access elsewhere
+
+    make -C Host && Host/build/tc29x_sim -t 1500 -a sfr.txt -c 300:9
+    python3 Tools/sfr_report.py Host/build/tc29x_sim sfr.txt
+
+Only the Python standard library is used, the symbol table is read directly
+from the ELF file.
+"""
+
+import argparse
+import bisect
+import collections
+import glob
+import os
+import re
+import struct
+import sys
+
+STT_FUNC = 2
+SHT_SYMTAB = 2
+
+DEFINE = re.compile(r"#define\s+(\w+)\s+/\*lint[^*]*\*/\s*\(\*\(volatile (\w+)\s*\*\)0x([0-9A-Fa-f]+)u\)")
+ALIAS = re.compile(r"#define\s+(\w+)\s+\((\w+)\)\s*$")
+# registers whose bits only act when written, reading them returns 0
+WRITE_ONLY = re.compile(r"(SET|CLR|CLEAR|CLRE|ISCR)G?$")
+# registers with status bits and bits which act when written as 1
+SET_CLEAR = ("Ifx_SRC_SRCR", "Ifx_DMA_TSR", "Ifx_DMA_CH_CHCSR")
+DEFAULT_REGS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Libraries", "Infra", "Sfr", "TC29B", "_Reg")
+
+
+def read_functions(path):
+    """Sorted list of (start, end, name) of the function symbols of an ELF32 or ELF64 file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] not in (1, 2):
+        sys.exit("%s: not an ELF file" % path)
+    endian = "<" if data[5] == 1 else ">"
+    if data[4] == 1:
+        shoff, = struct.unpack_from(endian + "I", data, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+        section, symbol, symsize = "IIIIIIIIII", "IIIBBH", 16
+    else:
+        shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+        shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+        section, symbol, symsize = "IIQQQQIIQQ", "IBBHQQ", 24
+
+    sections = [struct.unpack_from(endian + section, data, shoff + i * shentsize) for i in range(shnum)]
+    functions = {}
+    for sh in sections:
+        if sh[1] != SHT_SYMTAB:
+            continue
+        strtab = sections[sh[6]]
+        for off in range(sh[4], sh[4] + sh[5], symsize):
+            fields = struct.unpack_from(endian + symbol, data, off)
+            if data[4] == 1:
+                name_off, value, size, info = fields[:4]
+            else:
+                name_off, info, _, _, value, size = fields
+            if info & 0xF != STT_FUNC or value == 0:
+                continue
+            start = strtab[4] + name_off
+            name = data[start:data.index(b"\0", start)].decode("ascii", "replace")
+            functions[value] = (size, name)
+
+    starts = sorted(functions)
+    result = []
+    for i, start in enumerate(starts):
+        size, name = functions[start]
+        end = start + size if size else (starts[i + 1] if i + 1 < len(starts) else start + 4)
+        result.append((start, end, name))
+    return result
+
+
+def read_registers(directory):
+    """Register name and type by address, the shortest of the alias names."""
+    registers = {}
+    defined = {}
+    aliases = []
+    for path in glob.glob(os.path.join(directory, "*_reg.h")):
+        with open(path) as f:
+            for line in f:
+                match = DEFINE.match(line)
+                if match:
+                    name, kind, address = match.groups()
+                    defined[name] = (int(address, 16), kind)
+                    continue
+                match = ALIAS.match(line)
+                if match:
+                    aliases.append(match.groups())
+    names = list(defined.items()) + [(alias, defined[target]) for alias, target in aliases if target in defined]
+    for name, (address, kind) in names:
+        known = registers.get(address)
+        if known is None or len(name) < len(known[0]):
+            registers[address] = (name, kind)
+    return registers
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("binary", help="simulator executable which wrote the trace")
+    parser.add_argument("trace", help="trace file, '-' for stdin")
+    parser.add_argument("--regs", default=DEFAULT_REGS, help="directory of the *_reg.h files")
+    parser.add_argument("--top", type=int, default=3, help="registers listed per function (default 3)")
+    args = parser.parse_args()
+
+    functions = read_functions(args.binary)
+    starts = [f[0] for f in functions]
+    registers = read_registers(args.regs)
+
+    def function(site):
+        i = bisect.bisect_right(starts, site) - 1
+        if i >= 0 and site < functions[i][1]:
+            return functions[i][2]
+        return "0x%x" % site
+
+    def register(address):
+        return registers.get(address, ("0x%08X" % address, ""))
+
+    counts = collections.defaultdict(lambda: collections.Counter())
+    per_register = collections.defaultdict(collections.Counter)
+    flags = collections.Counter()
+    last = {}
+
+    f = sys.stdin if args.trace == "-" else open(args.trace)
+    with f:
+        for line in f:
+            if line.startswith("#"):
+                continue
+            _, core, site, kind, address, _ = line.split()
+            site, address = int(site, 16), int(address, 16)
+            name = function(site)
+            reg, reg_kind = register(address)
+            counts[name][kind] += 1
+            per_register[name][reg] += 1
+
+            write_only = WRITE_ONLY.search(reg_kind) is not None
+            if kind == "M" and (write_only or reg_kind in SET_CLEAR):
+                flags[("RMW", name, reg, "write only" if write_only else "set/clear")] += 1
+                if write_only:
+                    # the read of the RMW is already counted as READ
+                    flags[("READ", name, reg, "write only")] -= 1
+            if kind == "R" and write_only:
+                flags[("READ", name, reg, "write only")] += 1
+            if kind == "R" and last.get(core) == ("W", address, name):
+                flags[("READBACK", name, reg, "")] += 1
+            last[core] = ("W" if kind in "WM" else "R", address, name)
+
+    print("%-32s %8s %8s %8s  %s" % ("function", "reads", "writes", "rmw", "registers"))
+    total = collections.Counter()
+    for name, kinds in sorted(counts.items(), key=lambda item: -sum(item[1].values())):
+        top = ", ".join("%s %d" % (reg, n) for reg, n in per_register[name].most_common(args.top))
+        print("%-32s %8d %8d %8d  %s" % (name, kinds["R"], kinds["W"] + kinds["M"], kinds["M"], top))
+        total.update(kinds)
+    print("%-32s %8d %8d %8d" % ("total", total["R"], total["W"] + total["M"], total["M"]))
+
+    flags = +flags
+    if flags:
+        print()
+        for (flag, name, reg, note), n in sorted(flags.items(), key=lambda item: (item[0][0], -item[1])):
+            print("%-9s %-32s %-24s %6dx %s" % (flag, name, reg, n, note))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
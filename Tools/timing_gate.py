@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+"""Fail when the timing estimate of the host simulator regresses.
+
+Compares the "SIM TIMING" lines of a simulator run (Host/simcost.c) with a
+baseline file holding the same lines. The throughput may not fall and the CPU
+and DMA cycles per byte, the service time of a request and the latencies may
+not rise by more than the tolerance. A different configuration, path, INTLEVEL,
+CHDW, frame time or charged costs, fails as well; the baseline is then updated
+on purpose with --update.
+
+The cores run on host threads, so a run of fixed simulated time sends more or
+less of the output depending on the host. With -q the simulator issues each
+command on a quiet line and ends on one after the last command, the run always
+carries the complete output of the commands and the estimate is repeatable.
+
+    Host/build/tc29x_sim -t 60000 -q 200 -c 300:9 -c 400:13 -c 600:16 > run.txt
+    python3 Tools/timing_gate.py Host/timing_baseline.txt run.txt
+    python3 Tools/timing_gate.py --update Host/timing_baseline.txt run.txt
+
+Only the Python standard library is used.
+"""
+
+import argparse
+import re
+import sys
+
+PREFIX = "SIM TIMING "
+CONFIG = ("path", "intlevel", "chdw", "frame", "access", "move", "irq")
+HIGHER = ("throughput",)
+LOWER = ("cpu", "dma", "service", "first", "latency")
+NUMBER = re.compile(r"^-?\d+(?:\.\d+)?")
+
+
+def read(path):
+    """The TIMING lines and their key=value pairs of a file, '-' for stdin."""
+    f = sys.stdin if path == "-" else open(path)
+    with f:
+        lines = [line.rstrip("\n") for line in f if line.startswith(PREFIX)]
+    values = {}
+    for line in lines:
+        for item in line[len(PREFIX):].split():
+            key, _, value = item.partition("=")
+            values[key] = value
+    return lines, values
+
+
+def number(value):
+    """Leading number of a value with unit, e.g. 2.8cyc/B."""
+    match = NUMBER.match(value)
+    return float(match.group(0)) if match else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="file with the expected TIMING lines")
+    parser.add_argument("run", help="simulator output, '-' for stdin")
+    parser.add_argument("--tolerance", type=float, default=5.0, help="allowed change in percent (default 5)")
+    parser.add_argument("--update", action="store_true", help="write the TIMING lines of the run as the new baseline")
+    args = parser.parse_args()
+
+    lines, run = read(args.run)
+    if not lines:
+        sys.exit("%s: no %slines" % (args.run, PREFIX))
+
+    if args.update:
+        with open(args.baseline, "w") as f:
+            f.write("# expected estimate of the timing model, written by Tools/timing_gate.py --update\n")
+            f.write("\n".join(lines) + "\n")
+        print("%s updated" % args.baseline)
+        return 0
+
+    _, base = read(args.baseline)
+    failed = []
+    for key in CONFIG:
+        if run.get(key) != base.get(key):
+            failed.append("%s %s, baseline %s" % (key, run.get(key), base.get(key)))
+    limit = args.tolerance / 100.0
+    for key in HIGHER + LOWER:
+        now, was = number(run.get(key, "")), number(base.get(key, ""))
+        if now is None or was is None:
+            failed.append("%s missing" % key)
+            continue
+        # 0.05 absorbs the rounding of the printed cycles per byte
+        worse = (now < was * (1.0 - limit)) if key in HIGHER else (now > was * (1.0 + limit) + 0.05)
+        print("%-10s %12s  baseline %12s%s" % (key, run[key], base[key], "  REGRESSION" if worse else ""))
+        if worse:
+            failed.append("%s %s, baseline %s" % (key, run[key], base[key]))
+
+    if failed:
+        print("timing gate failed: " + "; ".join(failed))
+        return 1
+    print("timing gate passed, tolerance %.1f%%" % args.tolerance)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
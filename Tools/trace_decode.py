@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+"""Decode the binary event trace into a Chrome trace / Perfetto JSON file.
+
+Reads a raw capture of the ASCLIN3 output (text lines and trace frames mixed,
+as sent after `test = 14`), extracts the frames written by TRACE_Drain() and
+writes a timeline which opens in chrome://tracing or ui.perfetto.dev. One
+track per core; instrumented interrupt handlers are slices, all other events
+are instants.
+
+    python3 Tools/trace_decode.py uart.bin -o trace.json
+    python3 Tools/trace_decode.py --stm-hz 100000000 uart.bin > trace.json
+
+Only the Python standard library is used. The handler names are taken from
+the SRPN_xxx defines in Configurations/IntPrioDef.h.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+RECORD = struct.Struct("<IIBBHI")
+MAX_EVENTS = 12
+
+# trace_Event in Application/trace_public.h
+CLOCK, DROPPED, ISR_ENTER, ISR_EXIT, DMA_TX_DONE, DMA_RX_DONE, UART_ERROR, COMMAND = range(8)
+NAMES = {
+    DMA_TX_DONE: ("dmaTxDone", "transfers"),
+    DMA_RX_DONE: ("dmaRxDone", "transfers"),
+    UART_ERROR: ("uartError", "flags"),
+    COMMAND: ("command", None),
+}
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+
+def read_srpn_names(path):
+    """SRPN -> handler name from the SRPN_xxx defines."""
+    names = {}
+    try:
+        with open(path) as f:
+            for match in re.finditer(r"#define\s+SRPN_(\w+)\s+(\d+)", f.read()):
+                names.setdefault(int(match.group(2)), match.group(1))
+    except OSError:
+        pass
+    return names
+
+
+def read_frames(data):
+    """Records of all frames with a valid checksum, and the number of bad frames."""
+    records = []
+    bad = 0
+    pos = data.find(SYNC)
+    while pos >= 0 and pos + 3 <= len(data):
+        count = data[pos + 2]
+        end = pos + 3 + count * RECORD.size
+        if 0 < count <= MAX_EVENTS and end < len(data) and sum(data[pos + 3:end]) & 0xFF == data[end]:
+            records.extend(RECORD.unpack_from(data, off) for off in range(pos + 3, end, RECORD.size))
+            pos = data.find(SYNC, end + 1)
+        else:
+            bad += 1
+            pos = data.find(SYNC, pos + 1)
+    return records, bad
+
+
+def timeline(records, stm_hz, srpn_names):
+    """Chrome trace events, time stamps in microseconds from the first record."""
+    events = [((high << 32) | low, cpu, event, arg0, arg1) for low, high, cpu, event, arg0, arg1 in records]
+    events.sort(key=lambda e: e[0])
+    if not events:
+        return []
+
+    out = []
+    for cpu in sorted({e[1] for e in events}):
+        out.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": cpu, "args": {"name": "CPU%d" % cpu}})
+
+    # the STM frequency changes with the clock, integrate piecewise
+    base_tick = events[0][0]
+    base_us = 0.0
+    for tick, cpu, event, arg0, arg1 in events:
+        ts = base_us + (tick - base_tick) * 1e6 / stm_hz
+        common = {"pid": 0, "tid": cpu, "ts": ts}
+        if event == CLOCK and arg1:
+            base_tick, base_us, stm_hz = tick, ts, arg1
+            out.append(dict(common, ph="C", name="fSTM", args={"MHz": arg1 / 1e6}))
+        elif event == DROPPED:
+            out.append(dict(common, ph="i", s="g", name="dropped", args={"cpu": arg0, "events": arg1}))
+        elif event in (ISR_ENTER, ISR_EXIT):
+            name = srpn_names.get(arg0, "SRPN %d" % arg0)
+            out.append(dict(common, ph="B" if event == ISR_ENTER else "E", name=name, cat="isr"))
+        else:
+            name, arg_name = NAMES.get(event, ("event%d" % event, "arg1"))
+            args = {"arg0": arg0}
+            if arg_name:
+                args[arg_name] = "0x%08X" % arg1 if event == UART_ERROR else arg1
+            out.append(dict(common, ph="i", s="t", name=name, args=args))
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", help="raw UART capture, '-' for stdin")
+    parser.add_argument("-o", "--output", help="JSON file, default stdout")
+    parser.add_argument("--stm-hz", type=float, default=100e6,
+                        help="STM frequency until the first clock event (default 100 MHz)")
+    parser.add_argument("--intprio", default=os.path.join(ROOT, "Configurations", "IntPrioDef.h"),
+                        help="header with the SRPN_xxx defines")
+    args = parser.parse_args()
+
+    if args.capture == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.capture, "rb") as f:
+            data = f.read()
+
+    records, bad = read_frames(data)
+    trace = {"traceEvents": timeline(records, args.stm_hz, read_srpn_names(args.intprio)),
+             "displayTimeUnit": "ns"}
+    sys.stderr.write("%d events, %d damaged frames\n" % (len(records), bad))
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(trace, f, indent=1)
+    else:
+        json.dump(trace, sys.stdout, indent=1)
+
+
+if __name__ == "__main__":
+    main()